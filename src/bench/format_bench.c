@@ -0,0 +1,192 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <locale.h>
+#include <math.h>
+#include <monetary.h>
+
+#include "../include/macros.h"    /* LOCALE */
+#include "../include/workfuncs.h" /* FormatDouble (), DoubleToFormattedStr () */
+
+/* FormatDouble () checked against strfmon/printf for every format and
+   precision, then timed against the setlocale ()/strfmon path it replaced.
+
+   make format_bench && ../build/format_bench */
+
+#define BENCH_VALUES 20000
+#define BENCH_ROUNDS 10
+
+static void reference(gchar *buf, gsize size, gdouble num, guint8 dec_pts,
+                      guint type) {
+  gchar fmt[16];
+
+  if (type == MON_STR) {
+    g_snprintf(fmt, sizeof(fmt), "%%(.%un", dec_pts);
+    strfmon(buf, size, fmt, num);
+  } else {
+    g_snprintf(fmt, sizeof(fmt), "%%'.%ulf%s", dec_pts,
+               type == PER_STR ? "%%" : "");
+    snprintf(buf, size, fmt, num);
+  }
+}
+
+static void legacy(gchar **dst, gdouble num, guint8 dec_pts, guint type)
+/* The replaced path: setlocale () for every number, a sized realloc, then
+   strfmon or printf. */
+{
+  gchar fmt[16];
+  dst[0] = g_realloc(dst[0], FORMAT_BUF_SIZE);
+
+  if (type == MON_STR) {
+    g_snprintf(fmt, sizeof(fmt), "%%(.%un", dec_pts);
+    setlocale(LC_ALL, LOCALE);
+    strfmon(dst[0], FORMAT_BUF_SIZE, fmt, num);
+  } else {
+    g_snprintf(fmt, sizeof(fmt), "%%'.%ulf%s", dec_pts,
+               type == PER_STR ? "%%" : "");
+    setlocale(LC_NUMERIC, LOCALE);
+    g_snprintf(dst[0], FORMAT_BUF_SIZE, fmt, num);
+  }
+}
+
+static gdouble *bench_values(gsize *n)
+/* Random prices and changes over nine orders of magnitude, then the
+   rounding edge cases.  Must free return value. */
+{
+  static const gdouble edge_arr[] = {
+      0.0,    -0.0,    0.005,     0.015,         0.125,    -0.125,
+      1.005,  2.675,   -2.675,    999.995,       999999.5, 1000000.0,
+      -0.004, 0.00005, 0.0000499, 123456789.125, 1e12,     -1e15,
+      0.5,    1.5,     2.5,       9.9999,        99999.99995};
+  GRand *rand = g_rand_new_with_seed(42);
+  gdouble *v = g_new(gdouble, BENCH_VALUES + G_N_ELEMENTS(edge_arr));
+
+  for (gsize i = 0; i < BENCH_VALUES; i++) {
+    gdouble mag = pow(10.0, g_rand_double_range(rand, -4.0, 9.0));
+    v[i] = g_rand_boolean(rand) ? -mag : mag;
+  }
+  memcpy(v + BENCH_VALUES, edge_arr, sizeof(edge_arr));
+  *n = BENCH_VALUES + G_N_ELEMENTS(edge_arr);
+
+  g_rand_free(rand);
+  return v;
+}
+
+static guint cross_check(const gdouble *v, gsize n) {
+  gchar got[FORMAT_BUF_SIZE], want[FORMAT_BUF_SIZE];
+  guint mismatches = 0;
+
+  for (gsize i = 0; i < n; i++)
+    for (guint type = MON_STR; type <= NUM_STR; type++)
+      for (guint8 d = 0; d <= 4; d++) {
+        FormatDouble(got, sizeof(got), v[i], d, type);
+        reference(want, sizeof(want), v[i], d, type);
+        if (g_strcmp0(got, want) != 0 && ++mismatches <= 10)
+          g_print("mismatch %.17g [type %u, %u places]: '%s' != '%s'\n",
+                  v[i], type, d, got, want);
+      }
+  return mismatches;
+}
+
+static guint huge_check()
+/* Values too large for FORMAT_BUF_SIZE are truncated, not overrun. */
+{
+  static const gdouble huge_arr[] = {1e40, -1e40, 1e60, -1e60, G_MAXDOUBLE,
+                                     -G_MAXDOUBLE};
+  gchar *str = NULL, buf[FORMAT_BUF_SIZE];
+  guint errors = 0;
+
+  for (gsize i = 0; i < G_N_ELEMENTS(huge_arr); i++)
+    for (guint type = MON_STR; type <= NUM_STR; type++)
+      for (guint8 d = 0; d <= 4; d++) {
+        gsize len = FormatDouble(buf, sizeof(buf), huge_arr[i], d, type);
+        DoubleToFormattedStr(&str, huge_arr[i], d, type);
+        if ((strlen(str) != MIN(len, sizeof(buf) - 1) ||
+             g_strcmp0(str, buf) != 0) &&
+            ++errors <= 10)
+          g_print("huge %g [type %u, %u places]: '%s' != '%s'\n",
+                  huge_arr[i], type, d, str, buf);
+      }
+
+  g_free(str);
+  return errors;
+}
+
+int main() {
+  gsize n;
+  gdouble *v = bench_values(&n);
+  gchar *str = NULL, buf[FORMAT_BUF_SIZE];
+
+  /* Sets LOCALE for the reference functions too. */
+  FormatDouble(buf, sizeof(buf), 0.0, 2, MON_STR);
+  g_print("Locale '%s', '%s' [%s].\n", LOCALE, buf,
+          setlocale(LC_MONETARY, NULL));
+
+  guint mismatches = cross_check(v, n);
+  g_print("Cross-check: %u mismatches in %" G_GSIZE_FORMAT " strings.\n",
+          mismatches, n * 15);
+
+  guint huge = huge_check();
+  g_print("Huge values: %u truncation errors.\n", huge);
+
+  gsize calls = n * 3 * BENCH_ROUNDS;
+  gint64 start = g_get_monotonic_time();
+  for (guint r = 0; r < BENCH_ROUNDS; r++)
+    for (gsize i = 0; i < n; i++)
+      for (guint type = MON_STR; type <= NUM_STR; type++)
+        legacy(&str, v[i], 2, type);
+  gint64 legacy_us = g_get_monotonic_time() - start;
+
+  start = g_get_monotonic_time();
+  for (guint r = 0; r < BENCH_ROUNDS; r++)
+    for (gsize i = 0; i < n; i++)
+      for (guint type = MON_STR; type <= NUM_STR; type++)
+        DoubleToFormattedStr(&str, v[i], 2, type);
+  gint64 heap_us = g_get_monotonic_time() - start;
+
+  start = g_get_monotonic_time();
+  for (guint r = 0; r < BENCH_ROUNDS; r++)
+    for (gsize i = 0; i < n; i++)
+      for (guint type = MON_STR; type <= NUM_STR; type++)
+        FormatDouble(buf, sizeof(buf), v[i], 2, type);
+  gint64 stack_us = g_get_monotonic_time() - start;
+
+  g_print("setlocale + strfmon/printf   %7.1f ns/string\n"
+          "DoubleToFormattedStr ()      %7.1f ns/string\n"
+          "FormatDouble () [stack]      %7.1f ns/string\n",
+          legacy_us * 1000.0 / calls, heap_us * 1000.0 / calls,
+          stack_us * 1000.0 / calls);
+
+  g_free(str);
+  g_free(v);
+  return mismatches || huge ? EXIT_FAILURE : EXIT_SUCCESS;
+}
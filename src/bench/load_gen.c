@@ -0,0 +1,159 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "../include/bench.h"
+#include "../include/class_types.h" /* portfolio_packet, meta, equity_folder */
+#include "../include/json.h"
+#include "../include/multicurl.h"
+
+/* The equity folder holds at most 255 stocks [its size is a guint8]. */
+#define LOAD_GEN_FOLDER_MAX 255
+
+typedef struct { /* The quote requests beyond the equity folder. */
+  CURL **hnd_arr;
+  MemType *data_arr;
+  gchar **url_arr;
+  guint size;
+} load_gen_extra;
+
+static gint latency_cmp(gconstpointer a, gconstpointer b) {
+  gint64 la = *(const gint64 *)a, lb = *(const gint64 *)b;
+  return (la > lb) - (la < lb);
+}
+
+static gdouble percentile_ms(const gint64 *sorted_arr, guint n, gdouble p)
+/* Nearest rank percentile of a sorted microsecond array, in milliseconds. */
+{
+  guint rank = (guint)(p * n);
+  return (gdouble)sorted_arr[MIN(rank, n - 1)] / 1000.0;
+}
+
+static void extra_extract(load_gen_extra *extra)
+/* Parse the extra quotes as the equity class does, then free them. */
+{
+  gdouble cur, high, low, open, prev, ch_share, ch_percent;
+
+  for (guint i = 0; i < extra->size; i++) {
+    JsonExtractEquity(extra->data_arr[i].memory, &cur, &high, &low, &open,
+                      &prev, &ch_share, &ch_percent);
+    FreeMemtype(&extra->data_arr[i]);
+  }
+}
+
+gint LoadGenRun(portfolio_packet *pkg, guint symbols, const gchar *url,
+                guint cycles)
+/* Point every request at a mock server, fetch symbols quotes once a second
+   for the given number of cycles, and print the end-to-end cycle latency
+   [fetch, extract, calculate, and ToStrings] percentiles.
+
+   Returns the number of failed cycles. */
+{
+  meta *D = pkg->GetMetaClass();
+  equity_folder *F = pkg->GetEquityFolderClass();
+  guint folder_num = MIN(symbols, LOAD_GEN_FOLDER_MAX);
+  load_gen_extra extra = {NULL, NULL, NULL, symbols - folder_num};
+  gchar symbol[16];
+
+  if (symbols == 0 || cycles == 0)
+    return 0;
+
+  /* The indices and bullion follow the quotes to the mock server. */
+  TransportSetBaseUrl(url);
+  g_free(D->stock_url_ch);
+  g_free(D->curl_key_ch);
+  D->stock_url_ch = g_strconcat(url, "/api/v1/quote?symbol=", NULL);
+  D->curl_key_ch = g_strdup("");
+
+  F->Reset();
+  for (guint i = 0; i < folder_num; i++) {
+    g_snprintf(symbol, sizeof(symbol), "MOCK%05u", i);
+    F->AddStock(symbol, "10", "100.00");
+  }
+  F->GenerateURL(pkg);
+
+  /* Symbols beyond the folder are fetched and parsed in the same multi
+     handle, but aren't calculated or converted to strings. */
+  extra.hnd_arr = g_new0(CURL *, extra.size + 1);
+  extra.data_arr = g_new0(MemType, extra.size + 1);
+  extra.url_arr = g_new0(gchar *, extra.size + 1);
+  for (guint i = 0; i < extra.size; i++) {
+    g_snprintf(symbol, sizeof(symbol), "MOCK%05u", folder_num + i);
+    extra.hnd_arr[i] = curl_easy_init();
+    extra.url_arr[i] =
+        g_strconcat(D->stock_url_ch, symbol, D->curl_key_ch, NULL);
+  }
+
+  gint64 *latency_arr = g_new(gint64, cycles);
+  guint failed = 0;
+
+  for (guint c = 0; c < cycles; c++) {
+    gint64 start = g_get_monotonic_time();
+
+    for (guint i = 0; i < extra.size; i++)
+      SetUpCurlHandle(extra.hnd_arr[i], pkg->multicurl_main_hnd,
+                      extra.url_arr[i], &extra.data_arr[i]);
+
+    if (pkg->GetData())
+      failed++;
+    pkg->ExtractData();
+    extra_extract(&extra);
+    pkg->Calculate();
+    pkg->ToStrings();
+
+    latency_arr[c] = g_get_monotonic_time() - start;
+
+    /* Refresh once a second, the highest GUI update rate. */
+    gint64 wait = start + G_TIME_SPAN_SECOND - g_get_monotonic_time();
+    if (wait > 0 && c + 1 < cycles)
+      g_usleep((gulong)wait);
+  }
+
+  qsort(latency_arr, cycles, sizeof(gint64), latency_cmp);
+  g_print("Load: %u symbols, %u cycles, %u failed.\n"
+          "Cycle latency [ms]: p50 %.1f, p90 %.1f, p99 %.1f, max %.1f\n",
+          symbols, cycles, failed, percentile_ms(latency_arr, cycles, 0.50),
+          percentile_ms(latency_arr, cycles, 0.90),
+          percentile_ms(latency_arr, cycles, 0.99),
+          (gdouble)latency_arr[cycles - 1] / 1000.0);
+
+  for (guint i = 0; i < extra.size; i++) {
+    curl_multi_remove_handle(pkg->multicurl_main_hnd, extra.hnd_arr[i]);
+    curl_easy_cleanup(extra.hnd_arr[i]);
+    FreeMemtype(&extra.data_arr[i]);
+  }
+  g_strfreev(extra.url_arr);
+  g_free(extra.hnd_arr);
+  g_free(extra.data_arr);
+  g_free(latency_arr);
+
+  return (gint)failed;
+}
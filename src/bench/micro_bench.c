@@ -0,0 +1,375 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <glib/gstdio.h>
+#include <json-glib/json-glib.h>
+
+#include "../include/class.h" /* ClassInitEquityFolder () */
+#include "../include/gui.h" /* HistoryMakeStore (), CompletionPrefixMatch () */
+#include "../include/json.h"
+#include "../include/macros.h" /* MAIN_FONT */
+#include "../include/mutex.h"
+#include "../include/workfuncs.h"
+
+/* Microbenchmarks of the refresh and symbol lookup hot paths on the fixed
+   inputs in bench/data [a finnhub quote, a year of Yahoo! history, and a
+   nasdaqtrader symbol list], without a display or the network.
+
+   Each case prints one JSON line; ns_op is the median of the rounds.  With
+   --baseline the earlier run's ns_op and the change are added, so two
+   commits compare with one command.
+
+   make bench
+   ../build/micro_bench [--data DIR] [--rounds N] [--baseline FILE] */
+
+GMutex mutexes[MUTEX_NUMBER]; /* financials.c isn't linked. */
+
+#define BENCH_ROUNDS 15
+#define BENCH_ROUND_US 20000 /* The ops per round are scaled to this. */
+#define BENCH_STOCKS 255     /* A full equity folder. */
+
+typedef void (*bench_func)(gpointer data, guint ops);
+
+typedef struct {
+  gchar *quote_ch;
+  gchar *history_ch;
+  gsize history_len;
+  gdouble *close_arr; /* The history closing prices. */
+  guint close_num;
+  symbol_name_map *sn_map;
+  equity_folder *F;
+} bench_inputs;
+
+static volatile gdouble sink_f; /* Keeps the results live. */
+
+static void bench_json_extract_equity(gpointer data, guint ops) {
+  bench_inputs *in = (bench_inputs *)data;
+  gdouble cur, high, low, open, prev, ch_share, ch_percent;
+
+  for (guint i = 0; i < ops; i++)
+    JsonExtractEquity(in->quote_ch, &cur, &high, &low, &open, &prev,
+                      &ch_share, &ch_percent);
+  sink_f = cur;
+}
+
+static void bench_extract_yahoo_data(gpointer data, guint ops) {
+  bench_inputs *in = (bench_inputs *)data;
+  gdouble prev, cur;
+
+  for (guint i = 0; i < ops; i++) {
+    FILE *fp = fmemopen(in->history_ch, in->history_len, "r");
+    g_free(ExtractYahooData(fp, &prev, &cur));
+    fclose(fp);
+  }
+  sink_f = cur;
+}
+
+static void bench_history_make_store(gpointer data, guint ops) {
+  bench_inputs *in = (bench_inputs *)data;
+
+  for (guint i = 0; i < ops; i++)
+    g_object_unref(HistoryMakeStore(in->history_ch, in->history_len));
+}
+
+static void bench_double_to_formatted_str(gpointer data, guint ops) {
+  bench_inputs *in = (bench_inputs *)data;
+  gchar *str = NULL;
+
+  for (guint i = 0; i < ops; i++)
+    DoubleToFormattedStr(&str, in->close_arr[i % in->close_num] * 1000.0, 2,
+                         MON_STR);
+  g_free(str);
+}
+
+static void bench_string_to_str_pango(gpointer data, guint ops) {
+  bench_inputs *in = (bench_inputs *)data;
+  gchar *str = NULL;
+
+  for (guint i = 0; i < ops; i++)
+    StringToStrPango(
+        &str,
+        in->sn_map->sn_container_arr[i % in->sn_map->size]->security_name,
+        BLUE);
+  g_free(str);
+}
+
+static void bench_calc_run_avg_rsi(gpointer data, guint ops) {
+  bench_inputs *in = (bench_inputs *)data;
+  gdouble avg_gain = 1.0, avg_loss = 1.0;
+
+  for (guint i = 0; i < ops; i++) {
+    guint c = i % (in->close_num - 1) + 1;
+    CalcRunAvgRsi(CalcGain(in->close_arr[c], in->close_arr[c - 1]),
+                  &avg_gain, &avg_loss, 14.0);
+  }
+  sink_f = CalcRsi(avg_gain, avg_loss);
+}
+
+static void bench_equity_calculate(gpointer data, guint ops) {
+  bench_inputs *in = (bench_inputs *)data;
+
+  for (guint i = 0; i < ops; i++)
+    in->F->Calculate();
+  sink_f = in->F->stock_port_value_f;
+}
+
+static void bench_completion_match(gpointer data, guint ops)
+/* One op is one key against every row, as the completion popup filters. */
+{
+  static const gchar *key_arr[] = {"ap", "glob", "ZZ", "qua", "mer", "B"};
+  bench_inputs *in = (bench_inputs *)data;
+  guint matches = 0;
+
+  for (guint i = 0; i < ops; i++) {
+    const gchar *key = key_arr[i % G_N_ELEMENTS(key_arr)];
+    for (gushort r = 0; r < in->sn_map->size; r++)
+      matches += CompletionPrefixMatch(
+          key, in->sn_map->sn_container_arr[r]->symbol,
+          in->sn_map->sn_container_arr[r]->security_name);
+  }
+  sink_f = matches;
+}
+
+static void bench_create_hash_table(gpointer data, guint ops) {
+  bench_inputs *in = (bench_inputs *)data;
+
+  for (guint i = 0; i < ops; i++) {
+    CreateHashTable(in->sn_map);
+    g_hash_table_destroy(in->sn_map->hash_table);
+    in->sn_map->hash_table = NULL;
+  }
+}
+
+static gdouble run_round(bench_func func, gpointer data, guint ops)
+/* Nanoseconds per op. */
+{
+  gint64 start = g_get_monotonic_time();
+  func(data, ops);
+  return (g_get_monotonic_time() - start) * 1000.0 / ops;
+}
+
+static guint calibrate(bench_func func, gpointer data)
+/* The ops that take about BENCH_ROUND_US [this is also the warm up]. */
+{
+  guint ops = 1;
+  gint64 dur_us;
+
+  do {
+    gint64 start = g_get_monotonic_time();
+    func(data, ops);
+    dur_us = g_get_monotonic_time() - start;
+    if (dur_us < BENCH_ROUND_US / 4)
+      ops *= 4;
+  } while (dur_us < BENCH_ROUND_US / 4 && ops < (1u << 28));
+
+  return MAX(1, (guint)((gdouble)ops * BENCH_ROUND_US / MAX(dur_us, 1)));
+}
+
+static gint double_cmp(gconstpointer a, gconstpointer b) {
+  gdouble da = *(const gdouble *)a, db = *(const gdouble *)b;
+  return (da > db) - (da < db);
+}
+
+static void bench_run(const gchar *name, bench_func func, gpointer data,
+                      guint rounds, GHashTable *baseline) {
+  guint ops = calibrate(func, data);
+  gdouble *ns_arr = g_new(gdouble, rounds);
+
+  for (guint r = 0; r < rounds; r++)
+    ns_arr[r] = run_round(func, data, ops);
+  qsort(ns_arr, rounds, sizeof(gdouble), double_cmp);
+
+  gdouble median = ns_arr[rounds / 2];
+  g_print("{\"name\":\"%s\",\"ops\":%u,\"rounds\":%u,\"ns_op\":%.1f,"
+          "\"min_ns_op\":%.1f,\"max_ns_op\":%.1f",
+          name, ops, rounds, median, ns_arr[0], ns_arr[rounds - 1]);
+
+  gdouble *base = baseline ? g_hash_table_lookup(baseline, name) : NULL;
+  if (base && *base > 0)
+    g_print(",\"baseline_ns_op\":%.1f,\"change_pct\":%.1f", *base,
+            (median - *base) * 100.0 / *base);
+  g_print("}\n");
+
+  g_free(ns_arr);
+}
+
+static GHashTable *baseline_read(const gchar *path)
+/* The name to ns_op table of an earlier run.  Must free return value. */
+{
+  gchar *contents = NULL;
+  if (!g_file_get_contents(path, &contents, NULL, NULL)) {
+    g_fprintf(stderr, "Cannot read the baseline '%s'.\n", path);
+    return NULL;
+  }
+
+  GHashTable *table =
+      g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+  gchar **line_arr = g_strsplit(contents, "\n", -1);
+  JsonParser *parser = json_parser_new();
+
+  for (guint i = 0; line_arr[i]; i++) {
+    if (!line_arr[i][0] ||
+        !json_parser_load_from_data(parser, line_arr[i], -1, NULL))
+      continue;
+    JsonNode *root = json_parser_get_root(parser);
+    if (!JSON_NODE_HOLDS_OBJECT(root))
+      continue;
+    JsonObject *obj = json_node_get_object(root);
+    if (!json_object_has_member(obj, "name") ||
+        !json_object_has_member(obj, "ns_op"))
+      continue;
+
+    gdouble *ns = g_new(gdouble, 1);
+    *ns = json_object_get_double_member(obj, "ns_op");
+    g_hash_table_replace(table,
+                         g_strdup(json_object_get_string_member(obj, "name")),
+                         ns);
+  }
+
+  g_object_unref(parser);
+  g_strfreev(line_arr);
+  g_free(contents);
+  return table;
+}
+
+static gchar *data_file(const gchar *dir, const gchar *file, gsize *len)
+/* Exits if a fixture is missing.  Must free return value. */
+{
+  gchar *path = g_build_filename(dir, file, NULL);
+  gchar *contents = NULL;
+
+  if (!g_file_get_contents(path, &contents, len, NULL)) {
+    g_fprintf(stderr, "Cannot read '%s', run from src/ or pass --data.\n",
+              path);
+    exit(EXIT_FAILURE);
+  }
+  g_free(path);
+  return contents;
+}
+
+static void inputs_load(bench_inputs *in, const gchar *dir) {
+  in->quote_ch = data_file(dir, "quote.json", NULL);
+  in->history_ch = data_file(dir, "history.csv", &in->history_len);
+
+  /* The closing prices, column 4 of the history rows. */
+  GArray *close = g_array_new(FALSE, FALSE, sizeof(gdouble));
+  gchar **line_arr = g_strsplit(in->history_ch, "\n", -1);
+  for (guint i = 1; line_arr[i]; i++) {
+    gchar **token_arr = g_strsplit(line_arr[i], ",", -1);
+    if (g_strv_length(token_arr) >= 7 && g_strcmp0(token_arr[4], "null")) {
+      gdouble f = g_strtod(token_arr[4], NULL);
+      g_array_append_val(close, f);
+    }
+    g_strfreev(token_arr);
+  }
+  g_strfreev(line_arr);
+  in->close_num = close->len;
+  in->close_arr = (gdouble *)g_array_free(close, FALSE);
+
+  /* The symbol list, "Symbol|Security Name" after the header. */
+  gchar *symbols_ch = data_file(dir, "symbols.txt", NULL);
+  in->sn_map = g_new0(symbol_name_map, 1);
+  line_arr = g_strsplit(symbols_ch, "\n", -1);
+  for (guint i = 1; line_arr[i]; i++) {
+    gchar **token_arr = g_strsplit(line_arr[i], "|", 2);
+    if (g_strv_length(token_arr) == 2)
+      AddSymbolToMap(token_arr[0], token_arr[1], in->sn_map);
+    g_strfreev(token_arr);
+  }
+  g_strfreev(line_arr);
+  g_free(symbols_ch);
+
+  /* A full equity folder, quoted from the history. */
+  in->F = ClassInitEquityFolder();
+  for (guint i = 0; i < BENCH_STOCKS && i < in->sn_map->size; i++) {
+    gchar *shares = g_strdup_printf("%u", i % 7 ? i * 3 : 0);
+    in->F->AddStock(in->sn_map->sn_container_arr[i]->symbol, shares, "42.5");
+    g_free(shares);
+
+    stock *S = in->F->Equity[in->F->size - 1];
+    S->current_price_stock_f = in->close_arr[i % in->close_num];
+    S->change_share_f = S->current_price_stock_f -
+                        in->close_arr[(i + in->close_num - 1) % in->close_num];
+  }
+}
+
+static void inputs_free(bench_inputs *in) {
+  g_free(in->quote_ch);
+  g_free(in->history_ch);
+  g_free(in->close_arr);
+  SNMapDestruct(in->sn_map);
+  g_free(in->sn_map);
+  ClassDestructEquityFolder(in->F);
+}
+
+int main(int argc, char *argv[]) {
+  const gchar *dir = "bench/data", *baseline_path = NULL;
+  guint rounds = BENCH_ROUNDS;
+
+  for (gint i = 1; i + 1 < argc; i += 2) {
+    if (!g_strcmp0("-d", argv[i]) || !g_strcmp0("--data", argv[i]))
+      dir = argv[i + 1];
+    else if (!g_strcmp0("-b", argv[i]) || !g_strcmp0("--baseline", argv[i]))
+      baseline_path = argv[i + 1];
+    else if (!g_strcmp0("-r", argv[i]) || !g_strcmp0("--rounds", argv[i]))
+      rounds = MAX(1, (guint)g_ascii_strtoull(argv[i + 1], NULL, 10));
+  }
+
+  /* The pango span prefixes, as ClassInitMeta sets them. */
+  SetFont(MAIN_FONT);
+  bench_inputs in = {0};
+  inputs_load(&in, dir);
+  GHashTable *baseline = baseline_path ? baseline_read(baseline_path) : NULL;
+
+  bench_run("JsonExtractEquity", bench_json_extract_equity, &in, rounds,
+            baseline);
+  bench_run("ExtractYahooData", bench_extract_yahoo_data, &in, rounds,
+            baseline);
+  bench_run("HistoryMakeStore", bench_history_make_store, &in, rounds,
+            baseline);
+  bench_run("DoubleToFormattedStr", bench_double_to_formatted_str, &in,
+            rounds, baseline);
+  bench_run("StringToStrPango", bench_string_to_str_pango, &in, rounds,
+            baseline);
+  bench_run("CalcRunAvgRsi", bench_calc_run_avg_rsi, &in, rounds, baseline);
+  bench_run("EquityCalculate", bench_equity_calculate, &in, rounds, baseline);
+  bench_run("CompletionPrefixMatch", bench_completion_match, &in, rounds,
+            baseline);
+  bench_run("CreateHashTable", bench_create_hash_table, &in, rounds,
+            baseline);
+
+  if (baseline)
+    g_hash_table_destroy(baseline);
+  inputs_free(&in);
+  StrArenaDestruct();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,375 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/* A local stand-in for the finnhub.io, Yahoo! and nasdaqtrader endpoints,
+   for load testing without the 60 calls per minute Finnhub limit.
+
+   mock_server [--port 8087] [--latency 20] [--jitter 10] [--error-rate 0.0]
+               [--volatility 0.001] [--symbols 10000] [--threads 256]
+
+   /api/v1/quote?symbol=X                  Finnhub quote JSON.
+   /v7/finance/download/X?period1=&period2= Yahoo! daily CSV.
+   /dynamic/SymDir/nasdaqlisted.txt        nasdaqtrader symbol lists.
+   /dynamic/SymDir/otherlisted.txt
+
+   Every quote request moves the symbol's price one random walk step.  Point
+   the application at the server with FINANCIALS_BASE_URL, or run
+   'financials --load'. */
+
+#include <gio/gio.h>
+#include <glib/gprintf.h> /* g_fprintf() */
+#include <math.h>
+
+#include "../include/macros.h" /* UNUSED */
+
+/* Command line options */
+static gint port = 8087;
+static gint latency_ms = 20;
+static gint jitter_ms = 10;
+static gdouble error_rate = 0.0;
+static gdouble volatility = 0.001;
+static gint symbols = 10000;
+static gint threads = 256;
+
+static const GOptionEntry entries[] = {
+    {"port", 'p', 0, G_OPTION_ARG_INT, &port, "Listen on 127.0.0.1:PORT",
+     "PORT"},
+    {"latency", 'l', 0, G_OPTION_ARG_INT, &latency_ms,
+     "Mean response latency in milliseconds", "MS"},
+    {"jitter", 'j', 0, G_OPTION_ARG_INT, &jitter_ms,
+     "Uniform latency jitter in milliseconds", "MS"},
+    {"error-rate", 'e', 0, G_OPTION_ARG_DOUBLE, &error_rate,
+     "Fraction of requests answered with 429", "RATE"},
+    {"volatility", 'v', 0, G_OPTION_ARG_DOUBLE, &volatility,
+     "Random walk step deviation per quote request", "SIGMA"},
+    {"symbols", 's', 0, G_OPTION_ARG_INT, &symbols,
+     "Number of symbols in the symbol lists", "N"},
+    {"threads", 't', 0, G_OPTION_ARG_INT, &threads,
+     "Maximum concurrent connections served", "N"},
+    {NULL}};
+
+typedef struct { /* A symbol's random walk. */
+  gdouble price;
+  gdouble open;
+  gdouble high;
+  gdouble low;
+  gdouble prev_close;
+} price_walk;
+
+/* The walks are guarded by walk_mutex. */
+static GMutex walk_mutex;
+static GHashTable *walk_table = NULL; /* Symbol to price_walk. */
+static GRand *walk_rand = NULL;
+static gchar *nasdaq_list = NULL;
+static gchar *other_list = NULL;
+
+static gdouble normal_random(GRand *rand)
+/* A standard normal variate [Box-Muller]. */
+{
+  gdouble u = g_rand_double_range(rand, 1e-12, 1.0);
+  gdouble v = g_rand_double(rand);
+  return sqrt(-2.0 * log(u)) * cos(2.0 * G_PI * v);
+}
+
+static gdouble initial_price(const gchar *symbol)
+/* A stable starting price between 10 and 500. */
+{
+  return 10.0 + (gdouble)(g_str_hash(symbol) % 49000) / 100.0;
+}
+
+static price_walk walk_step(const gchar *symbol)
+/* Move the symbol's price one step, return a copy of its state. */
+{
+  g_mutex_lock(&walk_mutex);
+
+  price_walk *w = g_hash_table_lookup(walk_table, symbol);
+  if (w == NULL) {
+    w = g_malloc(sizeof(*w));
+    w->price = w->open = w->high = w->low = w->prev_close =
+        initial_price(symbol);
+    g_hash_table_insert(walk_table, g_strdup(symbol), w);
+  }
+
+  w->price *= 1.0 + volatility * normal_random(walk_rand);
+
+  if (w->price < 0.01)
+    w->price = 0.01;
+  if (w->price > w->high)
+    w->high = w->price;
+  if (w->price < w->low)
+    w->low = w->price;
+
+  price_walk copy = *w;
+  g_mutex_unlock(&walk_mutex);
+  return copy;
+}
+
+static gchar *query_param(const gchar *target, const gchar *name)
+/* Return the value of a query parameter, NULL if absent.  Must free return
+   value. */
+{
+  const gchar *query = strchr(target, '?');
+  if (query == NULL)
+    return NULL;
+
+  gsize len = strlen(name);
+  for (const gchar *p = query; p; p = strchr(p + 1, '&')) {
+    if (!strncmp(p + 1, name, len) && p[len + 1] == '=') {
+      const gchar *value = p + len + 2;
+      return g_strndup(value, strcspn(value, "&"));
+    }
+  }
+  return NULL;
+}
+
+static GString *quote_body(const gchar *target) {
+  gchar *symbol = query_param(target, "symbol");
+  price_walk w = walk_step(symbol ? symbol : "");
+  g_free(symbol);
+
+  GString *body = g_string_new(NULL);
+  g_string_printf(body,
+                  "{\"c\":%.2f,\"d\":%.2f,\"dp\":%.4f,\"h\":%.2f,\"l\":%.2f,"
+                  "\"o\":%.2f,\"pc\":%.2f,\"t\":%" G_GINT64_FORMAT "}",
+                  w.price, w.price - w.prev_close,
+                  100.0 * (w.price - w.prev_close) / w.prev_close, w.high,
+                  w.low, w.open, w.prev_close,
+                  g_get_real_time() / G_TIME_SPAN_SECOND);
+  return body;
+}
+
+static GString *history_body(const gchar *target)
+/* Daily rows from period1 to period2, a walk that ends at the symbol's
+   current price. */
+{
+  const gchar *path = target + strlen("/v7/finance/download/");
+  gchar *symbol = g_strndup(path, strcspn(path, "?"));
+  gchar *p1 = query_param(target, "period1");
+  gchar *p2 = query_param(target, "period2");
+  gint64 start = p1 ? g_ascii_strtoll(p1, NULL, 10) : 0;
+  gint64 end = p2 ? g_ascii_strtoll(p2, NULL, 10) : 0;
+  g_free(p1);
+  g_free(p2);
+
+  gint64 days = CLAMP((end - start) / 86400, 1, 10000);
+  gdouble *close = g_new(gdouble, days + 1);
+  GRand *rand = g_rand_new_with_seed(g_str_hash(symbol));
+
+  close[0] = 1.0;
+  for (gint64 d = 1; d <= days; d++)
+    close[d] = close[d - 1] * (1.0 + 0.01 * normal_random(rand));
+
+  gdouble scale = walk_step(symbol).price / close[days];
+
+  GString *body = g_string_new("Date,Open,High,Low,Close,Adj Close,Volume\n");
+  for (gint64 d = 0; d <= days; d++) {
+    GDateTime *dt = g_date_time_new_from_unix_utc(start + d * 86400);
+    gchar *date = g_date_time_format(dt, "%Y-%m-%d");
+    gdouble c = close[d] * scale, o = (d ? close[d - 1] : close[d]) * scale;
+
+    g_string_append_printf(body, "%s,%.6f,%.6f,%.6f,%.6f,%.6f,%u\n", date, o,
+                           MAX(o, c) * 1.005, MIN(o, c) * 0.995, c, c,
+                           g_rand_int_range(rand, 100000, 10000000));
+    g_free(date);
+    g_date_time_unref(dt);
+  }
+
+  g_rand_free(rand);
+  g_free(close);
+  g_free(symbol);
+  return body;
+}
+
+static void build_symbol_lists()
+/* Half the symbols in each list, in the nasdaqtrader formats. */
+{
+  GDateTime *now = g_date_time_new_now_utc();
+  gchar *footer =
+      g_date_time_format(now, "File Creation Time: %m%d%Y%H:%M|||||||\n");
+  g_date_time_unref(now);
+
+  GString *nasdaq = g_string_new("Symbol|Security Name|Market Category|Test "
+                                 "Issue|Financial Status|Round Lot "
+                                 "Size|ETF|NextShares\n");
+  GString *other = g_string_new("ACT Symbol|Security Name|Exchange|CQS "
+                                "Symbol|ETF|Round Lot Size|Test Issue|NASDAQ "
+                                "Symbol\n");
+
+  for (gint i = 0; i < symbols; i++) {
+    if (i % 2)
+      g_string_append_printf(other,
+                             "OTHR%05d|Mock Other %d Common Stock|N|OTHR%05d|N|"
+                             "100|N|OTHR%05d\n",
+                             i, i, i, i);
+    else
+      g_string_append_printf(nasdaq,
+                             "MOCK%05d|Mock Security %d - Common Stock|Q|N|N|"
+                             "100|N|N\n",
+                             i, i);
+  }
+
+  g_string_append(nasdaq, footer);
+  g_string_append(other, footer);
+  g_free(footer);
+
+  nasdaq_list = g_string_free(nasdaq, FALSE);
+  other_list = g_string_free(other, FALSE);
+}
+
+static gboolean respond(GOutputStream *out, const gchar *target) {
+  /* Simulated network and server time. */
+  gdouble delay_ms = latency_ms + jitter_ms * g_random_double_range(-1.0, 1.0);
+  if (delay_ms > 0)
+    g_usleep((gulong)(delay_ms * 1000));
+
+  gint status = 200;
+  const gchar *reason = "OK", *type = "text/plain";
+  GString *body = NULL;
+
+  if (g_random_double() < error_rate) {
+    status = 429;
+    reason = "Too Many Requests";
+    type = "application/json";
+    body = g_string_new("{\"error\":\"API limit reached. Please try again "
+                        "later.\"}");
+  } else if (g_str_has_prefix(target, "/api/v1/quote")) {
+    type = "application/json";
+    body = quote_body(target);
+  } else if (g_str_has_prefix(target, "/v7/finance/download/")) {
+    type = "text/csv";
+    body = history_body(target);
+  } else if (g_str_has_suffix(target, "nasdaqlisted.txt")) {
+    body = g_string_new(nasdaq_list);
+  } else if (g_str_has_suffix(target, "otherlisted.txt")) {
+    body = g_string_new(other_list);
+  } else {
+    status = 404;
+    reason = "Not Found";
+    body = g_string_new("Not Found\n");
+  }
+
+  gchar *header = g_strdup_printf("HTTP/1.1 %d %s\r\n"
+                                  "Content-Type: %s\r\n"
+                                  "Content-Length: %zu\r\n"
+                                  "Connection: keep-alive\r\n\r\n",
+                                  status, reason, type, body->len);
+
+  gboolean ok =
+      g_output_stream_write_all(out, header, strlen(header), NULL, NULL,
+                                NULL) &&
+      g_output_stream_write_all(out, body->str, body->len, NULL, NULL, NULL);
+
+  g_free(header);
+  g_string_free(body, TRUE);
+  return ok;
+}
+
+static gboolean handle_connection(GThreadedSocketService *service,
+                                  GSocketConnection *connection,
+                                  GObject *source_object, gpointer user_data)
+/* Serve keep-alive HTTP/1.1 requests until the client disconnects. */
+{
+  UNUSED(service)
+  UNUSED(source_object)
+  UNUSED(user_data)
+
+  GInputStream *in = g_io_stream_get_input_stream(G_IO_STREAM(connection));
+  GOutputStream *out = g_io_stream_get_output_stream(G_IO_STREAM(connection));
+  GDataInputStream *data = g_data_input_stream_new(in);
+  g_data_input_stream_set_newline_type(data, G_DATA_STREAM_NEWLINE_TYPE_CR_LF);
+
+  gchar *request_line;
+  while ((request_line =
+              g_data_input_stream_read_line(data, NULL, NULL, NULL))) {
+    gboolean keep_alive = TRUE;
+    gchar *header;
+
+    /* Skip the headers, up to the blank line. */
+    while ((header = g_data_input_stream_read_line(data, NULL, NULL, NULL)) &&
+           header[0]) {
+      if (!g_ascii_strcasecmp(header, "Connection: close"))
+        keep_alive = FALSE;
+      g_free(header);
+    }
+
+    gchar **token_arr = g_strsplit(request_line, " ", 3);
+    gboolean ok = header && g_strv_length(token_arr) == 3 &&
+                  respond(out, token_arr[1]);
+
+    g_strfreev(token_arr);
+    g_free(header);
+    g_free(request_line);
+
+    if (!ok || !keep_alive)
+      break;
+  }
+
+  g_object_unref(data);
+  return TRUE;
+}
+
+gint main(gint argc, gchar *argv[]) {
+  GError *error = NULL;
+  GOptionContext *context =
+      g_option_context_new("- mock finnhub.io, Yahoo! and nasdaqtrader server");
+  g_option_context_add_main_entries(context, entries, NULL);
+  if (!g_option_context_parse(context, &argc, &argv, &error)) {
+    g_fprintf(stderr, "%s\n", error->message);
+    exit(EXIT_FAILURE);
+  }
+  g_option_context_free(context);
+
+  walk_table = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+  walk_rand = g_rand_new();
+  build_symbol_lists();
+
+  GSocketService *service = g_threaded_socket_service_new(threads);
+  GSocketAddress *address = g_inet_socket_address_new_from_string(
+      "127.0.0.1", (guint)port);
+  if (!g_socket_listener_add_address(G_SOCKET_LISTENER(service), address,
+                                     G_SOCKET_TYPE_STREAM,
+                                     G_SOCKET_PROTOCOL_TCP, NULL, NULL,
+                                     &error)) {
+    g_fprintf(stderr, "%s\n", error->message);
+    exit(EXIT_FAILURE);
+  }
+  g_object_unref(address);
+
+  g_signal_connect(service, "run", G_CALLBACK(handle_connection), NULL);
+  g_socket_service_start(service);
+
+  g_print("Mock server listening on http://127.0.0.1:%d\n", port);
+  GMainLoop *loop = g_main_loop_new(NULL, FALSE);
+  g_main_loop_run(loop);
+
+  return 0;
+}
@@ -0,0 +1,180 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "../include/quote_board.h"
+
+/* Quote board read latency, with the writer idle and with the writer
+   rewriting every record as fast as it can [the worst case, a real
+   publisher writes a few hundred records a minute].
+
+   Each read is timed on its own, the clock's own cost [the median of as
+   many empty timings] is subtracted, so the tail is the reads' and not
+   averaged away.
+
+   make quote_board_bench && ../build/quote_board_bench [SYMBOLS] */
+
+#define BENCH_READS 2000000u
+
+static atomic_int writer_running;
+static quote_board_header *board;
+static unsigned symbols;
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static void *writer_thd(void *arg) {
+  (void)arg;
+  quote_board_record *R = (quote_board_record *)(board + 1);
+  quote_board_record rec = {0};
+  uint64_t n = 0;
+
+  while (atomic_load(&writer_running)) {
+    unsigned s = (unsigned)(n % symbols);
+    snprintf(rec.symbol, sizeof(rec.symbol), "SYM%u", s);
+    rec.price = 100.0 + (double)(n % 1000) / 100.0;
+    rec.time_us = (int64_t)n + 1;
+    quote_board_record_write(&R[s], &rec);
+    n++;
+  }
+  return NULL;
+}
+
+static uint64_t sample_ns[BENCH_READS];
+static uint64_t clock_ns; /* The median cost of an empty timing. */
+
+static int cmp_u64(const void *a, const void *b) {
+  uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+  return (x > y) - (x < y);
+}
+
+static uint64_t percentile(double p)
+/* Of the sorted samples, less the clock's cost. */
+{
+  uint64_t ns = sample_ns[(size_t)(p * (BENCH_READS - 1))];
+  return ns > clock_ns ? ns - clock_ns : 0;
+}
+
+static void calibrate(void) {
+  for (unsigned i = 0; i < BENCH_READS; i++) {
+    uint64_t start = now_ns();
+    sample_ns[i] = now_ns() - start;
+  }
+  qsort(sample_ns, BENCH_READS, sizeof(sample_ns[0]), cmp_u64);
+  clock_ns = sample_ns[BENCH_READS / 2];
+}
+
+static void run(const quote_board *qb, const char *label) {
+  double sum = 0.0;
+  quote_board_record rec;
+
+  for (unsigned i = 0; i < BENCH_READS; i++) {
+    int slot = (int)(i % symbols);
+    uint64_t start = now_ns();
+    int ret = QuoteBoardRead(qb, slot, &rec);
+    sample_ns[i] = now_ns() - start;
+    if (ret == 0)
+      sum += rec.price;
+  }
+
+  qsort(sample_ns, BENCH_READS, sizeof(sample_ns[0]), cmp_u64);
+  printf("%-12s p50 %4" PRIu64 " ns  p99 %4" PRIu64 " ns  p99.9 %5" PRIu64
+         " ns  max %7" PRIu64 " ns  [checksum %.0f]\n",
+         label, percentile(0.50), percentile(0.99), percentile(0.999),
+         percentile(1.0), sum);
+}
+
+int main(int argc, char *argv[]) {
+  symbols = argc > 1 ? (unsigned)strtoul(argv[1], NULL, 10) : 100;
+  if (symbols == 0 || symbols > QUOTE_BOARD_SLOTS)
+    symbols = QUOTE_BOARD_SLOTS;
+
+  char path[] = "/tmp/quote_board_bench.XXXXXX";
+  int fd = mkstemp(path);
+  if (fd < 0 || ftruncate(fd, QUOTE_BOARD_SIZE) < 0) {
+    fprintf(stderr, "Cannot create '%s'.\n", path);
+    return EXIT_FAILURE;
+  }
+  board = mmap(NULL, QUOTE_BOARD_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+               0);
+  if (board == MAP_FAILED) {
+    fprintf(stderr, "Cannot map '%s'.\n", path);
+    return EXIT_FAILURE;
+  }
+  board->magic = QUOTE_BOARD_MAGIC;
+  board->version = QUOTE_BOARD_VERSION;
+  board->slots = QUOTE_BOARD_SLOTS;
+  atomic_store(&board->count, symbols);
+
+  /* Fill every record once, then read through the library's mapping. */
+  atomic_store(&writer_running, 1);
+  pthread_t writer;
+  pthread_create(&writer, NULL, writer_thd, NULL);
+  usleep(10000);
+  atomic_store(&writer_running, 0);
+  pthread_join(writer, NULL);
+
+  quote_board *qb = QuoteBoardOpen(path);
+  if (qb == NULL || QuoteBoardFind(qb, "SYM0") != 0) {
+    fprintf(stderr, "The reader library rejected '%s'.\n", path);
+    return EXIT_FAILURE;
+  }
+
+  calibrate();
+  printf("%u symbols, %u reads, latency per read [less %" PRIu64
+         " ns of clock]\n",
+         symbols, BENCH_READS, clock_ns);
+  run(qb, "writer idle");
+
+  atomic_store(&writer_running, 1);
+  pthread_create(&writer, NULL, writer_thd, NULL);
+  run(qb, "writer busy");
+  atomic_store(&writer_running, 0);
+  pthread_join(writer, NULL);
+
+  QuoteBoardClose(qb);
+  munmap(board, QUOTE_BOARD_SIZE);
+  close(fd);
+  unlink(path);
+  return EXIT_SUCCESS;
+}
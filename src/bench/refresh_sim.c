@@ -0,0 +1,244 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <glib/gprintf.h>
+#include <math.h>
+
+#include "../include/bench.h"
+#include "../include/class_types.h" /* portfolio_packet, metal, equity_folder */
+#include "../include/workfuncs.h"   /* RefreshPlan (), MarketDayAt () */
+
+/* The quotes follow a seeded random walk, a log return a second of up to
+   SIM_OPEN_VOL in an open session [scaled per quote, half to twice], up to
+   SIM_EXTENDED_VOL in the equity extended hours, none while closed. */
+#define SIM_OPEN_VOL 1e-4
+#define SIM_EXTENDED_VOL 3e-5
+#define SIM_DAY_SEC (24 * 3600)
+#define SIM_SEED 1
+
+typedef struct {
+  const gchar *name_ch;
+  refresh_state refresh;
+  gdouble price_f;
+  gdouble vol_f; /* The quote's volatility scale. */
+  guint fixed_calls;
+  guint adaptive_calls;
+  gint64 fixed_s;        /* The fixed schedule's last fetch. */
+  gint64 active_s;       /* Seconds its session was open or extended, */
+  gint64 fixed_age_s;    /* and the quote ages summed over them. */
+  gint64 adaptive_age_s;
+} sim_quote;
+
+static const gchar *session_name_arr[] = {"equity", "index", "futures",
+                                          "crypto"};
+
+static gint64 sim_day_start(const gchar *date_ch)
+/* NY midnight of date_ch [YYYY-MM-DD], or of today if NULL.  Returns 0 if
+   date_ch doesn't parse. */
+{
+  gint64 ref_s = g_get_real_time() / G_USEC_PER_SEC;
+  gint year, month, day;
+
+  if (date_ch) {
+    if (sscanf(date_ch, "%d-%d-%d", &year, &month, &day) != 3)
+      return 0;
+    /* Midday in New York. */
+    GDateTime *dt = g_date_time_new_utc(year, month, day, 17, 0, 0);
+    if (dt == NULL)
+      return 0;
+    ref_s = g_date_time_to_unix(dt);
+    g_date_time_unref(dt);
+  }
+  return ref_s - MarketDayAt(ref_s, NULL, NULL, NULL);
+}
+
+static void sim_quote_add(sim_quote *Q, guint *n, const gchar *name_ch,
+                          guint8 session, GRand *rand) {
+  sim_quote *S = &Q[(*n)++];
+
+  S->name_ch = name_ch;
+  RefreshStateInit(&S->refresh, session);
+  S->price_f = 100.0f;
+  S->vol_f = g_rand_double_range(rand, 0.5, 2.0);
+  S->fixed_calls = S->adaptive_calls = 0;
+  S->fixed_s = S->active_s = S->fixed_age_s = S->adaptive_age_s = 0;
+}
+
+static gdouble sim_step(sim_quote *S, GRand *rand)
+/* The quote's price a second on. */
+{
+  gdouble vol_f = 0.0f;
+
+  if (S->refresh.state == REFRESH_OPEN)
+    vol_f = SIM_OPEN_VOL * S->vol_f;
+  else if (S->refresh.state == REFRESH_EXTENDED)
+    vol_f = SIM_EXTENDED_VOL * S->vol_f;
+
+  /* Uniform with unit variance. */
+  S->price_f *= exp(vol_f * g_rand_double_range(rand, -sqrt(3), sqrt(3)));
+  return S->price_f;
+}
+
+static void print_change(guint64 fixed, guint64 adaptive)
+/* Ends a calls line with the adaptive refresh's change. */
+{
+  if (fixed == 0) {
+    g_print(" [the fixed schedule doesn't run].\n");
+    return;
+  }
+  gdouble saved_f = 100.0f * ((gdouble)fixed - (gdouble)adaptive) / fixed;
+  g_print(", %.1f%% %s.\n", fabs(saved_f), saved_f >= 0 ? "saved" : "added");
+}
+
+gint RefreshSimRun(portfolio_packet *pkg, const gchar *date_ch)
+/* Replay a day of the fetch session on a simulated clock [the market
+   calendar is the real one], and print the calls the fixed schedule [while
+   the NYSE is open] and the adaptive refresh [in the equities' regular and
+   extended hours] make for the portfolio's quotes, as their fetch sessions
+   do.
+
+   Returns 1 if date_ch doesn't parse, 0 otherwise. */
+{
+  metal *M = pkg->GetMetalClass();
+  equity_folder *F = pkg->GetEquityFolderClass();
+  gint64 start_s = sim_day_start(date_ch);
+
+  if (start_s == 0) {
+    g_fprintf(stderr, "Cannot simulate '%s', expected YYYY-MM-DD.\n",
+              date_ch);
+    return 1;
+  }
+
+  /* The fixed schedule's period, as the fetch session's. */
+  gdouble per_min_f = pkg->GetUpdatesPerMinute();
+  guint period_s = per_min_f > 0 ? (guint)(60.0f / per_min_f) : 1;
+  period_s = MAX(period_s, 1);
+
+  /* The quotes a fetch cycle requests. */
+  GRand *rand = g_rand_new_with_seed(SIM_SEED);
+  sim_quote *Q = g_new(sim_quote, 8 + F->size);
+  guint n = 0;
+  sim_quote_add(Q, &n, "^dji", REFRESH_INDEX, rand);
+  sim_quote_add(Q, &n, "^ixic", REFRESH_INDEX, rand);
+  sim_quote_add(Q, &n, "^gspc", REFRESH_INDEX, rand);
+  sim_quote_add(Q, &n, "btc-usd", REFRESH_CRYPTO, rand);
+  sim_quote_add(Q, &n, "GC=F", REFRESH_FUTURES, rand);
+  sim_quote_add(Q, &n, "SI=F", REFRESH_FUTURES, rand);
+  if (M->Platinum->ounce_f > 0)
+    sim_quote_add(Q, &n, "PL=F", REFRESH_FUTURES, rand);
+  if (M->Palladium->ounce_f > 0)
+    sim_quote_add(Q, &n, "PA=F", REFRESH_FUTURES, rand);
+  for (guint8 c = 0; c < F->size; c++)
+    sim_quote_add(Q, &n, F->Equity[c]->symbol_stock_ch, REFRESH_EQUITY,
+                  rand);
+
+  refresh_state **R = g_new(refresh_state *, n);
+  /* The fixed schedule's quotes are a day old off-hours, the age counts
+     from the simulated day's start. */
+  for (guint i = 0; i < n; i++) {
+    R[i] = &Q[i].refresh;
+    Q[i].fixed_s = start_s;
+  }
+
+  guint64 session_calls = 0; /* Adaptive, while the NYSE is open. */
+  for (gint64 t = start_s; t < start_s + SIM_DAY_SEC; t++) {
+    /* The fixed schedule's session ends at the NYSE close [IsClosed], the
+       adaptive one at the end of the equity extended hours.  The Dow's
+       session is the NYSE's. */
+    gboolean adaptive_bool = RefreshSessionOpen(t);
+    if (adaptive_bool)
+      RefreshPlan(R, n, period_s, t);
+    gboolean nyse_bool = adaptive_bool && Q[0].refresh.state == REFRESH_OPEN;
+    gboolean fixed_bool = nyse_bool && (t - start_s) % period_s == 0;
+
+    for (guint i = 0; i < n; i++) {
+      sim_quote *S = &Q[i];
+      gdouble price_f = sim_step(S, rand);
+
+      if (adaptive_bool && S->refresh.due_bool) {
+        RefreshObserve(&S->refresh, price_f, t);
+        S->adaptive_calls++;
+        session_calls += nyse_bool;
+      }
+      if (fixed_bool) {
+        S->fixed_s = t;
+        S->fixed_calls++;
+      }
+      if (adaptive_bool && S->refresh.state != REFRESH_CLOSED) {
+        S->active_s++;
+        S->fixed_age_s += t - S->fixed_s;
+        S->adaptive_age_s += t - S->refresh.fetch_s;
+      }
+    }
+  }
+
+  GDateTime *dt = g_date_time_new_from_unix_utc(start_s + SIM_DAY_SEC / 2);
+  gchar *day_ch = g_date_time_format(dt, "%Y-%m-%d");
+  g_date_time_unref(dt);
+
+  g_print("Refresh simulation: %s, %u quotes, one fetch each every %u s.\n"
+          "The age is a quote's mean age while its session and the "
+          "adaptive fetch session are open.\n\n"
+          "%-10s %-8s %8s %9s  %s\n",
+          day_ch, n, period_s, "Quote", "Session", "Fixed", "Adaptive",
+          "Age fixed / adaptive [s]");
+
+  guint64 fixed_total = 0, adaptive_total = 0;
+  for (guint i = 0; i < n; i++) {
+    sim_quote *S = &Q[i];
+    gint64 active_s = MAX(S->active_s, 1);
+
+    g_print("%-10s %-8s %8u %9u  %5.1f / %.1f\n", S->name_ch,
+            session_name_arr[S->refresh.session], S->fixed_calls,
+            S->adaptive_calls, (gdouble)S->fixed_age_s / active_s,
+            (gdouble)S->adaptive_age_s / active_s);
+    fixed_total += S->fixed_calls;
+    adaptive_total += S->adaptive_calls;
+  }
+
+  /* In the equities' extended hours the fixed schedule is stopped and the
+     adaptive refresh still polls, those calls are added. */
+  g_print("\nCalls while the NYSE is open: fixed %" G_GUINT64_FORMAT
+          ", adaptive %" G_GUINT64_FORMAT,
+          fixed_total, session_calls);
+  print_change(fixed_total, session_calls);
+  g_print("Calls all day: fixed %" G_GUINT64_FORMAT ", adaptive %"
+          G_GUINT64_FORMAT,
+          fixed_total, adaptive_total);
+  print_change(fixed_total, adaptive_total);
+
+  g_free(day_ch);
+  g_free(R);
+  g_free(Q);
+  g_rand_free(rand);
+  return 0;
+}
@@ -94,12 +94,11 @@ static void convert_bullion_to_strings(bullion *B, gchar *metal_ch,
 
 static void ToStrings(guint8 digits_right) {
   metal *M = MetalClassObject;
+  /* All four, every cycle; the strings live in the cycle's arena. */
   convert_bullion_to_strings(M->Gold, "Gold", digits_right);
   convert_bullion_to_strings(M->Silver, "Silver", digits_right);
-  if (M->Platinum->ounce_f > 0)
-    convert_bullion_to_strings(M->Platinum, "Platinum", digits_right);
-  if (M->Palladium->ounce_f > 0)
-    convert_bullion_to_strings(M->Palladium, "Palladium", digits_right);
+  convert_bullion_to_strings(M->Platinum, "Platinum", digits_right);
+  convert_bullion_to_strings(M->Palladium, "Palladium", digits_right);
 
   /* The total investment in bullion. */
   DoubleToFormattedStrPango(&M->bullion_port_value_mrkd_ch,
@@ -227,14 +226,17 @@ static gint SetUpCurl(portfolio_packet *pkg) {
   if (M->Palladium->ounce_f > 0)
     GetYahooUrl(&M->Palladium->url_ch, "PA=F", period);
 
-  SetUpCurlHandle(M->Silver->YAHOO_hnd, pkg->multicurl_main_hnd,
-                  M->Silver->url_ch, &M->Silver->CURLDATA);
-  SetUpCurlHandle(M->Gold->YAHOO_hnd, pkg->multicurl_main_hnd, M->Gold->url_ch,
-                  &M->Gold->CURLDATA);
-  if (M->Platinum->ounce_f > 0)
+  /* The adaptive refresh may skip a metal this cycle. */
+  if (M->Silver->refresh.due_bool)
+    SetUpCurlHandle(M->Silver->YAHOO_hnd, pkg->multicurl_main_hnd,
+                    M->Silver->url_ch, &M->Silver->CURLDATA);
+  if (M->Gold->refresh.due_bool)
+    SetUpCurlHandle(M->Gold->YAHOO_hnd, pkg->multicurl_main_hnd,
+                    M->Gold->url_ch, &M->Gold->CURLDATA);
+  if (M->Platinum->ounce_f > 0 && M->Platinum->refresh.due_bool)
     SetUpCurlHandle(M->Platinum->YAHOO_hnd, pkg->multicurl_main_hnd,
                     M->Platinum->url_ch, &M->Platinum->CURLDATA);
-  if (M->Palladium->ounce_f > 0)
+  if (M->Palladium->ounce_f > 0 && M->Palladium->refresh.due_bool)
     SetUpCurlHandle(M->Palladium->YAHOO_hnd, pkg->multicurl_main_hnd,
                     M->Palladium->url_ch, &M->Palladium->CURLDATA);
 
@@ -250,6 +252,10 @@ static void extract_bullion_data_reset(bullion *B) {
 }
 
 static void extract_bullion_data(bullion *B) {
+  /* Not fetched this cycle, the last quote stands. */
+  if (!B->refresh.due_bool)
+    return;
+
   if (B->CURLDATA.memory == NULL) {
     extract_bullion_data_reset(B);
     return;
@@ -334,6 +340,7 @@ static bullion *class_init_bullion() {
   new_class->YAHOO_hnd = curl_easy_init();
   new_class->CURLDATA.memory = NULL;
   new_class->CURLDATA.size = 0;
+  RefreshStateInit(&new_class->refresh, REFRESH_FUTURES);
 
   /* Return Our Initialized Class */
   return new_class;
@@ -383,30 +390,30 @@ metal *ClassInitMetal() {
 static void class_destruct_bullion(bullion *bullion_class) {
   /* Free Memory */
   if (bullion_class->metal_mrkd_ch)
-    g_free(bullion_class->metal_mrkd_ch);
+    StrArenaFree(bullion_class->metal_mrkd_ch);
   if (bullion_class->url_ch)
     g_free(bullion_class->url_ch);
   if (bullion_class->spot_price_mrkd_ch)
-    g_free(bullion_class->spot_price_mrkd_ch);
+    StrArenaFree(bullion_class->spot_price_mrkd_ch);
   if (bullion_class->premium_mrkd_ch)
-    g_free(bullion_class->premium_mrkd_ch);
+    StrArenaFree(bullion_class->premium_mrkd_ch);
   if (bullion_class->port_value_mrkd_ch)
-    g_free(bullion_class->port_value_mrkd_ch);
+    StrArenaFree(bullion_class->port_value_mrkd_ch);
 
   if (bullion_class->cost_mrkd_ch)
-    g_free(bullion_class->cost_mrkd_ch);
+    StrArenaFree(bullion_class->cost_mrkd_ch);
   if (bullion_class->range_mrkd_ch)
-    g_free(bullion_class->range_mrkd_ch);
+    StrArenaFree(bullion_class->range_mrkd_ch);
   if (bullion_class->prev_closing_metal_mrkd_ch)
-    g_free(bullion_class->prev_closing_metal_mrkd_ch);
+    StrArenaFree(bullion_class->prev_closing_metal_mrkd_ch);
   if (bullion_class->change_ounce_mrkd_ch)
-    g_free(bullion_class->change_ounce_mrkd_ch);
+    StrArenaFree(bullion_class->change_ounce_mrkd_ch);
   if (bullion_class->change_percent_raw_ch)
-    g_free(bullion_class->change_percent_raw_ch);
+    StrArenaFree(bullion_class->change_percent_raw_ch);
   if (bullion_class->total_cost_mrkd_ch)
-    g_free(bullion_class->total_cost_mrkd_ch);
+    StrArenaFree(bullion_class->total_cost_mrkd_ch);
   if (bullion_class->total_gain_mrkd_ch)
-    g_free(bullion_class->total_gain_mrkd_ch);
+    StrArenaFree(bullion_class->total_gain_mrkd_ch);
 
   if (bullion_class->YAHOO_hnd)
     curl_easy_cleanup(bullion_class->YAHOO_hnd);
@@ -433,15 +440,15 @@ void ClassDestructMetal(metal *metal_handle) {
 
   /* Free Pointer Memory */
   if (metal_handle->bullion_port_value_mrkd_ch)
-    g_free(metal_handle->bullion_port_value_mrkd_ch);
+    StrArenaFree(metal_handle->bullion_port_value_mrkd_ch);
   if (metal_handle->bullion_port_day_gain_mrkd_ch)
-    g_free(metal_handle->bullion_port_day_gain_mrkd_ch);
+    StrArenaFree(metal_handle->bullion_port_day_gain_mrkd_ch);
   if (metal_handle->gold_silver_ratio_ch)
-    g_free(metal_handle->gold_silver_ratio_ch);
+    StrArenaFree(metal_handle->gold_silver_ratio_ch);
   if (metal_handle->bullion_port_cost_mrkd_ch)
-    g_free(metal_handle->bullion_port_cost_mrkd_ch);
+    StrArenaFree(metal_handle->bullion_port_cost_mrkd_ch);
   if (metal_handle->bullion_port_total_gain_mrkd_ch)
-    g_free(metal_handle->bullion_port_total_gain_mrkd_ch);
+    StrArenaFree(metal_handle->bullion_port_total_gain_mrkd_ch);
 
   if (metal_handle)
     g_free(metal_handle);
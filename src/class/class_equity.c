@@ -55,30 +55,13 @@ static equity_folder
 
 /* Class Method (also called Function) Definitions */
 static void convert_equity_to_strings(stock *S, guint8 digits_right) {
-  /* Convert the double values into string values. */
-  DoubleToFormattedStrPango(&S->current_price_stock_mrkd_ch,
-                            S->current_price_stock_f, digits_right, MON_STR,
-                            BLACK);
-
-  DoubleToFormattedStrPango(&S->opening_stock_mrkd_ch, S->opening_stock_f,
-                            digits_right, MON_STR, GREY);
-
+  /* The default view cells. */
   if (S->cost_basis_f == 0)
     ClearStr(&S->cost_mrkd_ch);
   else
     DoubleToFormattedStrPango(&S->cost_mrkd_ch, S->cost_basis_f, digits_right,
                               MON_STR, GREY);
 
-  RangeStrPango(&S->range_mrkd_ch, S->low_stock_f, S->high_stock_f,
-                digits_right);
-
-  DoubleToFormattedStrPango(&S->prev_closing_stock_mrkd_ch,
-                            S->prev_closing_stock_f, digits_right, MON_STR,
-                            GREY);
-
-  ChangeStrPango(&S->change_share_stock_mrkd_ch, S->change_share_f,
-                 S->change_percent_f, digits_right);
-
   switch (S->quantity_int) {
   case 0:
 
@@ -92,6 +75,28 @@ static void convert_equity_to_strings(stock *S, guint8 digits_right) {
     break;
   }
 
+  /* The primary view formats the rest as the rows are drawn. */
+  if (NumericColumns())
+    return;
+
+  /* Convert the double values into string values. */
+  DoubleToFormattedStrPango(&S->current_price_stock_mrkd_ch,
+                            S->current_price_stock_f, digits_right, MON_STR,
+                            BLACK);
+
+  DoubleToFormattedStrPango(&S->opening_stock_mrkd_ch, S->opening_stock_f,
+                            digits_right, MON_STR, GREY);
+
+  RangeStrPango(&S->range_mrkd_ch, S->low_stock_f, S->high_stock_f,
+                digits_right);
+
+  DoubleToFormattedStrPango(&S->prev_closing_stock_mrkd_ch,
+                            S->prev_closing_stock_f, digits_right, MON_STR,
+                            GREY);
+
+  ChangeStrPango(&S->change_share_stock_mrkd_ch, S->change_share_f,
+                 S->change_percent_f, digits_right);
+
   /* The total current investment in this equity. */
   if (S->current_investment_stock_f == 0)
     ClearStr(&S->current_investment_stock_mrkd_ch);
@@ -115,11 +120,46 @@ static void convert_equity_to_strings(stock *S, guint8 digits_right) {
                    S->total_gain_percent_f, digits_right);
 }
 
+static void keep_equity_strings(stock *S)
+/* Carry the strings of a stock that wasn't fetched into this pass [the
+   fields convert_equity_to_strings writes]. */
+{
+  S->cost_mrkd_ch = StrArenaKeep(S->cost_mrkd_ch);
+  S->symbol_stock_mrkd_ch = StrArenaKeep(S->symbol_stock_mrkd_ch);
+  if (NumericColumns())
+    return;
+
+  S->current_price_stock_mrkd_ch = StrArenaKeep(S->current_price_stock_mrkd_ch);
+  S->opening_stock_mrkd_ch = StrArenaKeep(S->opening_stock_mrkd_ch);
+  S->range_mrkd_ch = StrArenaKeep(S->range_mrkd_ch);
+  S->prev_closing_stock_mrkd_ch = StrArenaKeep(S->prev_closing_stock_mrkd_ch);
+  S->change_share_stock_mrkd_ch = StrArenaKeep(S->change_share_stock_mrkd_ch);
+  S->current_investment_stock_mrkd_ch =
+      StrArenaKeep(S->current_investment_stock_mrkd_ch);
+  S->total_cost_mrkd_ch = StrArenaKeep(S->total_cost_mrkd_ch);
+  S->total_gain_mrkd_ch = StrArenaKeep(S->total_gain_mrkd_ch);
+}
+
 static void ToStrings(guint8 digits_right) {
   equity_folder *F = FolderClassObject;
 
-  for (guint8 g = 0; g < F->size; g++)
+  F->strings_pass++;
+  for (guint8 g = 0; g < F->size; g++) {
+    /* Already converted as its transfer completed. */
+    if (F->Equity[g]->streamed_bool)
+      continue;
+
+    /* Unchanged, not fetched this cycle. */
+    if (F->Equity[g]->held_bool) {
+      keep_equity_strings(F->Equity[g]);
+      continue;
+    }
+
+    gint64 start = TraceBegin();
     convert_equity_to_strings(F->Equity[g], digits_right);
+    F->Equity[g]->strings_pass = F->strings_pass;
+    TraceEnd("ToStrings symbol", F->Equity[g]->symbol_stock_ch, start);
+  }
 
   /* The total equity portfolio value. */
   DoubleToFormattedStrPango(&F->stock_port_value_mrkd_ch, F->stock_port_value_f,
@@ -173,7 +213,10 @@ static void Calculate() {
   F->stock_port_cost_f = 0.0f;
 
   for (guint8 g = 0; g < F->size; g++) {
-    equity_calculations(F->Equity[g]);
+    /* Already calculated as its transfer completed, or not fetched this
+       cycle. */
+    if (!F->Equity[g]->streamed_bool && !F->Equity[g]->held_bool)
+      equity_calculations(F->Equity[g]);
 
     /* Add the equity investment to the total equity value. */
     F->stock_port_value_f += F->Equity[g]->current_investment_stock_f;
@@ -203,7 +246,7 @@ static void Calculate() {
 }
 
 static void GenerateURL(portfolio_packet *pkg) {
-  g_mutex_lock(&mutexes[CLASS_MEMBER_MUTEX]);
+  MutexLock(&mutexes[CLASS_MEMBER_MUTEX]);
   equity_folder *F = pkg->GetEquityFolderClass();
   meta *Met = pkg->GetMetaClass();
 
@@ -224,6 +267,10 @@ static gint SetUpCurl(portfolio_packet *pkg) {
 
   /* Cycle through the list of equities. */
   for (guint8 c = 0; c < F->size; c++) {
+    /* The adaptive refresh may skip a stock this cycle. */
+    if (!F->Equity[c]->refresh.due_bool)
+      continue;
+
     /* Add a cURL easy handle to the multi-cURL handle
     (passing JSON output struct by reference) */
     SetUpCurlHandle(F->Equity[c]->easy_hnd, pkg->multicurl_main_hnd,
@@ -234,7 +281,7 @@ static gint SetUpCurl(portfolio_packet *pkg) {
 }
 
 static void Reset() {
-  g_mutex_lock(&mutexes[CLASS_MEMBER_MUTEX]);
+  MutexLock(&mutexes[CLASS_MEMBER_MUTEX]);
 
   equity_folder *F = FolderClassObject;
 
@@ -275,7 +322,7 @@ static void AddStock(const gchar *symbol, const gchar *shares,
 /* Adds a new stock object to our folder,
    increments size. */
 {
-  g_mutex_lock(&mutexes[CLASS_MEMBER_MUTEX]);
+  MutexLock(&mutexes[CLASS_MEMBER_MUTEX]);
   equity_folder *F = FolderClassObject;
   /* Does nothing if maximum number of stocks has been reached. */
   if (F->size == 255)
@@ -322,7 +369,7 @@ static void RemoveStock(const gchar *s)
    the size doesn't change.  Locate stock by the
    symbol string. */
 {
-  g_mutex_lock(&mutexes[CLASS_MEMBER_MUTEX]);
+  MutexLock(&mutexes[CLASS_MEMBER_MUTEX]);
 
   equity_folder *F = FolderClassObject;
   stock **tmp;
@@ -373,8 +420,15 @@ static void ExtractData() {
   for (guint8 c = 0; c < F->size; c++)
   /* Extract current price from JSON data for each Symbol. */
   {
+    /* Already extracted as its transfer completed, or not fetched this
+       cycle [the last quote stands, as it does with no response]. */
+    if (F->Equity[c]->streamed_bool || !F->Equity[c]->refresh.due_bool ||
+        F->Equity[c]->JSON.memory == NULL)
+      continue;
+
     /* Extract double values from JSON data using JSON-glib */
     if (transfer_complete) {
+      gint64 start = TraceBegin();
       /* If one transfer is incomplete, reject all further transfers. */
       transfer_complete = JsonExtractEquity(
           F->Equity[c]->JSON.memory, &F->Equity[c]->current_price_stock_f,
@@ -383,6 +437,7 @@ static void ExtractData() {
           &F->Equity[c]->change_share_f, &F->Equity[c]->change_percent_f);
 
       FreeMemtype(&F->Equity[c]->JSON);
+      TraceEnd("ExtractData symbol", F->Equity[c]->symbol_stock_ch, start);
     } else {
       extract_data_reset(F->Equity[c]);
       FreeMemtype(&F->Equity[c]->JSON);
@@ -390,6 +445,38 @@ static void ExtractData() {
   }
 }
 
+static const gchar *ExtractStock(CURL *hnd, guint8 digits_right)
+/* Extract, calculate, and convert the stock whose transfer on hnd just
+   completed, while the other transfers are still running.
+
+   Returns the stock symbol, NULL if hnd isn't a stock handle or its JSON is
+   incomplete [ExtractData handles it with the rest]. */
+{
+  equity_folder *F = FolderClassObject;
+  stock *S = NULL;
+
+  for (guint8 c = 0; c < F->size && S == NULL; c++)
+    if (F->Equity[c]->easy_hnd == hnd)
+      S = F->Equity[c];
+  if (S == NULL || S->JSON.memory == NULL)
+    return NULL;
+
+  gint64 start = TraceBegin();
+  if (!JsonExtractEquity(S->JSON.memory, &S->current_price_stock_f,
+                         &S->high_stock_f, &S->low_stock_f,
+                         &S->opening_stock_f, &S->prev_closing_stock_f,
+                         &S->change_share_f, &S->change_percent_f))
+    return NULL;
+
+  FreeMemtype(&S->JSON);
+  equity_calculations(S);
+  convert_equity_to_strings(S, digits_right);
+  S->streamed_bool = TRUE;
+  TraceEnd("Stream symbol", S->symbol_stock_ch, start);
+
+  return S->symbol_stock_ch;
+}
+
 static gint alpha_asc(gconstpointer a, gconstpointer b, gpointer data)
 /* This is a callback function for Glib sorting functions.
    It compares stock-structs in alphabetically ascending order,
@@ -407,7 +494,7 @@ static gint alpha_asc(gconstpointer a, gconstpointer b, gpointer data)
 }
 
 static void Sort() {
-  g_mutex_lock(&mutexes[CLASS_MEMBER_MUTEX]);
+  MutexLock(&mutexes[CLASS_MEMBER_MUTEX]);
 
   /* Sort the equity folder in alphabetically ascending order. */
   equity_folder *F = FolderClassObject;
@@ -431,7 +518,7 @@ static void remove_dash(gchar *s)
 }
 
 static void SetSecurityNames(portfolio_packet *pkg) {
-  g_mutex_lock(&mutexes[CLASS_MEMBER_MUTEX]);
+  MutexLock(&mutexes[CLASS_MEMBER_MUTEX]);
   equity_folder *F = pkg->GetEquityFolderClass();
   symbol_name_map *sn_map = pkg->GetSymNameMap();
   gchar *security_name = NULL;
@@ -504,6 +591,10 @@ static stock *class_init_equity() {
   new_class->easy_hnd = curl_easy_init();
   new_class->JSON.memory = NULL;
   new_class->JSON.size = 0;
+  new_class->streamed_bool = FALSE;
+  new_class->held_bool = FALSE;
+  new_class->strings_pass = 0;
+  RefreshStateInit(&new_class->refresh, REFRESH_EQUITY);
 
   /* Return Our Initialized Class */
   return new_class;
@@ -516,6 +607,7 @@ equity_folder *ClassInitEquityFolder() {
   /* A placeholder for our nested stock class array */
   new_class->Equity = NULL;
   new_class->size = 0;
+  new_class->strings_pass = 0;
 
   /* Initialize Variables */
   new_class->stock_port_value_mrkd_ch = NULL;
@@ -536,6 +628,7 @@ equity_folder *ClassInitEquityFolder() {
   new_class->GenerateURL = GenerateURL;
   new_class->SetUpCurl = SetUpCurl;
   new_class->ExtractData = ExtractData;
+  new_class->ExtractStock = ExtractStock;
   new_class->AddStock = AddStock;
   new_class->Reset = Reset;
   new_class->Sort = Sort;
@@ -553,44 +646,44 @@ equity_folder *ClassInitEquityFolder() {
 static void class_destruct_equity(stock *stock_class) {
   /* Free Memory */
   if (stock_class->current_price_stock_mrkd_ch) {
-    g_free(stock_class->current_price_stock_mrkd_ch);
+    StrArenaFree(stock_class->current_price_stock_mrkd_ch);
     stock_class->current_price_stock_mrkd_ch = NULL;
   }
   if (stock_class->cost_mrkd_ch) {
-    g_free(stock_class->cost_mrkd_ch);
+    StrArenaFree(stock_class->cost_mrkd_ch);
     stock_class->cost_mrkd_ch = NULL;
   }
   if (stock_class->range_mrkd_ch) {
-    g_free(stock_class->range_mrkd_ch);
+    StrArenaFree(stock_class->range_mrkd_ch);
     stock_class->range_mrkd_ch = NULL;
   }
   if (stock_class->opening_stock_mrkd_ch) {
-    g_free(stock_class->opening_stock_mrkd_ch);
+    StrArenaFree(stock_class->opening_stock_mrkd_ch);
     stock_class->opening_stock_mrkd_ch = NULL;
   }
   if (stock_class->prev_closing_stock_mrkd_ch) {
-    g_free(stock_class->prev_closing_stock_mrkd_ch);
+    StrArenaFree(stock_class->prev_closing_stock_mrkd_ch);
     stock_class->prev_closing_stock_mrkd_ch = NULL;
   }
   if (stock_class->change_share_stock_mrkd_ch) {
-    g_free(stock_class->change_share_stock_mrkd_ch);
+    StrArenaFree(stock_class->change_share_stock_mrkd_ch);
     stock_class->change_share_stock_mrkd_ch = NULL;
   }
   if (stock_class->current_investment_stock_mrkd_ch) {
-    g_free(stock_class->current_investment_stock_mrkd_ch);
+    StrArenaFree(stock_class->current_investment_stock_mrkd_ch);
     stock_class->current_investment_stock_mrkd_ch = NULL;
   }
   if (stock_class->total_cost_mrkd_ch) {
-    g_free(stock_class->total_cost_mrkd_ch);
+    StrArenaFree(stock_class->total_cost_mrkd_ch);
     stock_class->total_cost_mrkd_ch = NULL;
   }
   if (stock_class->total_gain_mrkd_ch) {
-    g_free(stock_class->total_gain_mrkd_ch);
+    StrArenaFree(stock_class->total_gain_mrkd_ch);
     stock_class->total_gain_mrkd_ch = NULL;
   }
 
   if (stock_class->symbol_stock_mrkd_ch) {
-    g_free(stock_class->symbol_stock_mrkd_ch);
+    StrArenaFree(stock_class->symbol_stock_mrkd_ch);
     stock_class->symbol_stock_mrkd_ch = NULL;
   }
 
@@ -634,14 +727,14 @@ void ClassDestructEquityFolder(equity_folder *F) {
 
   /* Free Pointer Memory */
   if (F->stock_port_value_mrkd_ch)
-    g_free(F->stock_port_value_mrkd_ch);
+    StrArenaFree(F->stock_port_value_mrkd_ch);
   if (F->stock_port_day_gain_mrkd_ch)
-    g_free(F->stock_port_day_gain_mrkd_ch);
+    StrArenaFree(F->stock_port_day_gain_mrkd_ch);
 
   if (F->stock_port_cost_mrkd_ch)
-    g_free(F->stock_port_cost_mrkd_ch);
+    StrArenaFree(F->stock_port_cost_mrkd_ch);
   if (F->stock_port_total_gain_mrkd_ch)
-    g_free(F->stock_port_total_gain_mrkd_ch);
+    StrArenaFree(F->stock_port_total_gain_mrkd_ch);
 
   if (F)
     g_free(F);
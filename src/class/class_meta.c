@@ -117,7 +117,7 @@ static void StopHistoryCurl() {
   meta *Met = MetaClassObject;
 
   curl_multi_wakeup(Met->multicurl_history_hnd);
-  g_mutex_lock(&mutexes[MULTICURL_NO_PROG_MUTEX]);
+  MutexLock(&mutexes[MULTICURL_NO_PROG_MUTEX]);
 
   curl_multi_remove_handle(Met->multicurl_history_hnd, Met->history_hnd);
 
@@ -128,7 +128,7 @@ static void StopSNMapCurl() {
   meta *Met = MetaClassObject;
 
   curl_multi_wakeup(Met->multicurl_cmpltn_hnd);
-  g_mutex_lock(&mutexes[MULTICURL_NO_PROG_MUTEX]);
+  MutexLock(&mutexes[MULTICURL_NO_PROG_MUTEX]);
 
   curl_multi_remove_handle(Met->multicurl_cmpltn_hnd,
                            Met->NASDAQ_completion_hnd);
@@ -151,14 +151,19 @@ static gint SetUpCurlIndicesData(portfolio_packet *pkg) {
   GetYahooUrl(&sp_url_ch, "^gspc", period);
   GetYahooUrl(&bitcoin_url_ch, "btc-usd", period);
 
-  SetUpCurlHandle(Met->index_dow_hnd, pkg->multicurl_main_hnd, dow_url_ch,
-                  &Met->INDEX_DOW_CURLDATA);
-  SetUpCurlHandle(Met->index_nasdaq_hnd, pkg->multicurl_main_hnd, nasdaq_url_ch,
-                  &Met->INDEX_NASDAQ_CURLDATA);
-  SetUpCurlHandle(Met->index_sp_hnd, pkg->multicurl_main_hnd, sp_url_ch,
-                  &Met->INDEX_SP_CURLDATA);
-  SetUpCurlHandle(Met->crypto_bitcoin_hnd, pkg->multicurl_main_hnd,
-                  bitcoin_url_ch, &Met->CRYPTO_BITCOIN_CURLDATA);
+  /* The adaptive refresh may skip an index this cycle. */
+  if (Met->index_dow_refresh.due_bool)
+    SetUpCurlHandle(Met->index_dow_hnd, pkg->multicurl_main_hnd, dow_url_ch,
+                    &Met->INDEX_DOW_CURLDATA);
+  if (Met->index_nasdaq_refresh.due_bool)
+    SetUpCurlHandle(Met->index_nasdaq_hnd, pkg->multicurl_main_hnd,
+                    nasdaq_url_ch, &Met->INDEX_NASDAQ_CURLDATA);
+  if (Met->index_sp_refresh.due_bool)
+    SetUpCurlHandle(Met->index_sp_hnd, pkg->multicurl_main_hnd, sp_url_ch,
+                    &Met->INDEX_SP_CURLDATA);
+  if (Met->crypto_bitcoin_refresh.due_bool)
+    SetUpCurlHandle(Met->crypto_bitcoin_hnd, pkg->multicurl_main_hnd,
+                    bitcoin_url_ch, &Met->CRYPTO_BITCOIN_CURLDATA);
 
   g_free(dow_url_ch);
   g_free(nasdaq_url_ch);
@@ -235,10 +240,15 @@ static void extract_index_data(const gchar *index, MemType *Data) {
 static void ExtractIndicesData() {
   meta *Met = MetaClassObject;
 
-  extract_index_data("dow", &Met->INDEX_DOW_CURLDATA);
-  extract_index_data("nasdaq", &Met->INDEX_NASDAQ_CURLDATA);
-  extract_index_data("sp", &Met->INDEX_SP_CURLDATA);
-  extract_index_data("bitcoin", &Met->CRYPTO_BITCOIN_CURLDATA);
+  /* An index not fetched this cycle keeps its last quote. */
+  if (Met->index_dow_refresh.due_bool)
+    extract_index_data("dow", &Met->INDEX_DOW_CURLDATA);
+  if (Met->index_nasdaq_refresh.due_bool)
+    extract_index_data("nasdaq", &Met->INDEX_NASDAQ_CURLDATA);
+  if (Met->index_sp_refresh.due_bool)
+    extract_index_data("sp", &Met->INDEX_SP_CURLDATA);
+  if (Met->crypto_bitcoin_refresh.due_bool)
+    extract_index_data("bitcoin", &Met->CRYPTO_BITCOIN_CURLDATA);
 }
 
 static void ToStringsIndices() {
@@ -374,6 +384,7 @@ meta *ClassInitMeta() {
 
   /* Initialize Variables */
   new_class->sym_map = NULL;
+  new_class->sym_index = NULL;
   new_class->rght_clk_data = (right_click_container){NULL};
 
   /* Initialize the main and rsi window size and locations to zero */
@@ -416,6 +427,10 @@ meta *ClassInitMeta() {
   new_class->config_dir_ch =
       g_strconcat(g_get_user_config_dir(), CONFIG_DIR, NULL);
 
+  /* Set The User's Cache Directory: ~/.cache/financials */
+  new_class->cache_dir_ch =
+      g_strconcat(g_get_user_cache_dir(), CONFIG_DIR, NULL);
+
   /* Append the sqlite db files to the end of the config directory path. */
   new_class->sqlite_db_path_ch =
       g_strconcat(new_class->config_dir_ch, DB_FILE, NULL);
@@ -443,6 +458,8 @@ meta *ClassInitMeta() {
   new_class->market_closed_bool =
       GetTimeData(NULL, NULL, NULL, NULL, NULL, NULL, NULL);
   new_class->exit_app_bool = FALSE;
+  new_class->headless_bool = FALSE;
+  new_class->row_func = NULL;
   new_class->multicurl_cancel_main_bool = FALSE;
   new_class->index_bar_revealed_bool = TRUE;
   new_class->clocks_displayed_bool = TRUE;
@@ -461,7 +478,11 @@ meta *ClassInitMeta() {
   new_class->multicurl_cmpltn_hnd = curl_multi_init();
   new_class->multicurl_history_hnd = curl_multi_init();
 
-  g_cond_init(&new_class->gthread_main_fetch_cond);
+  new_class->clocks_timer_id = 0;
+  new_class->main_fetch_timer_id = 0;
+  new_class->main_fetch_start = 0;
+  new_class->main_fetch_cycle_start = 0;
+  new_class->warmup_lead_s = 0;
 
   new_class->INDEX_DOW_CURLDATA.memory = NULL;
   new_class->INDEX_DOW_CURLDATA.size = 0;
@@ -472,6 +493,11 @@ meta *ClassInitMeta() {
   new_class->CRYPTO_BITCOIN_CURLDATA.memory = NULL;
   new_class->CRYPTO_BITCOIN_CURLDATA.size = 0;
 
+  RefreshStateInit(&new_class->index_dow_refresh, REFRESH_INDEX);
+  RefreshStateInit(&new_class->index_nasdaq_refresh, REFRESH_INDEX);
+  RefreshStateInit(&new_class->index_sp_refresh, REFRESH_INDEX);
+  RefreshStateInit(&new_class->crypto_bitcoin_refresh, REFRESH_CRYPTO);
+
   /* Connect Function Pointers To Function Definitions */
   new_class->ToStringsPortfolio = ToStringsPortfolio;
   new_class->CalculatePortfolio = CalculatePortfolio;
@@ -509,6 +535,10 @@ void ClassDestructMeta(meta *meta_class) {
     meta_class->sym_map = NULL;
   }
 
+  /* Release the trigram index. */
+  SNIndexUnref(meta_class->sym_index);
+  meta_class->sym_index = NULL;
+
   if (meta_class->stock_url_ch)
     g_free(meta_class->stock_url_ch);
   if (meta_class->curl_key_ch)
@@ -519,52 +549,54 @@ void ClassDestructMeta(meta *meta_class) {
     g_free(meta_class->NYSE_Symbol_url_ch);
 
   if (meta_class->cash_mrkd_ch)
-    g_free(meta_class->cash_mrkd_ch);
+    StrArenaFree(meta_class->cash_mrkd_ch);
   if (meta_class->cash_cost_mrkd_ch)
-    g_free(meta_class->cash_cost_mrkd_ch);
+    StrArenaFree(meta_class->cash_cost_mrkd_ch);
   if (meta_class->portfolio_value_mrkd_ch)
-    g_free(meta_class->portfolio_value_mrkd_ch);
+    StrArenaFree(meta_class->portfolio_value_mrkd_ch);
   if (meta_class->portfolio_day_gain_mrkd_ch)
-    g_free(meta_class->portfolio_day_gain_mrkd_ch);
+    StrArenaFree(meta_class->portfolio_day_gain_mrkd_ch);
 
   if (meta_class->portfolio_cost_mrkd_ch)
-    g_free(meta_class->portfolio_cost_mrkd_ch);
+    StrArenaFree(meta_class->portfolio_cost_mrkd_ch);
   if (meta_class->portfolio_total_gain_mrkd_ch)
-    g_free(meta_class->portfolio_total_gain_mrkd_ch);
+    StrArenaFree(meta_class->portfolio_total_gain_mrkd_ch);
 
   if (meta_class->index_dow_value_ch)
-    g_free(meta_class->index_dow_value_ch);
+    StrArenaFree(meta_class->index_dow_value_ch);
   if (meta_class->index_dow_value_chg_ch)
-    g_free(meta_class->index_dow_value_chg_ch);
+    StrArenaFree(meta_class->index_dow_value_chg_ch);
   if (meta_class->index_dow_value_p_chg_ch)
-    g_free(meta_class->index_dow_value_p_chg_ch);
+    StrArenaFree(meta_class->index_dow_value_p_chg_ch);
 
   if (meta_class->index_nasdaq_value_ch)
-    g_free(meta_class->index_nasdaq_value_ch);
+    StrArenaFree(meta_class->index_nasdaq_value_ch);
   if (meta_class->index_nasdaq_value_chg_ch)
-    g_free(meta_class->index_nasdaq_value_chg_ch);
+    StrArenaFree(meta_class->index_nasdaq_value_chg_ch);
   if (meta_class->index_nasdaq_value_p_chg_ch)
-    g_free(meta_class->index_nasdaq_value_p_chg_ch);
+    StrArenaFree(meta_class->index_nasdaq_value_p_chg_ch);
 
   if (meta_class->index_sp_value_ch)
-    g_free(meta_class->index_sp_value_ch);
+    StrArenaFree(meta_class->index_sp_value_ch);
   if (meta_class->index_sp_value_chg_ch)
-    g_free(meta_class->index_sp_value_chg_ch);
+    StrArenaFree(meta_class->index_sp_value_chg_ch);
   if (meta_class->index_sp_value_p_chg_ch)
-    g_free(meta_class->index_sp_value_p_chg_ch);
+    StrArenaFree(meta_class->index_sp_value_p_chg_ch);
 
   if (meta_class->crypto_bitcoin_value_ch)
-    g_free(meta_class->crypto_bitcoin_value_ch);
+    StrArenaFree(meta_class->crypto_bitcoin_value_ch);
   if (meta_class->crypto_bitcoin_value_chg_ch)
-    g_free(meta_class->crypto_bitcoin_value_chg_ch);
+    StrArenaFree(meta_class->crypto_bitcoin_value_chg_ch);
   if (meta_class->crypto_bitcoin_value_p_chg_ch)
-    g_free(meta_class->crypto_bitcoin_value_p_chg_ch);
+    StrArenaFree(meta_class->crypto_bitcoin_value_p_chg_ch);
 
   if (meta_class->font_ch)
     g_free(meta_class->font_ch);
 
   if (meta_class->config_dir_ch)
     g_free(meta_class->config_dir_ch);
+  if (meta_class->cache_dir_ch)
+    g_free(meta_class->cache_dir_ch);
   if (meta_class->sqlite_db_path_ch)
     g_free(meta_class->sqlite_db_path_ch);
   if (meta_class->sqlite_symbol_name_db_path_ch)
@@ -596,8 +628,6 @@ void ClassDestructMeta(meta *meta_class) {
   FreeMemtype(&meta_class->INDEX_SP_CURLDATA);
   FreeMemtype(&meta_class->CRYPTO_BITCOIN_CURLDATA);
 
-  g_cond_clear(&meta_class->gthread_main_fetch_cond);
-
   /* Free Memory From Class Object */
   if (meta_class) {
     g_free(meta_class);
@@ -33,9 +33,9 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "../include/class.h" /* The class init and destruct funcs are required 
                                        in the class methods, includes portfolio_packet 
                                        metal, meta, and equity_folder class types */
-#include "../include/gui.h"
 #include "../include/multicurl.h"
 #include "../include/mutex.h"
+#include "../include/quote_board.h"
 #include "../include/sqlite.h"
 #include "../include/workfuncs.h"
 
@@ -46,63 +46,285 @@ POSSIBILITY OF SUCH DAMAGE.
 
 portfolio_packet *packet;
 
+/* Four indices, four metals, and the equities. */
+#define PACKET_QUOTES_MAX (8 + G_MAXUINT8)
+
 /* Class Method (also called Function) Definitions */
-static gint perform_multicurl_request(portfolio_packet *pkg) {
+static void packet_symbol_free(gpointer data) {
+  packet_symbol *row = (packet_symbol *)data;
+  g_free(row->symbol);
+  g_free(row);
+}
+
+static void publish_stock(stock *S) {
+  QuoteBoardPublish(S->symbol_stock_ch, S->current_price_stock_f,
+                    S->change_share_f, S->change_percent_f,
+                    S->prev_closing_stock_f);
+}
+
+static void publish_bullion(const gchar *name, bullion *B) {
+  if (B->spot_price_f == 0)
+    return;
+  QuoteBoardPublish(name, B->spot_price_f,
+                    B->spot_price_f - B->prev_closing_metal_f,
+                    CalcGain(B->spot_price_f, B->prev_closing_metal_f),
+                    B->prev_closing_metal_f);
+}
+
+static void publish_index(const gchar *name, gdouble value, gdouble chg,
+                          gdouble p_chg) {
+  if (value == 0)
+    return;
+  QuoteBoardPublish(name, value, chg, p_chg, value - chg);
+}
+
+static void publish_quotes(portfolio_packet *pkg)
+/* Write the extracted quotes to the shared-memory quote board [if enabled],
+   a failed quote keeps its previous record. */
+{
+  meta *D = pkg->meta_class;
+  metal *M = pkg->metal_class;
+  equity_folder *F = pkg->equity_folder_class;
+
+  publish_index("dow", D->index_dow_value_f, D->index_dow_value_chg_f,
+                D->index_dow_value_p_chg_f);
+  publish_index("nasdaq", D->index_nasdaq_value_f, D->index_nasdaq_value_chg_f,
+                D->index_nasdaq_value_p_chg_f);
+  publish_index("sp500", D->index_sp_value_f, D->index_sp_value_chg_f,
+                D->index_sp_value_p_chg_f);
+  publish_index("bitcoin", D->crypto_bitcoin_value_f,
+                D->crypto_bitcoin_value_chg_f, D->crypto_bitcoin_value_p_chg_f);
+
+  publish_bullion("gold", M->Gold);
+  publish_bullion("silver", M->Silver);
+  publish_bullion("platinum", M->Platinum);
+  publish_bullion("palladium", M->Palladium);
+
+  for (guint8 c = 0; c < F->size; c++)
+    if (F->Equity[c]->current_price_stock_f != 0 &&
+        !F->Equity[c]->streamed_bool && F->Equity[c]->refresh.due_bool)
+      publish_stock(F->Equity[c]);
+}
+
+static void count_zero_quotes(portfolio_packet *pkg)
+/* Zero after extraction is a rate limit, an unknown symbol, or a failed
+   transfer. */
+{
+  meta *D = pkg->meta_class;
+  metal *M = pkg->metal_class;
+  equity_folder *F = pkg->equity_folder_class;
+  guint yahoo = 0, finnhub = 0;
+
+  yahoo += D->index_dow_value_f == 0;
+  yahoo += D->index_nasdaq_value_f == 0;
+  yahoo += D->index_sp_value_f == 0;
+  yahoo += D->crypto_bitcoin_value_f == 0;
+  yahoo += M->Gold->spot_price_f == 0;
+  yahoo += M->Silver->spot_price_f == 0;
+  yahoo += M->Platinum->ounce_f > 0 && M->Platinum->spot_price_f == 0;
+  yahoo += M->Palladium->ounce_f > 0 && M->Palladium->spot_price_f == 0;
+
+  for (guint8 c = 0; c < F->size; c++)
+    finnhub += F->Equity[c]->current_price_stock_f == 0;
+
+  MetricsZeroQuotes("yahoo", yahoo);
+  MetricsZeroQuotes("finnhub", finnhub);
+}
+
+static void quote_add(refresh_state **R, const gdouble **price, guint *n,
+                      refresh_state *state, const gdouble *value) {
+  R[*n] = state;
+  if (price)
+    price[*n] = value;
+  (*n)++;
+}
+
+static guint refresh_quotes(portfolio_packet *pkg, refresh_state **R,
+                            const gdouble **price)
+/* The quotes a fetch cycle requests, their refresh schedules and prices
+   [price may be NULL].  Returns the number of quotes. */
+{
+  meta *D = pkg->meta_class;
+  metal *M = pkg->metal_class;
+  equity_folder *F = pkg->equity_folder_class;
+  guint n = 0;
+
+  quote_add(R, price, &n, &D->index_dow_refresh, &D->index_dow_value_f);
+  quote_add(R, price, &n, &D->index_nasdaq_refresh, &D->index_nasdaq_value_f);
+  quote_add(R, price, &n, &D->index_sp_refresh, &D->index_sp_value_f);
+  quote_add(R, price, &n, &D->crypto_bitcoin_refresh,
+            &D->crypto_bitcoin_value_f);
+  quote_add(R, price, &n, &M->Gold->refresh, &M->Gold->spot_price_f);
+  quote_add(R, price, &n, &M->Silver->refresh, &M->Silver->spot_price_f);
+  if (M->Platinum->ounce_f > 0)
+    quote_add(R, price, &n, &M->Platinum->refresh,
+              &M->Platinum->spot_price_f);
+  if (M->Palladium->ounce_f > 0)
+    quote_add(R, price, &n, &M->Palladium->refresh,
+              &M->Palladium->spot_price_f);
+
+  for (guint8 c = 0; c < F->size; c++)
+    quote_add(R, price, &n, &F->Equity[c]->refresh,
+              &F->Equity[c]->current_price_stock_f);
+  return n;
+}
+
+static guint refresh_due(portfolio_packet *pkg)
+/* The number of quotes this cycle requests. */
+{
+  refresh_state *R[PACKET_QUOTES_MAX];
+  guint n = refresh_quotes(pkg, R, NULL), due = 0;
+
+  for (guint i = 0; i < n; i++)
+    due += R[i]->due_bool;
+  return due;
+}
+
+static void refresh_hold(portfolio_packet *pkg)
+/* Mark the stocks this cycle didn't fetch, before the plan is cleared. */
+{
+  equity_folder *F = pkg->equity_folder_class;
+
+  for (guint8 c = 0; c < F->size; c++)
+    F->Equity[c]->held_bool = !F->Equity[c]->refresh.due_bool;
+}
+
+static void refresh_finish(portfolio_packet *pkg, gboolean observe_bool)
+/* Record the fetched quotes for the adaptive refresh, then clear the plan
+   [a GetData outside the fetch session requests every quote]. */
+{
+  refresh_state *R[PACKET_QUOTES_MAX];
+  const gdouble *price[PACKET_QUOTES_MAX];
+  guint n = refresh_quotes(pkg, R, price);
+  gint64 now_s = g_get_real_time() / G_USEC_PER_SEC;
+
+  observe_bool = observe_bool && AdaptiveRefresh();
+  for (guint i = 0; i < n; i++) {
+    if (observe_bool && R[i]->due_bool)
+      RefreshObserve(R[i], *price[i], now_s);
+    R[i]->due_bool = TRUE;
+  }
+}
+
+static void stream_response(CURL *hnd, gpointer data)
+/* Extract, calculate, and convert a stock as soon as its quote arrives, then
+   update its main treeview row [the slower transfers are still running]. */
+{
+  portfolio_packet *pkg = (portfolio_packet *)data;
   equity_folder *F = pkg->GetEquityFolderClass();
+
+  MutexLock(&mutexes[CLASS_EXTRACT_DATA_MUTEX]);
+  MutexLock(&mutexes[CLASS_CALCULATE_MUTEX]);
+  MutexLock(&mutexes[CLASS_TOSTRINGS_MUTEX]);
+
+  StrArenaEnter();
+  const gchar *symbol =
+      F->ExtractStock(hnd, pkg->meta_class->decimal_places_guint8);
+  StrArenaLeave();
+  for (guint8 c = 0; symbol && c < F->size; c++)
+    if (F->Equity[c]->symbol_stock_ch == symbol)
+      publish_stock(F->Equity[c]);
+  GSourceFunc row_func = pkg->meta_class->row_func;
+  gchar *symbol_ch = symbol && row_func && !pkg->IsDefaultView()
+                         ? g_strdup(symbol)
+                         : NULL;
+
+  g_mutex_unlock(&mutexes[CLASS_TOSTRINGS_MUTEX]);
+  g_mutex_unlock(&mutexes[CLASS_CALCULATE_MUTEX]);
+  g_mutex_unlock(&mutexes[CLASS_EXTRACT_DATA_MUTEX]);
+
+  if (symbol_ch == NULL)
+    return;
+
+  packet_symbol *row = g_malloc(sizeof(*row));
+  row->pkg = pkg;
+  row->symbol = symbol_ch;
+  g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, row_func, row, packet_symbol_free);
+}
+
+static void stream_finish(portfolio_packet *pkg)
+/* The cycle's ToStrings is done [or the batch failed], the next pass
+   considers every stock.  A ToStrings during the fetch clears the flags
+   too, ExtractData skips those stocks by their freed JSON. */
+{
+  equity_folder *F = pkg->GetEquityFolderClass();
+
+  for (guint8 c = 0; c < F->size; c++)
+    F->Equity[c]->streamed_bool = F->Equity[c]->held_bool = FALSE;
+}
+
+static gint perform_multicurl_request(portfolio_packet *pkg) {
   gint return_code = 0;
-  gushort num_metals = 2;
-  if (pkg->metal_class->Platinum->ounce_f > 0)
-    num_metals++;
-  if (pkg->metal_class->Palladium->ounce_f > 0)
-    num_metals++;
 
   /* Perform the cURL requests simultaneously using multi-cURL. */
-  /* Four Indices plus Two-to-Four Metals plus Number of Equities */
-  return_code = PerformMultiCurl(pkg->multicurl_main_hnd,
-                                 4.0f + (double)num_metals + (double)F->size);
-  if (return_code)
+  /* Four Indices plus Two-to-Four Metals plus Number of Equities [those
+     due, with the adaptive refresh] */
+  /* The stocks are processed as their transfers complete [without GTK
+     there's no progress bar or treeview to update]. */
+  if (pkg->IsHeadless())
+    return_code = PerformMultiCurl_no_prog(pkg->multicurl_main_hnd);
+  else
+    return_code = PerformMultiCurlStream(
+        pkg->multicurl_main_hnd, (gdouble)refresh_due(pkg), stream_response,
+        pkg);
+  if (return_code) {
     pkg->FreeMainCurlData();
+    refresh_finish(pkg, FALSE);
+    stream_finish(pkg);
+  }
 
   return return_code;
 }
 
 static gint GetData() {
-  g_mutex_lock(&mutexes[CLASS_MEMBER_MUTEX]);
+  MutexLock(&mutexes[CLASS_MEMBER_MUTEX]);
   gint return_code = 0;
 
   /* We don't want to remove handles while setting up curl. */
-  g_mutex_lock(&mutexes[MULTICURL_REM_HAND_MUTEX]);
+  MutexLock(&mutexes[MULTICURL_REM_HAND_MUTEX]);
 
+  gint64 start = TraceBegin();
   packet->meta_class->SetUpCurlIndicesData(packet); /* Four Indices */
   packet->metal_class->SetUpCurl(packet);           /* Two to Four Metals */
   packet->equity_folder_class->SetUpCurl(packet);
+  TraceEnd("SetUpCurl", NULL, start);
 
   /* The user might want to remove handles during perform_multicurl_request().
    */
   g_mutex_unlock(&mutexes[MULTICURL_REM_HAND_MUTEX]);
 
+  start = TraceBegin();
   return_code = (gint)perform_multicurl_request(packet);
+  TraceEnd("PerformMultiCurl", NULL, start);
 
   g_mutex_unlock(&mutexes[CLASS_MEMBER_MUTEX]);
   return return_code;
 }
 
 static void ExtractData() {
-  g_mutex_lock(&mutexes[CLASS_EXTRACT_DATA_MUTEX]);
+  MutexLock(&mutexes[CLASS_EXTRACT_DATA_MUTEX]);
 
+  gint64 start = TraceBegin();
   packet->meta_class->ExtractIndicesData();
   packet->metal_class->ExtractData();
   packet->equity_folder_class->ExtractData();
+  publish_quotes(packet);
+  count_zero_quotes(packet);
+  refresh_hold(packet);
+  refresh_finish(packet, TRUE);
+  TraceEnd("ExtractData", NULL, start);
 
   g_mutex_unlock(&mutexes[CLASS_EXTRACT_DATA_MUTEX]);
 }
 
 static void Calculate() {
-  g_mutex_lock(&mutexes[CLASS_CALCULATE_MUTEX]);
+  MutexLock(&mutexes[CLASS_CALCULATE_MUTEX]);
 
+  gint64 start = TraceBegin();
   packet->equity_folder_class->Calculate();
   packet->metal_class->Calculate();
   packet->meta_class->CalculatePortfolio(packet);
+  TraceEnd("Calculate", NULL, start);
   /* No need to calculate the index data [the gain calculation is performed
    * during extraction] */
 
@@ -110,17 +332,40 @@ static void Calculate() {
 }
 
 static void ToStrings() {
-  g_mutex_lock(&mutexes[CLASS_TOSTRINGS_MUTEX]);
+  MutexLock(&mutexes[CLASS_TOSTRINGS_MUTEX]);
+  StrArenaEnter();
 
+  gint64 start = TraceBegin();
   packet->meta_class->ToStringsPortfolio();
   packet->meta_class->ToStringsIndices();
   packet->metal_class->ToStrings(packet->meta_class->decimal_places_guint8);
   packet->equity_folder_class->ToStrings(
       packet->meta_class->decimal_places_guint8);
+  stream_finish(packet);
+  TraceEnd("ToStrings", NULL, start);
 
+  /* The previous cycle's strings are released as a whole. */
+  StrArenaPublish();
+  StrArenaLeave();
   g_mutex_unlock(&mutexes[CLASS_TOSTRINGS_MUTEX]);
 }
 
+static guint PlanRefresh(guint period_s)
+/* Pick the quotes the next GetData requests [the adaptive refresh], the
+   fixed schedule fetches them all every period_s seconds.  Returns the
+   number picked, the rest keep their last quotes. */
+{
+  refresh_state *R[PACKET_QUOTES_MAX];
+
+  MutexLock(&mutexes[CLASS_MEMBER_MUTEX]);
+  guint n = refresh_quotes(packet, R, NULL);
+  guint due =
+      RefreshPlan(R, n, period_s, g_get_real_time() / G_USEC_PER_SEC);
+  g_mutex_unlock(&mutexes[CLASS_MEMBER_MUTEX]);
+
+  return due;
+}
+
 static gdouble GetHoursOfUpdates() {
   return packet->meta_class->updates_hours_f;
 }
@@ -130,7 +375,7 @@ static gdouble GetUpdatesPerMinute() {
 }
 
 static void FreeMainCurlData() {
-  g_mutex_lock(&mutexes[CLASS_EXTRACT_DATA_MUTEX]);
+  MutexLock(&mutexes[CLASS_EXTRACT_DATA_MUTEX]);
 
   equity_folder *F = packet->GetEquityFolderClass();
   metal *M = packet->GetMetalClass();
@@ -164,14 +409,14 @@ static void remove_main_curl_handles(portfolio_packet *pkg)
    statement.
   */
 {
-  g_mutex_lock(&mutexes[MULTICURL_REM_HAND_MUTEX]);
+  MutexLock(&mutexes[MULTICURL_REM_HAND_MUTEX]);
 
   metal *M = pkg->GetMetalClass();
   equity_folder *F = pkg->GetEquityFolderClass();
   meta *Met = pkg->GetMetaClass();
 
   curl_multi_wakeup(pkg->multicurl_main_hnd);
-  g_mutex_lock(&mutexes[MULTICURL_PROG_MUTEX]);
+  MutexLock(&mutexes[MULTICURL_PROG_MUTEX]);
 
   /* Equity Multicurl Operation */
   for (guint8 i = 0; i < F->size; i++)
@@ -304,6 +549,24 @@ static void SetExitingApp(gboolean exiting_bool)
   packet->meta_class->exit_app_bool = exiting_bool;
 }
 
+static gboolean IsHeadless()
+/* Running without GTK flag */
+{
+  return packet->meta_class->headless_bool;
+}
+
+static void SetHeadless(gboolean headless_bool)
+/* Running without GTK flag */
+{
+  packet->meta_class->headless_bool = headless_bool;
+}
+
+static void SetRowFunc(GSourceFunc row_func)
+/* The streamed row callback [the GUI's treeview row update] */
+{
+  packet->meta_class->row_func = row_func;
+}
+
 static gboolean IsSnmapDbBusy()
 /* Sn_map Db busy flag [currently writing the sn_map to Db] */
 {
@@ -372,16 +635,15 @@ static void save_sql_data_app(portfolio_packet *pkg) {
   else
     indc_displ_value = "FALSE";
 
+  /* The GUI sets the window states before saving. */
   const gchar *main_win_mxmzd_value;
-  if ((D->window_struct.main_win_maximized_bool =
-           gtk_window_is_maximized(GTK_WINDOW(GetGObject("MainWindow")))))
+  if (D->window_struct.main_win_maximized_bool)
     main_win_mxmzd_value = "TRUE";
   else
     main_win_mxmzd_value = "FALSE";
 
   const gchar *hstry_win_mxmzd_value;
-  if ((D->window_struct.histry_win_maximized_bool =
-           gtk_window_is_maximized(GTK_WINDOW(GetGObject("HistoryWindow")))))
+  if (D->window_struct.histry_win_maximized_bool)
     hstry_win_mxmzd_value = "TRUE";
   else
     hstry_win_mxmzd_value = "FALSE";
@@ -450,6 +712,10 @@ static void SaveSqlData() {
 
 /* Class Init Functions */
 void ClassInitPortfolioPacket() {
+  /* libcurl's global state, once for the process [it isn't thread-safe,
+     no other thread exists yet]. */
+  curl_global_init(CURL_GLOBAL_ALL);
+
   /* Allocate Memory For A New Class Object */
   portfolio_packet *new_class =
       (portfolio_packet *)g_malloc(sizeof(*new_class));
@@ -473,6 +739,9 @@ void ClassInitPortfolioPacket() {
   new_class->StopMultiCurlAll = StopMultiCurlAll;
   new_class->IsExitingApp = IsExitingApp;
   new_class->SetExitingApp = SetExitingApp;
+  new_class->IsHeadless = IsHeadless;
+  new_class->SetHeadless = SetHeadless;
+  new_class->SetRowFunc = SetRowFunc;
   new_class->IsMainCurlCanceled = IsMainCurlCanceled;
   new_class->SetMainCurlCanceled = SetMainCurlCanceled;
   new_class->GetHoursOfUpdates = GetHoursOfUpdates;
@@ -494,6 +763,7 @@ void ClassInitPortfolioPacket() {
   new_class->IsSnmapDbBusy = IsSnmapDbBusy;
   new_class->SetSnmapDbBusy = SetSnmapDbBusy;
   new_class->SetSecurityNames = SetSecurityNames;
+  new_class->PlanRefresh = PlanRefresh;
 
   /* General Multicurl Handle for the Main Fetch Operation */
   new_class->multicurl_main_hnd = curl_multi_init();
@@ -516,4 +786,7 @@ void ClassDestructPortfolioPacket(portfolio_packet *pkg) {
 
   /* Free Memory From Class Object */
   g_free(pkg);
+
+  /* No curl handle is left. */
+  curl_global_cleanup();
 }
\ No newline at end of file
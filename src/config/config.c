@@ -35,7 +35,9 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #include "../include/class_types.h" /* equity_folder, metal, meta, window_data */
 #include "../include/macros.h"
+#include "../include/multicurl.h"
 #include "../include/sqlite.h"
+#include "../include/workfuncs.h" /* TraceInit () */
 
 gint RemoveConfigFiles(meta *D) {
   /* Remove both sqlite db files and the ~/.config/financials directory, if
@@ -64,6 +66,15 @@ void ReadConfig(portfolio_packet *pkg) {
   /* Make sure the config directory exists. */
   config_dir_processing(D->config_dir_ch);
 
+  /* Set up the http response cache [creates the cache directory]. */
+  HttpCacheInit(D->cache_dir_ch);
+
+  /* The default pipeline trace export file, unless set on the command line.
+   */
+  gchar *trace_path = g_strconcat(D->cache_dir_ch, "/trace.json", NULL);
+  TraceInit(trace_path);
+  g_free(trace_path);
+
   /* Process the sqlite db file and populate initial varables. */
   SqliteProcessing(pkg);
 }
\ No newline at end of file
@@ -0,0 +1,130 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <glib.h>
+#include <glib/gprintf.h>
+
+#include "../include/class_types.h" /* portfolio_packet, equity_folder */
+#include "../include/daemon.h"
+
+/* One fetch cycle without the GUI, for cron jobs and monitoring scripts.
+   The CSV columns are the same for every row, a blank field doesn't apply
+   to that row's section. */
+
+static void csv_row(const gchar *section, const gchar *name, gchar *quantity,
+                    gdouble price, gdouble chg, gdouble p_chg, gdouble value,
+                    gdouble cost, gdouble gain, gdouble p_gain)
+/* Takes ownership of quantity, NULL for a blank field. */
+{
+  g_print("%s,%s,%s,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f\n", section, name,
+          quantity ? quantity : "", price, chg, p_chg, value, cost, gain,
+          p_gain);
+  g_free(quantity);
+}
+
+static void csv_index(const gchar *name, gdouble value, gdouble chg,
+                      gdouble p_chg) {
+  g_print("index,%s,,%.2f,%.2f,%.2f,,,,\n", name, value, chg, p_chg);
+}
+
+static void csv_bullion(const gchar *name, bullion *B) {
+  csv_row("bullion", name, g_strdup_printf("%.4f", B->ounce_f),
+          B->spot_price_f, B->change_ounce_f, B->change_percent_f,
+          B->port_value_f, B->total_cost_f, B->total_gain_value_f,
+          B->total_gain_percent_f);
+}
+
+static void print_csv(portfolio_packet *pkg) {
+  meta *D = pkg->GetMetaClass();
+  metal *M = pkg->GetMetalClass();
+  equity_folder *F = pkg->GetEquityFolderClass();
+
+  g_print("section,name,quantity,price,change,change_percent,value,cost,gain,"
+          "gain_percent\n");
+
+  g_print("portfolio,total,,,%.2f,%.2f,%.2f,%.2f,%.2f,%.2f\n",
+          D->portfolio_day_gain_value_f, D->portfolio_day_gain_percent_f,
+          D->portfolio_value_f, D->portfolio_cost_f,
+          D->portfolio_total_gain_value_f, D->portfolio_total_gain_percent_f);
+  g_print("portfolio,cash,,,,,%.2f,,,\n", D->cash_f);
+
+  csv_index("dow", D->index_dow_value_f, D->index_dow_value_chg_f,
+            D->index_dow_value_p_chg_f);
+  csv_index("nasdaq", D->index_nasdaq_value_f, D->index_nasdaq_value_chg_f,
+            D->index_nasdaq_value_p_chg_f);
+  csv_index("sp500", D->index_sp_value_f, D->index_sp_value_chg_f,
+            D->index_sp_value_p_chg_f);
+  csv_index("bitcoin", D->crypto_bitcoin_value_f,
+            D->crypto_bitcoin_value_chg_f, D->crypto_bitcoin_value_p_chg_f);
+
+  csv_bullion("gold", M->Gold);
+  csv_bullion("silver", M->Silver);
+  csv_bullion("platinum", M->Platinum);
+  csv_bullion("palladium", M->Palladium);
+
+  for (guint8 c = 0; c < F->size; c++) {
+    stock *S = F->Equity[c];
+    csv_row("equity", S->symbol_stock_ch,
+            g_strdup_printf("%u", S->quantity_int),
+            S->current_price_stock_f, S->change_share_f, S->change_percent_f,
+            S->current_investment_stock_f, S->total_cost_f,
+            S->total_gain_value_f, S->total_gain_percent_f);
+  }
+}
+
+gint BatchRun(portfolio_packet *pkg, const gchar *format_ch)
+/* Fetch, extract, and calculate once, print the result to stdout as "csv"
+   or "json".
+
+   Returns 0 on success, 1 if any transfer failed [the output is still
+   printed, failed quotes are zero], 2 on an unknown format. */
+{
+  if (g_strcmp0(format_ch, "csv") != 0 && g_strcmp0(format_ch, "json") != 0) {
+    g_fprintf(stderr, "Unknown format '%s', expected csv or json.\n",
+              format_ch);
+    return 2;
+  }
+
+  gint failed = pkg->GetData();
+  pkg->ExtractData();
+  pkg->Calculate();
+
+  if (g_strcmp0(format_ch, "json") == 0) {
+    gchar *json = DaemonSnapshotJson(pkg, failed);
+    g_print("%s\n", json);
+    g_free(json);
+  } else {
+    print_csv(pkg);
+  }
+
+  return failed ? 1 : 0;
+}
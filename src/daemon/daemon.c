@@ -0,0 +1,505 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gio/gio.h>
+#include <gio/gunixsocketaddress.h>
+#include <glib-unix.h> /* g_unix_signal_add () */
+#include <glib/gprintf.h>
+#include <glib/gstdio.h>
+#include <json-glib/json-glib.h>
+
+#include "../include/class_types.h" /* portfolio_packet, equity_folder */
+#include "../include/daemon.h"
+#include "../include/gui.h" /* HistoryFetchData () */
+#include "../include/macros.h"
+#include "../include/multicurl.h"
+#include "../include/mutex.h"
+#include "../include/workfuncs.h"
+
+/* Headless daemon mode.  One instance fetches the portfolio on its refresh
+   interval and serves HTTP/1.1 JSON over a Unix socket [and optionally a
+   localhost TCP port]:
+
+     GET /quotes              The latest snapshot: equities, bullion, indices,
+                              and the portfolio totals.
+     GET /history?symbol=SYM  The daily history [through the http cache].
+     GET /subscribe           A text/event-stream, one snapshot per refresh.
+
+   Clients share the daemon's API budget instead of each fetching. */
+
+/* Guarded by DAEMON_MUTEX. */
+static gchar *snapshot_json = NULL;
+static guint64 snapshot_gen = 0;
+static gboolean daemon_running = FALSE;
+static GCond snapshot_cond; /* A new snapshot or shutdown. */
+static GCond fetch_cond;    /* Shutdown. */
+
+static GMainLoop *daemon_loop = NULL;
+
+static void member_double(JsonBuilder *b, const gchar *name, gdouble v) {
+  json_builder_set_member_name(b, name);
+  json_builder_add_double_value(b, v);
+}
+
+static void add_index(JsonBuilder *b, const gchar *name, gdouble value,
+                      gdouble chg, gdouble p_chg) {
+  json_builder_begin_object(b);
+  json_builder_set_member_name(b, "name");
+  json_builder_add_string_value(b, name);
+  member_double(b, "value", value);
+  member_double(b, "change", chg);
+  member_double(b, "change_percent", p_chg);
+  json_builder_end_object(b);
+}
+
+static void add_bullion(JsonBuilder *b, const gchar *name, bullion *B) {
+  json_builder_begin_object(b);
+  json_builder_set_member_name(b, "metal");
+  json_builder_add_string_value(b, name);
+  member_double(b, "spot", B->spot_price_f);
+  member_double(b, "premium", B->premium_f);
+  member_double(b, "ounces", B->ounce_f);
+  member_double(b, "prev_close", B->prev_closing_metal_f);
+  member_double(b, "change_ounce", B->change_ounce_f);
+  member_double(b, "change_percent", B->change_percent_f);
+  member_double(b, "value", B->port_value_f);
+  member_double(b, "cost", B->total_cost_f);
+  member_double(b, "gain", B->total_gain_value_f);
+  member_double(b, "gain_percent", B->total_gain_percent_f);
+  json_builder_end_object(b);
+}
+
+static void add_stock(JsonBuilder *b, stock *S) {
+  json_builder_begin_object(b);
+  json_builder_set_member_name(b, "symbol");
+  json_builder_add_string_value(b, S->symbol_stock_ch);
+  json_builder_set_member_name(b, "shares");
+  json_builder_add_int_value(b, S->quantity_int);
+  member_double(b, "price", S->current_price_stock_f);
+  member_double(b, "open", S->opening_stock_f);
+  member_double(b, "high", S->high_stock_f);
+  member_double(b, "low", S->low_stock_f);
+  member_double(b, "prev_close", S->prev_closing_stock_f);
+  member_double(b, "change", S->change_share_f);
+  member_double(b, "change_percent", S->change_percent_f);
+  member_double(b, "value", S->current_investment_stock_f);
+  member_double(b, "cost", S->total_cost_f);
+  member_double(b, "gain", S->total_gain_value_f);
+  member_double(b, "gain_percent", S->total_gain_percent_f);
+  json_builder_end_object(b);
+}
+
+gchar *DaemonSnapshotJson(portfolio_packet *pkg, gint failed)
+/* Serialize the calculated portfolio on one line.  Must free return value.
+ */
+{
+  meta *D = pkg->GetMetaClass();
+  metal *M = pkg->GetMetalClass();
+  equity_folder *F = pkg->GetEquityFolderClass();
+  JsonBuilder *b = json_builder_new();
+
+  json_builder_begin_object(b);
+  json_builder_set_member_name(b, "time");
+  json_builder_add_int_value(b, g_get_real_time() / G_TIME_SPAN_SECOND);
+  json_builder_set_member_name(b, "failed_transfers");
+  json_builder_add_int_value(b, failed);
+
+  json_builder_set_member_name(b, "portfolio");
+  json_builder_begin_object(b);
+  member_double(b, "value", D->portfolio_value_f);
+  member_double(b, "day_gain", D->portfolio_day_gain_value_f);
+  member_double(b, "day_gain_percent", D->portfolio_day_gain_percent_f);
+  member_double(b, "cost", D->portfolio_cost_f);
+  member_double(b, "gain", D->portfolio_total_gain_value_f);
+  member_double(b, "gain_percent", D->portfolio_total_gain_percent_f);
+  member_double(b, "cash", D->cash_f);
+  member_double(b, "equity_value", F->stock_port_value_f);
+  member_double(b, "bullion_value", M->bullion_port_value_f);
+  json_builder_end_object(b);
+
+  json_builder_set_member_name(b, "indices");
+  json_builder_begin_array(b);
+  add_index(b, "dow", D->index_dow_value_f, D->index_dow_value_chg_f,
+            D->index_dow_value_p_chg_f);
+  add_index(b, "nasdaq", D->index_nasdaq_value_f, D->index_nasdaq_value_chg_f,
+            D->index_nasdaq_value_p_chg_f);
+  add_index(b, "sp500", D->index_sp_value_f, D->index_sp_value_chg_f,
+            D->index_sp_value_p_chg_f);
+  add_index(b, "bitcoin", D->crypto_bitcoin_value_f,
+            D->crypto_bitcoin_value_chg_f, D->crypto_bitcoin_value_p_chg_f);
+  json_builder_end_array(b);
+
+  json_builder_set_member_name(b, "bullion");
+  json_builder_begin_array(b);
+  add_bullion(b, "gold", M->Gold);
+  add_bullion(b, "silver", M->Silver);
+  add_bullion(b, "platinum", M->Platinum);
+  add_bullion(b, "palladium", M->Palladium);
+  json_builder_end_array(b);
+
+  json_builder_set_member_name(b, "equities");
+  json_builder_begin_array(b);
+  for (guint8 c = 0; c < F->size; c++)
+    add_stock(b, F->Equity[c]);
+  json_builder_end_array(b);
+  json_builder_end_object(b);
+
+  JsonGenerator *gen = json_generator_new();
+  JsonNode *root = json_builder_get_root(b);
+  json_generator_set_root(gen, root);
+  gchar *str = json_generator_to_data(gen, NULL);
+
+  json_node_free(root);
+  g_object_unref(gen);
+  g_object_unref(b);
+  return str;
+}
+
+static gpointer daemon_fetch_thd(gpointer pkg_data)
+/* Fetch, extract, and calculate on the configured refresh interval, publish
+   each result to the clients. */
+{
+  portfolio_packet *pkg = (portfolio_packet *)pkg_data;
+  gboolean running = TRUE;
+
+  while (running) {
+    gint64 start = g_get_monotonic_time();
+    gdouble per_min = pkg->GetUpdatesPerMinute();
+    gint64 interval =
+        (gint64)(60.0 / (per_min > 0.0 ? per_min : 1.0) * G_TIME_SPAN_SECOND);
+
+    gint failed = pkg->GetData();
+    pkg->ExtractData();
+    pkg->Calculate();
+    MetricsFetchCycle(g_get_monotonic_time() - start, failed != 0);
+    gchar *json = DaemonSnapshotJson(pkg, failed);
+
+    MutexLock(&mutexes[DAEMON_MUTEX]);
+    g_free(snapshot_json);
+    snapshot_json = json;
+    snapshot_gen++;
+    g_cond_broadcast(&snapshot_cond);
+
+    /* Sleep until the next refresh, unless shutting down. */
+    while (daemon_running &&
+           g_cond_wait_until(&fetch_cond, &mutexes[DAEMON_MUTEX],
+                             start + interval))
+      ;
+    running = daemon_running;
+    g_mutex_unlock(&mutexes[DAEMON_MUTEX]);
+  }
+
+  return NULL;
+}
+
+static gchar *history_json(portfolio_packet *pkg, const gchar *symbol)
+/* The daily history CSV as a JSON array, NULL if the fetch failed.  Must
+   free return value. */
+{
+  MutexLock(&mutexes[HISTORY_FETCH_MUTEX]);
+  MemType *csv = HistoryFetchData(symbol, pkg);
+  g_mutex_unlock(&mutexes[HISTORY_FETCH_MUTEX]);
+  if (csv == NULL)
+    return NULL;
+
+  /* Date,Open,High,Low,Close,Adj Close,Volume */
+  static const gchar *name_arr[] = {"open", "high", "low", "close",
+                                    "adj_close"};
+  JsonBuilder *b = json_builder_new();
+  gchar **line_arr = g_strsplit(csv->memory ? csv->memory : "", "\n", -1);
+
+  json_builder_begin_array(b);
+  for (guint l = 1; line_arr[0] && line_arr[l]; l++) {
+    gchar **field_arr = g_strsplit(line_arr[l], ",", -1);
+    if (g_strv_length(field_arr) >= 7) {
+      json_builder_begin_object(b);
+      json_builder_set_member_name(b, "date");
+      json_builder_add_string_value(b, field_arr[0]);
+      for (guint f = 0; f < G_N_ELEMENTS(name_arr); f++)
+        member_double(b, name_arr[f], g_ascii_strtod(field_arr[f + 1], NULL));
+      json_builder_set_member_name(b, "volume");
+      json_builder_add_int_value(b, g_ascii_strtoll(field_arr[6], NULL, 10));
+      json_builder_end_object(b);
+    }
+    g_strfreev(field_arr);
+  }
+  json_builder_end_array(b);
+  g_strfreev(line_arr);
+  FreeMemtype(csv);
+  g_free(csv);
+
+  JsonGenerator *gen = json_generator_new();
+  JsonNode *root = json_builder_get_root(b);
+  json_generator_set_root(gen, root);
+  gchar *str = json_generator_to_data(gen, NULL);
+
+  json_node_free(root);
+  g_object_unref(gen);
+  g_object_unref(b);
+  return str;
+}
+
+static gchar *query_symbol(const gchar *path)
+/* The uppercase symbol query parameter, NULL if missing or invalid.  Must
+   free return value. */
+{
+  const gchar *q = strstr(path, "symbol=");
+  if (q == NULL)
+    return NULL;
+  q += strlen("symbol=");
+
+  gchar *raw = g_strndup(q, strcspn(q, "&"));
+  gchar *symbol = g_uri_unescape_string(raw, NULL);
+  g_free(raw);
+  if (symbol == NULL || symbol[0] == 0 || strlen(symbol) > 16) {
+    g_free(symbol);
+    return NULL;
+  }
+
+  for (gchar *c = symbol; *c; c++) {
+    if (!g_ascii_isalnum(*c) && !strchr(".-^=", *c)) {
+      g_free(symbol);
+      return NULL;
+    }
+    *c = g_ascii_toupper(*c);
+  }
+  return symbol;
+}
+
+static gboolean send_response(GOutputStream *out, const gchar *status,
+                              const gchar *body) {
+  gchar *head = g_strdup_printf("HTTP/1.1 %s\r\n"
+                                "Content-Type: application/json\r\n"
+                                "Content-Length: %" G_GSIZE_FORMAT "\r\n"
+                                "Connection: close\r\n\r\n",
+                                status, strlen(body));
+  gboolean ok =
+      g_output_stream_write_all(out, head, strlen(head), NULL, NULL, NULL) &&
+      g_output_stream_write_all(out, body, strlen(body), NULL, NULL, NULL);
+  g_free(head);
+  return ok;
+}
+
+static void send_events(GOutputStream *out)
+/* Push every new snapshot until the client goes away or the daemon stops,
+   a comment line every 15 seconds keeps idle proxies open. */
+{
+  static const gchar *head = "HTTP/1.1 200 OK\r\n"
+                             "Content-Type: text/event-stream\r\n"
+                             "Cache-Control: no-cache\r\n"
+                             "Connection: keep-alive\r\n\r\n";
+  if (!g_output_stream_write_all(out, head, strlen(head), NULL, NULL, NULL))
+    return;
+
+  guint64 seen = 0;
+  gboolean ok = TRUE;
+  while (ok) {
+    gchar *event = NULL;
+
+    MutexLock(&mutexes[DAEMON_MUTEX]);
+    gint64 deadline = g_get_monotonic_time() + 15 * G_TIME_SPAN_SECOND;
+    while (daemon_running && snapshot_gen == seen &&
+           g_cond_wait_until(&snapshot_cond, &mutexes[DAEMON_MUTEX], deadline))
+      ;
+    if (!daemon_running) {
+      g_mutex_unlock(&mutexes[DAEMON_MUTEX]);
+      break;
+    }
+    if (snapshot_gen != seen && snapshot_json) {
+      event = g_strconcat("data: ", snapshot_json, "\n\n", NULL);
+      seen = snapshot_gen;
+    }
+    g_mutex_unlock(&mutexes[DAEMON_MUTEX]);
+
+    if (event == NULL)
+      event = g_strdup(": keepalive\n\n");
+    ok = g_output_stream_write_all(out, event, strlen(event), NULL, NULL,
+                                   NULL) &&
+         g_output_stream_flush(out, NULL, NULL);
+    g_free(event);
+  }
+}
+
+static gboolean daemon_connection(GThreadedSocketService *service,
+                                  GSocketConnection *connection,
+                                  GObject *source_object, gpointer pkg_data)
+/* Serve one request [runs in a service thread]. */
+{
+  UNUSED(service)
+  UNUSED(source_object)
+  portfolio_packet *pkg = (portfolio_packet *)pkg_data;
+  GInputStream *in = g_io_stream_get_input_stream(G_IO_STREAM(connection));
+  GOutputStream *out = g_io_stream_get_output_stream(G_IO_STREAM(connection));
+  GDataInputStream *data_in = g_data_input_stream_new(in);
+  g_data_input_stream_set_newline_type(data_in,
+                                       G_DATA_STREAM_NEWLINE_TYPE_ANY);
+
+  gchar *request = g_data_input_stream_read_line(data_in, NULL, NULL, NULL);
+  gchar *line = NULL;
+  /* Skip the headers. */
+  while ((line = g_data_input_stream_read_line(data_in, NULL, NULL, NULL)) &&
+         line[0]) {
+    g_free(line);
+  }
+  g_free(line);
+
+  gchar **part_arr = request ? g_strsplit(request, " ", 3) : NULL;
+  const gchar *path = part_arr && part_arr[0] && part_arr[1] ? part_arr[1] : "";
+
+  if (part_arr == NULL || g_strcmp0(part_arr[0], "GET") != 0) {
+    send_response(out, "405 Method Not Allowed",
+                  "{\"error\":\"only GET is supported\"}");
+  } else if (g_str_has_prefix(path, "/subscribe")) {
+    send_events(out);
+  } else if (g_str_has_prefix(path, "/history")) {
+    gchar *symbol = query_symbol(path);
+    gchar *body = symbol ? history_json(pkg, symbol) : NULL;
+    if (symbol == NULL)
+      send_response(out, "400 Bad Request",
+                    "{\"error\":\"missing or invalid symbol\"}");
+    else if (body == NULL)
+      send_response(out, "502 Bad Gateway",
+                    "{\"error\":\"history fetch failed\"}");
+    else
+      send_response(out, "200 OK", body);
+    g_free(symbol);
+    g_free(body);
+  } else if (g_strcmp0(path, "/") == 0 || g_str_has_prefix(path, "/quotes")) {
+    MutexLock(&mutexes[DAEMON_MUTEX]);
+    gchar *body = g_strdup(snapshot_json);
+    g_mutex_unlock(&mutexes[DAEMON_MUTEX]);
+    if (body)
+      send_response(out, "200 OK", body);
+    else
+      send_response(out, "503 Service Unavailable",
+                    "{\"error\":\"the first fetch is in progress\"}");
+    g_free(body);
+  } else {
+    send_response(out, "404 Not Found", "{\"error\":\"not found\"}");
+  }
+
+  g_strfreev(part_arr);
+  g_free(request);
+  g_object_unref(data_in);
+  return TRUE;
+}
+
+static gboolean daemon_quit(gpointer data) {
+  UNUSED(data)
+  g_main_loop_quit(daemon_loop);
+  return G_SOURCE_REMOVE;
+}
+
+static gchar *socket_path(portfolio_packet *pkg) {
+  const gchar *dir = g_getenv("XDG_RUNTIME_DIR");
+  if (dir == NULL || dir[0] == 0)
+    dir = pkg->meta_class->config_dir_ch;
+  return g_build_filename(dir, DAEMON_SOCKET_NAME, NULL);
+}
+
+gint DaemonRun(portfolio_packet *pkg, guint16 port)
+/* Serve the portfolio until SIGINT or SIGTERM.  A non-zero port also
+   listens on 127.0.0.1.
+
+   Returns 0 on a clean shutdown, 1 if a socket can't be opened. */
+{
+  GError *error = NULL;
+  gchar *path = socket_path(pkg);
+  GSocketService *service =
+      g_threaded_socket_service_new(DAEMON_MAX_CLIENTS);
+
+  /* A stale socket from an unclean exit. */
+  g_unlink(path);
+  GSocketAddress *address = g_unix_socket_address_new(path);
+  gboolean ok = g_socket_listener_add_address(
+      G_SOCKET_LISTENER(service), address, G_SOCKET_TYPE_STREAM,
+      G_SOCKET_PROTOCOL_DEFAULT, NULL, NULL, &error);
+  g_object_unref(address);
+
+  if (ok && port) {
+    address = g_inet_socket_address_new_from_string("127.0.0.1", port);
+    ok = g_socket_listener_add_address(
+        G_SOCKET_LISTENER(service), address, G_SOCKET_TYPE_STREAM,
+        G_SOCKET_PROTOCOL_DEFAULT, NULL, NULL, &error);
+    g_object_unref(address);
+  }
+
+  if (!ok) {
+    g_fprintf(stderr, "Cannot listen: %s\n", error->message);
+    g_error_free(error);
+    g_object_unref(service);
+    g_free(path);
+    return 1;
+  }
+  g_chmod(path, 0600);
+
+  g_signal_connect(service, "run", G_CALLBACK(daemon_connection), pkg);
+  g_print("Serving on '%s'", path);
+  if (port)
+    g_print(" and http://127.0.0.1:%u", port);
+  g_print(".\n");
+
+  /* Before the first fetch records a cycle. */
+  MetricsInit();
+
+  daemon_running = TRUE;
+  GThread *fetch_thread = g_thread_new("daemon-fetch", daemon_fetch_thd, pkg);
+
+  daemon_loop = g_main_loop_new(NULL, FALSE);
+  g_unix_signal_add(SIGINT, daemon_quit, NULL);
+  g_unix_signal_add(SIGTERM, daemon_quit, NULL);
+  g_socket_service_start(service);
+  g_main_loop_run(daemon_loop);
+
+  /* Wake the fetch thread and the subscribers. */
+  g_socket_service_stop(service);
+  MutexLock(&mutexes[DAEMON_MUTEX]);
+  daemon_running = FALSE;
+  g_cond_broadcast(&fetch_cond);
+  g_cond_broadcast(&snapshot_cond);
+  g_mutex_unlock(&mutexes[DAEMON_MUTEX]);
+
+  pkg->StopMultiCurlAll();
+  g_thread_join(fetch_thread);
+
+  g_socket_listener_close(G_SOCKET_LISTENER(service));
+  g_object_unref(service);
+  MetricsDestruct();
+  g_main_loop_unref(daemon_loop);
+  daemon_loop = NULL;
+
+  g_unlink(path);
+  g_free(path);
+  g_free(snapshot_json);
+  snapshot_json = NULL;
+  return 0;
+}
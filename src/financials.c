@@ -68,20 +68,166 @@ static void class_package_destruct()
   ClassDestructPortfolioPacket(packet);
 }
 
-static void simple_arg_parse(gchar **argv, portfolio_packet *pkg) {
-  if (!g_strcmp0("-h", argv[1]) || !g_strcmp0("--help", argv[1])) {
+static gboolean http_cache_expire(gpointer data)
+/* The response cache expiry, on the timer wheel. */
+{
+  UNUSED(data)
+  HttpCacheExpire();
+  return TRUE;
+}
+
+static gboolean simple_arg_parse(gchar **argv, portfolio_packet *pkg)
+/* Returns TRUE if the GUI should run, the other flags exit. */
+{
+  if (!g_strcmp0("-t", argv[1]) || !g_strcmp0("--trace", argv[1])) {
+
+    if (argv[2] == NULL) {
+      g_printerr("Usage: %s --trace FILE\n", argv[0]);
+      class_package_destruct();
+      exit(EXIT_FAILURE);
+    }
+
+    /* Run as usual, write the pipeline trace on exit. */
+    TraceInit(argv[2]);
+    return TRUE;
+
+  } else if (!g_strcmp0("-h", argv[1]) || !g_strcmp0("--help", argv[1])) {
 
     g_print("Help Message\n"
             "---------------\n"
             "-h --help\tPrint this help message.\n"
             "-v --version\tDisplay the version.\n"
-            "-r --reset\tRemove %s database files.\n\n",
-            argv[0]);
+            "-r --reset\tRemove %s database files.\n"
+            "-t --trace FILE\tRun, write a Chrome trace of the refresh\n"
+            "\t\tpipeline to FILE on exit.\n"
+            "-l --load [N] [URL] [CYCLES]\n"
+            "\t\tFetch N mock quotes a second from URL [default %s],\n"
+            "\t\treport the cycle latency percentiles.\n"
+            "-d --daemon [PORT]\n"
+            "\t\tRun without a window, serve the quotes, totals, and\n"
+            "\t\thistory as JSON over a Unix socket [and 127.0.0.1:PORT].\n"
+            "-o --once [--format csv|json]\n"
+            "\t\tFetch once without a window, print the portfolio,\n"
+            "\t\tbullion, and index values [default csv].\n"
+            "-s --simulate [YYYY-MM-DD]\n"
+            "\t\tReplay a day [default today] of the fetch session on a\n"
+            "\t\tsimulated clock, print the fixed schedule's and the\n"
+            "\t\tadaptive refresh's calls.\n\n"
+            "Environment\n"
+            "FINANCIALS_METRICS_PORT\tServe Prometheus metrics on\n"
+            "\t\t127.0.0.1:PORT/metrics.\n"
+            "FINANCIALS_QUOTE_BOARD\tPublish quotes to the shared-memory\n"
+            "\t\tquote board in $XDG_RUNTIME_DIR.\n"
+            "FINANCIALS_NUMERIC_COLUMNS\n"
+            "\t\tKeep the equity rows as numbers, format the visible\n"
+            "\t\tcells as they are drawn.\n"
+            "FINANCIALS_ADAPTIVE_REFRESH\n"
+            "\t\tRefresh each quote by its session and volatility,\n"
+            "\t\tat most at the fixed schedule's rate [through the\n"
+            "\t\tequities' extended hours].\n"
+            "FINANCIALS_WARMUP_SEC\tConnect to the quote hosts and prefetch\n"
+            "\t\tthe previous closes this many seconds [up to %d]\n"
+            "\t\tbefore the open.\n\n",
+            argv[0], LOAD_GEN_URL, WARMUP_MAX_SEC);
 
   } else if (!g_strcmp0("-v", argv[1]) || !g_strcmp0("--version", argv[1])) {
 
     g_print(VERSION_STRING "\n");
 
+  } else if (!g_strcmp0("-l", argv[1]) || !g_strcmp0("--load", argv[1])) {
+
+    /* argv is NULL terminated, the optional args are checked in order. */
+    guint symbols = argv[2] ? (guint)g_ascii_strtoull(argv[2], NULL, 10) : 1000;
+    const gchar *url = argv[2] && argv[3] ? argv[3] : LOAD_GEN_URL;
+    guint cycles = argv[2] && argv[3] && argv[4]
+                       ? (guint)g_ascii_strtoull(argv[4], NULL, 10)
+                       : 60;
+
+    TransportInit();
+    gint ret = LoadGenRun(pkg, symbols, url, cycles);
+    TransportDestruct();
+    TelemetryDestruct();
+
+    /* Free Class Instances. */
+    class_package_destruct();
+    StrArenaDestruct();
+    TimeDataDestruct();
+    exit(ret ? EXIT_FAILURE : EXIT_SUCCESS);
+
+  } else if (!g_strcmp0("-o", argv[1]) || !g_strcmp0("--once", argv[1])) {
+
+    const gchar *format_ch = "csv";
+    if ((!g_strcmp0("-f", argv[2]) || !g_strcmp0("--format", argv[2])) &&
+        argv[3])
+      format_ch = argv[3];
+
+    /* No gtk_init () and no glade resource, the output is the only cost. */
+    TransportInit();
+    QuoteBoardInit();
+    ReadConfig(pkg);
+    pkg->SetHeadless(TRUE);
+    gint ret = BatchRun(pkg, format_ch);
+
+    HttpCacheDestruct();
+    TransportDestruct();
+    QuoteBoardDestruct();
+    TelemetryDestruct();
+    TraceDestruct();
+
+    /* Free Class Instances. */
+    class_package_destruct();
+    StrArenaDestruct();
+    TimeDataDestruct();
+    exit(ret ? EXIT_FAILURE : EXIT_SUCCESS);
+
+  } else if (!g_strcmp0("-d", argv[1]) || !g_strcmp0("--daemon", argv[1])) {
+
+    guint16 port = argv[2] ? (guint16)g_ascii_strtoull(argv[2], NULL, 10) : 0;
+
+    /* The GUI path without gtk_init (), the mutexes are statically zeroed. */
+    TransportInit();
+    QuoteBoardInit();
+
+    /* The workers for the cache revalidations, and the cache expiry. */
+    TaskPoolInit();
+    TimerWheelInit();
+    TimerAdd(HTTP_CACHE_EXPIRE_SEC, http_cache_expire, NULL);
+
+    ReadConfig(pkg);
+    pkg->SetHeadless(TRUE);
+    gint ret = DaemonRun(pkg, port);
+
+    TimerWheelDestruct();
+    TaskPoolDestruct();
+    HttpCacheDestruct();
+    TransportDestruct();
+    QuoteBoardDestruct();
+    TelemetryDestruct();
+    TraceDestruct();
+
+    /* Free Class Instances. */
+    class_package_destruct();
+    StrArenaDestruct();
+    TimeDataDestruct();
+    exit(ret ? EXIT_FAILURE : EXIT_SUCCESS);
+
+  } else if (!g_strcmp0("-s", argv[1]) ||
+             !g_strcmp0("--simulate", argv[1])) {
+
+    /* The portfolio and the update rate from the config, nothing is
+       fetched. */
+    ReadConfig(pkg);
+    gint ret = RefreshSimRun(pkg, argv[2]);
+
+    HttpCacheDestruct();
+    TraceDestruct();
+
+    /* Free Class Instances. */
+    class_package_destruct();
+    StrArenaDestruct();
+    TimeDataDestruct();
+    exit(ret ? EXIT_FAILURE : EXIT_SUCCESS);
+
   } else if (!g_strcmp0("-r", argv[1]) || !g_strcmp0("--reset", argv[1])) {
 
     gint ret = RemoveConfigFiles(pkg->GetMetaClass());
@@ -110,8 +256,7 @@ gint main(gint argc, gchar *argv[]) {
   class_package_init();
 
   /* Parse commandline args, if any. */
-  if (argc > 1)
-    simple_arg_parse(argv, packet);
+  gboolean trace_on_exit = argc > 1 && simple_arg_parse(argv, packet);
 
   /* Initialize gtk */
   gtk_init(&argc, &argv);
@@ -120,14 +265,51 @@ gint main(gint argc, gchar *argv[]) {
   /* This needs to be initialized before ReadConfig */
   mutex_init();
 
+  /* Select the live, record, or replay transport [from the environment]. */
+  TransportInit();
+
+  /* The shared-memory quote board, if FINANCIALS_QUOTE_BOARD is set. */
+  QuoteBoardInit();
+
+  /* The worker pool for the GUI actions. */
+  TaskPoolInit();
+
+  /* The periodic work [clocks, fetch session, cache expiry, state flush]. */
+  TimerWheelInit();
+  TimerAdd(HTTP_CACHE_EXPIRE_SEC, http_cache_expire, NULL);
+
   /* Read config file and populate associated variables */
   ReadConfig(packet);
 
+  /* The metrics endpoint, if FINANCIALS_METRICS_PORT is set. */
+  MetricsInit();
+
   /* Set up GUI widgets and display the GUI */
   GuiStart(packet);
+  MetricsDestruct();
 
-  /* Free Class Instances. */
+  /* No timer submits a task from here on. */
+  TimerWheelDestruct();
+
+  /* Wait for the running tasks [the exit task among them]. */
+  TaskPoolDestruct();
+
+  /* Report the http cache hits and bytes saved this session. */
+  HttpCacheReport();
+  HttpCacheDestruct();
+  TransportDestruct();
+  QuoteBoardDestruct();
+  TelemetryDestruct();
+
+  /* Write the pipeline trace, if requested on the command line. */
+  if (trace_on_exit)
+    TraceExport();
+  TraceDestruct();
+
+  /* Free Class Instances [and the display strings they point to]. */
   class_package_destruct();
+  StrArenaDestruct();
+  TimeDataDestruct();
 
   /* Free Mutex Resources */
   mutex_destruct();
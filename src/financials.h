@@ -33,12 +33,17 @@ POSSIBILITY OF SUCH DAMAGE.
 #ifndef FINANCIALS_HEADER_H
 #define FINANCIALS_HEADER_H
 
+#include "include/bench.h"   /* LoadGenRun (), RefreshSimRun () */
 #include "include/class.h"   /* ClassDestructPortfolioPacket () and 
                                        ClassInitPortfolioPacket () functions */
 #include "include/config.h"  /* ReadConfig (), RemoveConfigFiles () */
+#include "include/daemon.h"  /* BatchRun (), DaemonRun () */
 #include "include/globals.h" /* portfolio_packet *packet */
 #include "include/gui.h"     /* GuiStart () */
 #include "include/macros.h"  /* VERSION_STRING */
+#include "include/multicurl.h" /* HttpCacheReport (), HttpCacheDestruct () */
 #include "include/mutex.h"   /* GMutex mutexes[ MUTEX_NUMBER ] */
+#include "include/quote_board.h" /* QuoteBoardInit () */
+#include "include/workfuncs.h" /* TraceInit (), TraceExport () */
 
 #endif /* FINANCIALS_HEADER_H */
\ No newline at end of file
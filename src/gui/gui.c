@@ -32,6 +32,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "../include/gui.h"
 #include "../include/class_types.h" /* portfolio_packet, window_data */
 #include "../include/macros.h"
+#include "../include/multicurl.h" /* SetMultiCurlProgressFunc () */
 #include "../include/workfuncs.h"
 
 static GtkBuilder *builder;
@@ -79,6 +80,14 @@ static void main_window_sig_connect(portfolio_packet *pkg) {
   g_signal_connect(object, "activate", G_CALLBACK(GUICallbackHandler),
                    (gpointer)HISTORY_TOGGLE_BTN);
 
+  object = GetGObject("MainFileMenuTrace");
+  g_signal_connect(object, "activate", G_CALLBACK(GUICallbackHandler),
+                   (gpointer)TRACE_EXPORT_BTN);
+
+  object = GetGObject("MainFileMenuDiagnostics");
+  g_signal_connect(object, "activate", G_CALLBACK(GUICallbackHandler),
+                   (gpointer)DIAGNOSTICS_TOGGLE_BTN);
+
   object = GetGObject("MainFileMenuQuit");
   g_signal_connect(object, "activate", G_CALLBACK(GUICallbackHandler),
                    (gpointer)MAIN_EXIT);
@@ -363,6 +372,23 @@ static void other_window_sig_connect() {
                    G_CALLBACK(GUICallback_hide_window_on_delete),
                    (gpointer)HOTKEYS_TOGGLE_BTN);
 
+  object = GetGObject("DiagnosticsMenuRefresh");
+  g_signal_connect(object, "activate", G_CALLBACK(GUICallbackHandler),
+                   (gpointer)DIAGNOSTICS_REFRESH_BTN);
+
+  object = GetGObject("DiagnosticsMenuExport");
+  g_signal_connect(object, "activate", G_CALLBACK(GUICallbackHandler),
+                   (gpointer)DIAGNOSTICS_EXPORT_BTN);
+
+  object = GetGObject("DiagnosticsMenuClose");
+  g_signal_connect(object, "activate", G_CALLBACK(GUICallbackHandler),
+                   (gpointer)DIAGNOSTICS_TOGGLE_BTN);
+
+  window = GetGObject("DiagnosticsWindow");
+  g_signal_connect(window, "delete_event",
+                   G_CALLBACK(GUICallback_hide_window_on_delete),
+                   (gpointer)DIAGNOSTICS_TOGGLE_BTN);
+
   object = GetGObject("CashMenuClose");
   g_signal_connect(object, "activate", G_CALLBACK(GUICallbackHandler),
                    (gpointer)CASH_TOGGLE_BTN);
@@ -419,7 +445,7 @@ static void set_application_css() {
 
    Some signals require separate threads to perform computational tasks, these
    are dispatched from the GUICallback functions [in gui_callbacks.c].
-   The clock threads are dispatched by separate functions [StartClockThread(),
+   The clock timer is dispatched by separate functions [StartClockTimer(),
    GUICallback_pref_clock_switch()].
 
    There are ancillary widget signals to perform other tasks depending upon
@@ -456,9 +482,19 @@ void GuiStart(portfolio_packet *pkg)
   /* Set application-wide CSS. */
   set_application_css();
 
+  /* The core posts fetch progress and streamed rows through these. */
+  SetMultiCurlProgressFunc(MainProgBar);
+  pkg->SetRowFunc(MainPrimaryTreeviewRow);
+
   /* Set whether the clocks are displayed or not.
-     Start clock threads if the clocks are displayed. */
-  StartClockThread(pkg);
+     Start the clock timer if the clocks are displayed. */
+  StartClockTimer(pkg);
+
+  /* Save the application data periodically. */
+  StartFlushTimer(pkg);
+
+  /* Connect and prefetch ahead of each open, if configured. */
+  StartWarmupTimer(pkg);
 
   /* Add the list of stock symbols from sqlite to a struct.
      Set two entrybox completion widgets. */
@@ -41,23 +41,26 @@ POSSIBILITY OF SUCH DAMAGE.
 
 void GUICallbackHandler(GtkWidget *widget, gpointer sig_data) {
   UNUSED(widget)
-  GThread *g_thread_id;
 
   /* We're using data as a value rather than a pointer. */
   cb_signal index_signal = (cb_signal)((guintptr)sig_data);
 
   switch (index_signal) {
   case MAIN_FETCH_BTN:
-    g_thread_id = g_thread_new(NULL, GUIThreadHandler_main_fetch, packet);
-    g_thread_unref(g_thread_id);
+    TaskSubmit(TASK_LANE_FETCH, TASK_NONE, GUIThreadHandler_main_fetch,
+               packet, NULL);
     break;
   case MAIN_EXIT:
-    g_thread_id = g_thread_new(NULL, GUIThread_main_exit, packet);
-    g_thread_unref(g_thread_id);
+    /* Queued recalculations and fetches are moot, database writes still
+       run. */
+    TaskCancelLane(TASK_LANE_INTERACTIVE);
+    TaskCancelLane(TASK_LANE_FETCH);
+    TaskSubmit(TASK_LANE_INTERACTIVE, TASK_NONE, GUIThread_main_exit, packet,
+               NULL);
     break;
   case HISTORY_FETCH_BTN:
-    g_thread_id = g_thread_new(NULL, GUIThread_history_fetch, packet);
-    g_thread_unref(g_thread_id);
+    TaskSubmit(TASK_LANE_FETCH, TASK_SUPERSEDE, GUIThread_history_fetch,
+               packet, NULL);
     break;
   case ABOUT_TOGGLE_BTN:
     AboutShowHide();
@@ -83,13 +86,13 @@ void GUICallbackHandler(GtkWidget *widget, gpointer sig_data) {
     /* If we need to update the main treeview with new bullion data. */
     if (BullionOk(packet) && !packet->IsDefaultView()) {
       /* Fetch the data in a separate thread */
-      g_thread_id = g_thread_new(NULL, GUIThread_bul_fetch, packet);
-      g_thread_unref(g_thread_id);
+      TaskSubmit(TASK_LANE_FETCH, TASK_COALESCE, GUIThread_bul_fetch,
+                 packet, NULL);
 
       /* Recalculate and update the treeview. */
     } else {
-      g_thread_id = g_thread_new(NULL, GUIThread_recalculate, packet);
-      g_thread_unref(g_thread_id);
+      TaskSubmit(TASK_LANE_INTERACTIVE, TASK_COALESCE, GUIThread_recalculate,
+                 packet, NULL);
     }
     break;
   case BUL_COMBO_BOX:
@@ -104,8 +107,8 @@ void GUICallbackHandler(GtkWidget *widget, gpointer sig_data) {
   case CASH_OK_BTN:
     CashShowHide(packet);
     CashOk(packet);
-    g_thread_id = g_thread_new(NULL, GUIThread_recalculate, packet);
-    g_thread_unref(g_thread_id);
+    TaskSubmit(TASK_LANE_INTERACTIVE, TASK_COALESCE, GUIThread_recalculate,
+               packet, NULL);
     break;
   case CASH_CURSOR_MOVE:
     CashCursorMove();
@@ -115,8 +118,7 @@ void GUICallbackHandler(GtkWidget *widget, gpointer sig_data) {
     break;
   case API_OK_BTN:
     APIShowHide(packet);
-    g_thread_id = g_thread_new(NULL, GUIThread_api_ok, packet);
-    g_thread_unref(g_thread_id);
+    TaskSubmit(TASK_LANE_IO, TASK_COALESCE, GUIThread_api_ok, packet, NULL);
     break;
   case API_CURSOR_MOVE:
     APICursorMove();
@@ -125,8 +127,8 @@ void GUICallbackHandler(GtkWidget *widget, gpointer sig_data) {
     PrefShowHide(packet);
     break;
   case PREF_SYMBOL_UPDATE_BTN:
-    g_thread_id = g_thread_new(NULL, GUIThread_pref_sym_update, packet);
-    g_thread_unref(g_thread_id);
+    TaskSubmit(TASK_LANE_IO, TASK_COALESCE, GUIThread_pref_sym_update,
+               packet, NULL);
     break;
   case HISTORY_TOGGLE_BTN:
     HistoryShowHide(packet);
@@ -138,6 +140,18 @@ void GUICallbackHandler(GtkWidget *widget, gpointer sig_data) {
   case HOTKEYS_TOGGLE_BTN:
     HotkeysShowHide();
     break;
+  case TRACE_EXPORT_BTN:
+    TraceExport();
+    break;
+  case DIAGNOSTICS_TOGGLE_BTN:
+    DiagnosticsShowHide();
+    break;
+  case DIAGNOSTICS_REFRESH_BTN:
+    DiagnosticsSetTreeview();
+    break;
+  case DIAGNOSTICS_EXPORT_BTN:
+    DiagnosticsExport(packet);
+    break;
   default:
     break;
   }
@@ -183,7 +197,6 @@ void GUICallback_security_stack(GObject *gobject) {
 
 void GUICallback_pref_font_button(GtkFontButton *widget) {
   meta *D = packet->GetMetaClass();
-  GThread *g_thread_id;
 
   g_free(D->font_ch);
   D->font_ch = gtk_font_chooser_get_font(GTK_FONT_CHOOSER(widget));
@@ -198,22 +211,21 @@ void GUICallback_pref_font_button(GtkFontButton *widget) {
   packet->meta_class->ToStringsHeadings();
 
   /* Update the main treeview with the new font */
-  g_thread_id = g_thread_new(NULL, GUIThread_recalculate, packet);
-  g_thread_unref(g_thread_id);
+  TaskSubmit(TASK_LANE_INTERACTIVE, TASK_COALESCE, GUIThread_recalculate,
+             packet, NULL);
 }
 
 gboolean GUICallback_pref_clock_switch(GtkSwitch *Switch, gboolean state) {
   UNUSED(Switch)
   UNUSED(state)
-  GThread *g_thread_id;
 
   /* Visually, the underlying state is represented by the trough color of the
      switch, while the “active” property is represented by the position of the
      switch. */
 
-  /* Start/Stop clock threads, will toggle the clocks_displayed_bool flag */
-  g_thread_id = g_thread_new(NULL, GUIThreadHandler_clock, packet);
-  g_thread_unref(g_thread_id);
+  /* Start/Stop the clock timer, will toggle the clocks_displayed_bool flag */
+  TaskSubmit(TASK_LANE_INTERACTIVE, TASK_NONE, GUIThreadHandler_clock,
+             packet, NULL);
 
   /* Return FALSE to keep the state
      and active properties in sync. */
@@ -242,7 +254,6 @@ gboolean GUICallback_pref_indices_switch(GtkSwitch *Switch, gboolean state) {
 
 void GUICallback_pref_dec_places_combobox(GtkComboBox *ComboBox) {
   meta *D = packet->GetMetaClass();
-  GThread *g_thread_id;
 
   gchar *new = gtk_combo_box_text_get_active_text(GTK_COMBO_BOX_TEXT(ComboBox));
   guint8 new_guint8 = (guint8)g_ascii_strtoll(new, NULL, 10);
@@ -252,8 +263,8 @@ void GUICallback_pref_dec_places_combobox(GtkComboBox *ComboBox) {
     D->decimal_places_guint8 = new_guint8;
 
     /* Recalculate values and update the treeview */
-    g_thread_id = g_thread_new(NULL, GUIThread_recalculate, packet);
-    g_thread_unref(g_thread_id);
+    TaskSubmit(TASK_LANE_INTERACTIVE, TASK_COALESCE, GUIThread_recalculate,
+               packet, NULL);
   }
 }
 
@@ -297,6 +308,9 @@ gboolean GUICallback_hide_window_on_delete(GtkWidget *window, GdkEvent *event,
   case HOTKEYS_TOGGLE_BTN:
     HotkeysShowHide();
     break;
+  case DIAGNOSTICS_TOGGLE_BTN:
+    DiagnosticsShowHide();
+    break;
   case SECURITY_TOGGLE_BTN:
     SecurityShowHide(packet);
     break;
@@ -457,9 +471,8 @@ static void popup_menu_delete_bullion(GtkWidget *menuitem, gpointer userdata) {
   else if (palladium)
     zeroize_bullion(M->Palladium);
 
-  GThread *g_thread_id;
-  g_thread_id = g_thread_new(NULL, GUIThread_recalculate, packet);
-  g_thread_unref(g_thread_id);
+  TaskSubmit(TASK_LANE_INTERACTIVE, TASK_COALESCE, GUIThread_recalculate,
+             packet, NULL);
 }
 
 static void popup_menu_delete_all_bullion() {
@@ -470,20 +483,19 @@ static void popup_menu_delete_all_bullion() {
   zeroize_bullion(M->Platinum);
   zeroize_bullion(M->Palladium);
 
-  GThread *g_thread_id;
-  g_thread_id = g_thread_new(NULL, GUIThread_recalculate, packet);
-  g_thread_unref(g_thread_id);
+  TaskSubmit(TASK_LANE_INTERACTIVE, TASK_COALESCE, GUIThread_recalculate,
+             packet, NULL);
 }
 
-/* These thread funcs have mutexes that shouldn't be in the main loop, so we
- * make them threads instead. */
+/* These task funcs have mutexes that shouldn't be in the main loop, so they
+ * run on the worker pool instead. */
 static gpointer remove_stock_thd(gpointer data) {
   gchar *symbol = (gchar *)data;
   equity_folder *F = packet->GetEquityFolderClass();
   meta *D = packet->GetMetaClass();
 
   /* Prevents Program From Crashing During A Data Fetch Operation */
-  g_mutex_lock(&mutexes[FETCH_DATA_MUTEX]);
+  MutexLock(&mutexes[FETCH_DATA_MUTEX]);
 
   SqliteEquityRemove(symbol, D);
   F->RemoveStock(symbol);
@@ -499,8 +511,6 @@ static gpointer remove_stock_thd(gpointer data) {
     gdk_threads_add_idle(MainPrimaryTreeview, packet);
   }
 
-  g_free(symbol);
-  g_thread_exit(NULL);
   return NULL;
 }
 
@@ -509,17 +519,17 @@ static void popup_menu_delete_equity(GtkWidget *menuitem, gpointer userdata) {
 
   const gchar *symbol = (gchar *)userdata;
 
-  GThread *g_thread_id;
-  g_thread_id = g_thread_new(NULL, remove_stock_thd, g_strdup(symbol));
-  g_thread_unref(g_thread_id);
+  TaskSubmit(TASK_LANE_IO, TASK_NONE, remove_stock_thd, g_strdup(symbol),
+             g_free);
 }
 
-static gpointer remove_all_stocks_thd() {
+static gpointer remove_all_stocks_thd(gpointer data) {
+  UNUSED(data)
   equity_folder *F = packet->GetEquityFolderClass();
   meta *D = packet->GetMetaClass();
 
   /* Prevents Program From Crashing During A Data Fetch Operation */
-  g_mutex_lock(&mutexes[FETCH_DATA_MUTEX]);
+  MutexLock(&mutexes[FETCH_DATA_MUTEX]);
 
   SqliteEquityRemoveAll(D);
   F->Reset();
@@ -535,14 +545,11 @@ static gpointer remove_all_stocks_thd() {
     gdk_threads_add_idle(MainPrimaryTreeview, packet);
   }
 
-  g_thread_exit(NULL);
   return NULL;
 }
 
 static void popup_menu_delete_all_equity() {
-  GThread *g_thread_id;
-  g_thread_id = g_thread_new(NULL, remove_all_stocks_thd, NULL);
-  g_thread_unref(g_thread_id);
+  TaskSubmit(TASK_LANE_IO, TASK_COALESCE, remove_all_stocks_thd, NULL, NULL);
 }
 
 static void popup_menu_add_row(GtkWidget *menuitem, gpointer userdata) {
@@ -388,10 +388,12 @@ MemType *HistoryFetchData(const gchar *symbol_ch, portfolio_packet *pkg) {
 
   /* Number of Seconds in a Year Plus Three Weeks */
   guint period = 33372000;
-  GetYahooUrl(&MyUrl_ch, symbol_ch, period);
+  GetYahooHistoryUrl(&MyUrl_ch, symbol_ch, period);
 
-  SetUpCurlHandle(D->history_hnd, D->multicurl_history_hnd, MyUrl_ch,
-                  MyOutputStruct);
+  /* The window is fixed for the day, the validators are kept for exactly
+     this URL [a 304 never answers for another window]. */
+  SetUpCurlHandleValidated(D->history_hnd, D->multicurl_history_hnd, MyUrl_ch,
+                           MyUrl_ch, MyOutputStruct);
   if (PerformMultiCurl_no_prog(D->multicurl_history_hnd) != 0) {
     g_free(MyUrl_ch);
     FreeMemtype(MyOutputStruct);
@@ -32,6 +32,7 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #include "../include/class.h" /* portfolio_packet, equity_folder, metal, meta  */
 #include "../include/gui.h"
+#include "../include/mutex.h" /* GMutex mutexes */
 #include "../include/workfuncs.h"
 
 gint MainFetchBTNLabel(gpointer pkg_data) {
@@ -89,7 +90,161 @@ static void add_hidden_column(const gchar *col_name, const gint col_num,
   gtk_tree_view_append_column(GTK_TREE_VIEW(treeview), column);
 }
 
-static gint main_set_columns(gint column_type) {
+/* The numeric cell colors, parsed on first use [the GUI thread only]. */
+static const gchar *cell_color_names[PANGO_FORMATS] = {
+    [BLACK] = "Black",
+    [GREEN] = "DarkGreen",
+    [RED] = "DarkRed",
+    [BLUE] = "MidnightBlue",
+    [GREY] = "DarkSlateGrey",
+    [SIENNA] = "Sienna",
+    [BLACK_ITALIC] = "Black",
+};
+static PangoColor cell_colors[PANGO_FORMATS];
+static gboolean cell_colors_parsed = FALSE;
+
+static PangoFontDescription *cell_font = NULL;
+static gchar *cell_font_ch = NULL;
+
+static void cell_attr_span(PangoAttrList *attrs, const guint color,
+                           const guint start, const guint end)
+/* Color bytes [start, end) of the cell text. */
+{
+  if (!cell_colors_parsed) {
+    for (guint c = 0; c < PANGO_FORMATS; c++)
+      if (cell_color_names[c])
+        pango_color_parse(&cell_colors[c], cell_color_names[c]);
+    cell_colors_parsed = TRUE;
+  }
+
+  const PangoColor *C = &cell_colors[color];
+  PangoAttribute *attr = pango_attr_foreground_new(C->red, C->green, C->blue);
+  attr->start_index = start;
+  attr->end_index = end;
+  pango_attr_list_insert(attrs, attr);
+
+  if (color == BLACK_ITALIC) {
+    attr = pango_attr_style_new(PANGO_STYLE_ITALIC);
+    attr->start_index = start;
+    attr->end_index = end;
+    pango_attr_list_insert(attrs, attr);
+  }
+}
+
+static guint cell_sign_color(const gdouble value_f) {
+  if (value_f < 0)
+    return RED;
+  else if (value_f > 0)
+    return GREEN;
+  return BLACK;
+}
+
+static void main_numeric_cell(GtkTreeViewColumn *column,
+                              GtkCellRenderer *renderer, GtkTreeModel *model,
+                              GtkTreeIter *iter, gpointer pkg_data)
+/* Format one numeric cell as it's drawn, the same text and colors as the
+   *StrPango functions without building or parsing the markup. */
+{
+  portfolio_packet *pkg = (portfolio_packet *)pkg_data;
+  meta *D = pkg->GetMetaClass();
+  gint col =
+      GPOINTER_TO_INT(g_object_get_data(G_OBJECT(column), "column_num"));
+  guint style = CELL_MARKUP;
+  gdouble a = 0, b = 0;
+
+  gtk_tree_model_get(model, iter, MAIN_CELL_STYLE(col), &style,
+                     MAIN_CELL_A(col), &a, MAIN_CELL_B(col), &b, -1);
+
+  if (style == CELL_MARKUP) {
+    gchar *markup = NULL;
+    gtk_tree_model_get(model, iter, col, &markup, -1);
+    if (markup)
+      g_object_set(renderer, "markup", markup, NULL);
+    else
+      g_object_set(renderer, "text", NULL, "attributes", NULL, NULL);
+    g_free(markup);
+    return;
+  }
+
+  if (g_strcmp0(cell_font_ch, D->font_ch) != 0) {
+    if (cell_font)
+      pango_font_description_free(cell_font);
+    g_free(cell_font_ch);
+    cell_font_ch = g_strdup(D->font_ch);
+    cell_font = pango_font_description_from_string(cell_font_ch);
+  }
+
+  guint8 digits_right = D->decimal_places_guint8;
+  gchar a_ch[FORMAT_BUF_SIZE], b_ch[FORMAT_BUF_SIZE];
+  gchar text[FORMAT_BUF_SIZE * 2 + 4];
+  gchar *symbol = NULL;
+  gsize len = 0;
+  PangoAttrList *attrs = pango_attr_list_new();
+  pango_attr_list_insert(attrs, pango_attr_font_desc_new(cell_font));
+  pango_attr_list_insert(attrs, pango_attr_weight_new(PANGO_WEIGHT_MEDIUM));
+
+  switch (style) {
+  case CELL_PRICE:
+  case CELL_GREY:
+    len = FormatDouble(text, sizeof(text), a, digits_right, MON_STR);
+    len = MIN(len, sizeof(text) - 1);
+    cell_attr_span(attrs, style == CELL_PRICE ? BLACK : GREY, 0, len);
+    break;
+  case CELL_RANGE:
+    FormatDouble(a_ch, sizeof(a_ch), a, digits_right, MON_STR);
+    FormatDouble(b_ch, sizeof(b_ch), b, digits_right, MON_STR);
+    len = g_snprintf(text, sizeof(text), "%s - %s", a_ch, b_ch);
+    cell_attr_span(attrs, GREY, 0, len);
+    break;
+  case CELL_CHANGE:
+    FormatDouble(a_ch, sizeof(a_ch), a, digits_right, MON_STR);
+    FormatDouble(b_ch, sizeof(b_ch), b, digits_right, PER_STR);
+    len = g_snprintf(text, sizeof(text), "%s\n%s", a_ch, b_ch);
+    cell_attr_span(attrs, cell_sign_color(a), 0, len);
+    break;
+  case CELL_TOTAL:
+    len = FormatDouble(a_ch, sizeof(a_ch), a, digits_right, MON_STR);
+    len = MIN(len, sizeof(a_ch) - 1) + 1;
+    FormatDouble(b_ch, sizeof(b_ch), b, digits_right, MON_STR);
+    g_snprintf(text, sizeof(text), "%s\n%s", a_ch, b_ch);
+    cell_attr_span(attrs, BLACK, 0, len);
+    cell_attr_span(attrs, cell_sign_color(b), len, strlen(text));
+    break;
+  case CELL_SYMBOL:
+    gtk_tree_model_get(model, iter, MAIN_COLUMN_SYMBOL, &symbol, -1);
+    FormatDouble(b_ch, sizeof(b_ch), a, 0, NUM_STR);
+    len = g_snprintf(text, sizeof(text), "%s\n", symbol ? symbol : "");
+    len = MIN(len, sizeof(text) - 1);
+    g_strlcpy(text + len, b_ch, sizeof(text) - len);
+    cell_attr_span(attrs, a ? BLUE : BLACK_ITALIC, 0, len);
+    cell_attr_span(attrs, SIENNA, len, strlen(text));
+    g_free(symbol);
+    break;
+  default:
+    /* CELL_BLANK */
+    text[0] = 0;
+    break;
+  }
+
+  /* "text" clears the attributes of a previous "markup" row. */
+  g_object_set(renderer, "text", text, "attributes", attrs, NULL);
+  pango_attr_list_unref(attrs);
+}
+
+static void add_numeric_column(const gint col_num, GtkWidget *treeview,
+                               portfolio_packet *pkg) {
+  GtkCellRenderer *renderer = gtk_cell_renderer_text_new();
+  GtkTreeViewColumn *column = gtk_tree_view_column_new();
+  gtk_tree_view_column_set_title(column, "column_name");
+  gtk_tree_view_column_pack_start(column, renderer, TRUE);
+  g_object_set_data(G_OBJECT(column), "column_num", GINT_TO_POINTER(col_num));
+  gtk_tree_view_column_set_cell_data_func(column, renderer, main_numeric_cell,
+                                          pkg, NULL);
+  gtk_tree_view_column_set_resizable(column, TRUE);
+  gtk_tree_view_append_column(GTK_TREE_VIEW(treeview), column);
+}
+
+static gint main_set_columns(gint column_type, portfolio_packet *pkg) {
   GtkWidget *list = GetWidget("MainTreeView");
 
   /* A hidden column indicating the type of row [bullion, equity, blank space,
@@ -100,6 +255,13 @@ static gint main_set_columns(gint column_type) {
    * symbol, etc] */
   add_hidden_column("symbol_text", MAIN_COLUMN_SYMBOL, list);
 
+  if (column_type == GUI_COLUMN_PRIMARY && NumericColumns()) {
+    /* The cells are formatted as they're drawn. */
+    for (guint8 g = MAIN_COLUMN_ONE; g < MAIN_N_COLUMNS; g++)
+      add_numeric_column(g, list, pkg);
+    return 0;
+  }
+
   for (guint8 g = MAIN_COLUMN_ONE; g <= MAIN_COLUMN_FOUR; g++)
     AddColumnToTreeview("column_name", g, list);
 
@@ -111,9 +273,8 @@ static gint main_set_columns(gint column_type) {
   return 0;
 }
 
-static gint main_prmry_add_bul_store(bullion *B, const gchar *unmarked_name_ch,
-                                     GtkListStore *store, GtkTreeIter *iter) {
-  gtk_list_store_append(store, iter);
+static void main_prmry_set_bul_row(bullion *B, const gchar *unmarked_name_ch,
+                                   GtkListStore *store, GtkTreeIter *iter) {
   gtk_list_store_set(
       store, iter, MAIN_COLUMN_TYPE, "bullion", MAIN_COLUMN_SYMBOL,
       unmarked_name_ch, MAIN_COLUMN_ONE, B->metal_mrkd_ch, MAIN_COLUMN_TWO,
@@ -123,9 +284,162 @@ static gint main_prmry_add_bul_store(bullion *B, const gchar *unmarked_name_ch,
       B->change_ounce_mrkd_ch, MAIN_COLUMN_EIGHT, B->port_value_mrkd_ch,
       MAIN_COLUMN_NINE, B->total_cost_mrkd_ch, MAIN_COLUMN_TEN,
       B->total_gain_mrkd_ch, -1);
+}
+
+static gint main_prmry_add_bul_store(bullion *B, const gchar *unmarked_name_ch,
+                                     GtkListStore *store, GtkTreeIter *iter) {
+  gtk_list_store_append(store, iter);
+  main_prmry_set_bul_row(B, unmarked_name_ch, store, iter);
   return 0;
 }
 
+static void main_prmry_set_equity_cells(stock *S, GtkListStore *store,
+                                        GtkTreeIter *iter)
+/* The numeric mode row, the raw values and a style per cell. */
+{
+  gtk_list_store_set(
+      store, iter, MAIN_COLUMN_TYPE, "equity", MAIN_COLUMN_SYMBOL,
+      S->symbol_stock_ch, MAIN_CELL_STYLE(MAIN_COLUMN_ONE), CELL_SYMBOL,
+      MAIN_CELL_A(MAIN_COLUMN_ONE), (gdouble)S->quantity_int,
+      MAIN_CELL_STYLE(MAIN_COLUMN_TWO), CELL_PRICE,
+      MAIN_CELL_A(MAIN_COLUMN_TWO), S->current_price_stock_f,
+      MAIN_CELL_STYLE(MAIN_COLUMN_THREE), CELL_GREY,
+      MAIN_CELL_A(MAIN_COLUMN_THREE), S->opening_stock_f,
+      MAIN_CELL_STYLE(MAIN_COLUMN_FOUR),
+      S->cost_basis_f ? CELL_GREY : CELL_BLANK, MAIN_CELL_A(MAIN_COLUMN_FOUR),
+      S->cost_basis_f, MAIN_CELL_STYLE(MAIN_COLUMN_FIVE), CELL_RANGE,
+      MAIN_CELL_A(MAIN_COLUMN_FIVE), S->low_stock_f,
+      MAIN_CELL_B(MAIN_COLUMN_FIVE), S->high_stock_f,
+      MAIN_CELL_STYLE(MAIN_COLUMN_SIX), CELL_GREY, MAIN_CELL_A(MAIN_COLUMN_SIX),
+      S->prev_closing_stock_f, MAIN_CELL_STYLE(MAIN_COLUMN_SEVEN), CELL_CHANGE,
+      MAIN_CELL_A(MAIN_COLUMN_SEVEN), S->change_share_f,
+      MAIN_CELL_B(MAIN_COLUMN_SEVEN), S->change_percent_f,
+      MAIN_CELL_STYLE(MAIN_COLUMN_EIGHT),
+      S->current_investment_stock_f ? CELL_TOTAL : CELL_BLANK,
+      MAIN_CELL_A(MAIN_COLUMN_EIGHT), S->current_investment_stock_f,
+      MAIN_CELL_B(MAIN_COLUMN_EIGHT), S->change_value_f,
+      MAIN_CELL_STYLE(MAIN_COLUMN_NINE),
+      S->total_cost_f ? CELL_GREY : CELL_BLANK, MAIN_CELL_A(MAIN_COLUMN_NINE),
+      S->total_cost_f, MAIN_CELL_STYLE(MAIN_COLUMN_TEN),
+      S->total_gain_value_f ? CELL_CHANGE : CELL_BLANK,
+      MAIN_CELL_A(MAIN_COLUMN_TEN), S->total_gain_value_f,
+      MAIN_CELL_B(MAIN_COLUMN_TEN), S->total_gain_percent_f, -1);
+}
+
+static void main_prmry_set_equity_row(stock *S, GtkListStore *store,
+                                      GtkTreeIter *iter) {
+  if (NumericColumns()) {
+    main_prmry_set_equity_cells(S, store, iter);
+    return;
+  }
+
+  gtk_list_store_set(
+      store, iter, MAIN_COLUMN_TYPE, "equity", MAIN_COLUMN_SYMBOL,
+      S->symbol_stock_ch, MAIN_COLUMN_ONE, S->symbol_stock_mrkd_ch,
+      MAIN_COLUMN_TWO, S->current_price_stock_mrkd_ch, MAIN_COLUMN_THREE,
+      S->opening_stock_mrkd_ch, MAIN_COLUMN_FOUR, S->cost_mrkd_ch,
+      MAIN_COLUMN_FIVE, S->range_mrkd_ch, MAIN_COLUMN_SIX,
+      S->prev_closing_stock_mrkd_ch, MAIN_COLUMN_SEVEN,
+      S->change_share_stock_mrkd_ch, MAIN_COLUMN_EIGHT,
+      S->current_investment_stock_mrkd_ch, MAIN_COLUMN_NINE,
+      S->total_cost_mrkd_ch, MAIN_COLUMN_TEN, S->total_gain_mrkd_ch, -1);
+}
+
+static void main_prmry_set_cash_row(portfolio_packet *pkg,
+                                    GtkListStore *store, GtkTreeIter *iter) {
+  meta *D = pkg->GetMetaClass();
+  heading_str_t *headings_mkd = pkg->GetHeadings();
+
+  gtk_list_store_set(store, iter, MAIN_COLUMN_TYPE, "cash", MAIN_COLUMN_SYMBOL,
+                     "", MAIN_COLUMN_ONE, headings_mkd->cash, MAIN_COLUMN_TWO,
+                     D->cash_mrkd_ch, MAIN_COLUMN_FOUR, D->cash_cost_mrkd_ch,
+                     -1);
+}
+
+static void main_prmry_set_bul_total_row(portfolio_packet *pkg,
+                                         GtkListStore *store,
+                                         GtkTreeIter *iter) {
+  metal *M = pkg->GetMetalClass();
+  heading_str_t *headings_mkd = pkg->GetHeadings();
+
+  gtk_list_store_set(store, iter, MAIN_COLUMN_TYPE, "bullion_total",
+                     MAIN_COLUMN_SYMBOL, "", MAIN_COLUMN_ONE,
+                     headings_mkd->bullion, MAIN_COLUMN_TWO,
+                     M->bullion_port_value_mrkd_ch, MAIN_COLUMN_THREE,
+                     M->bullion_port_day_gain_mrkd_ch, MAIN_COLUMN_FOUR,
+                     M->bullion_port_cost_mrkd_ch, MAIN_COLUMN_FIVE,
+                     M->bullion_port_total_gain_mrkd_ch, -1);
+}
+
+static void main_prmry_set_equity_total_row(portfolio_packet *pkg,
+                                            GtkListStore *store,
+                                            GtkTreeIter *iter) {
+  equity_folder *F = pkg->GetEquityFolderClass();
+  heading_str_t *headings_mkd = pkg->GetHeadings();
+
+  gtk_list_store_set(store, iter, MAIN_COLUMN_TYPE, "equity_total",
+                     MAIN_COLUMN_SYMBOL, "", MAIN_COLUMN_ONE,
+                     headings_mkd->equity, MAIN_COLUMN_TWO,
+                     F->stock_port_value_mrkd_ch, MAIN_COLUMN_THREE,
+                     F->stock_port_day_gain_mrkd_ch, MAIN_COLUMN_FOUR,
+                     F->stock_port_cost_mrkd_ch, MAIN_COLUMN_FIVE,
+                     F->stock_port_total_gain_mrkd_ch, -1);
+}
+
+static void main_prmry_set_portfolio_row(portfolio_packet *pkg,
+                                         GtkListStore *store,
+                                         GtkTreeIter *iter) {
+  meta *D = pkg->GetMetaClass();
+  heading_str_t *headings_mkd = pkg->GetHeadings();
+
+  gtk_list_store_set(store, iter, MAIN_COLUMN_TYPE, "blank_space_primary",
+                     MAIN_COLUMN_SYMBOL, "", MAIN_COLUMN_ONE,
+                     headings_mkd->portfolio, MAIN_COLUMN_TWO,
+                     D->portfolio_value_mrkd_ch, MAIN_COLUMN_THREE,
+                     D->portfolio_day_gain_mrkd_ch, MAIN_COLUMN_FOUR,
+                     D->portfolio_cost_mrkd_ch, MAIN_COLUMN_FIVE,
+                     D->portfolio_total_gain_mrkd_ch, -1);
+}
+
+/* Where main_primary_store put the rows a fetch cycle changes, attached to
+   the store as "primary-rows" [-1 is no such row]. */
+typedef struct {
+  guint layout;
+  gint metal_row[4]; /* Gold, Palladium, Platinum, Silver */
+  gint cash_row;
+  gint bullion_total_row;
+  gint equity_total_row;
+  gint portfolio_row;
+  gint equity_row[G_MAXUINT8]; /* By position in the equity folder. */
+} primary_rows_t;
+
+static guint main_primary_layout(portfolio_packet *pkg)
+/* The row structure of the primary store, a change needs a rebuild. */
+{
+  metal *M = pkg->GetMetalClass();
+  equity_folder *F = pkg->GetEquityFolderClass();
+  meta *D = pkg->GetMetaClass();
+  guint layout = F->size;
+
+  layout |= (M->bullion_port_value_f != 0) << 8;
+  layout |= (M->Gold->ounce_f != 0) << 9;
+  layout |= (M->Palladium->ounce_f != 0) << 10;
+  layout |= (M->Platinum->ounce_f != 0) << 11;
+  layout |= (M->Silver->ounce_f != 0) << 12;
+  layout |= (D->cash_f != 0) << 13;
+  layout |= (F->stock_port_value_f != 0) << 14;
+  layout |= (D->portfolio_value_f != 0) << 15;
+  layout |= (NumericColumns() != 0) << 16;
+
+  return layout;
+}
+
+static gint main_store_row(GtkListStore *store)
+/* The index of the row the next append creates. */
+{
+  return gtk_tree_model_iter_n_children(GTK_TREE_MODEL(store), NULL);
+}
+
 static GtkListStore *main_primary_store(portfolio_packet *pkg) {
   metal *M = pkg->GetMetalClass();
   equity_folder *F = pkg->GetEquityFolderClass();
@@ -135,12 +449,33 @@ static GtkListStore *main_primary_store(portfolio_packet *pkg) {
   GtkListStore *store = NULL;
   GtkTreeIter iter;
   gboolean no_assets = TRUE;
+  primary_rows_t *rows = g_new(primary_rows_t, 1);
+
+  rows->layout = main_primary_layout(pkg);
+  for (guint8 g = 0; g < 4; g++)
+    rows->metal_row[g] = -1;
+  for (guint8 g = 0; g < G_MAXUINT8; g++)
+    rows->equity_row[g] = -1;
+  rows->cash_row = rows->bullion_total_row = -1;
+  rows->equity_total_row = rows->portfolio_row = -1;
 
   /* Set up the storage container with the number of columns and column type */
-  store = gtk_list_store_new(
-      MAIN_N_COLUMNS, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING,
-      G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING,
-      G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING);
+  if (NumericColumns()) {
+    GType types[MAIN_N_NUMERIC_COLUMNS];
+    for (guint8 g = 0; g < MAIN_N_COLUMNS; g++)
+      types[g] = G_TYPE_STRING;
+    for (guint8 g = MAIN_COLUMN_ONE; g < MAIN_N_COLUMNS; g++) {
+      types[MAIN_CELL_STYLE(g)] = G_TYPE_UINT;
+      types[MAIN_CELL_A(g)] = G_TYPE_DOUBLE;
+      types[MAIN_CELL_B(g)] = G_TYPE_DOUBLE;
+    }
+    store = gtk_list_store_newv(MAIN_N_NUMERIC_COLUMNS, types);
+  } else
+    store = gtk_list_store_new(
+        MAIN_N_COLUMNS, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING,
+        G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING,
+        G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING,
+        G_TYPE_STRING);
 
   /* Add data to the storage container. */
   if (M->bullion_port_value_f) {
@@ -160,17 +495,25 @@ static GtkListStore *main_primary_store(portfolio_packet *pkg) {
         headings_mkd->total, MAIN_COLUMN_NINE, headings_mkd->total_cost,
         MAIN_COLUMN_TEN, headings_mkd->total_gain, -1);
 
-    if (M->Gold->ounce_f)
+    if (M->Gold->ounce_f) {
+      rows->metal_row[0] = main_store_row(store);
       main_prmry_add_bul_store(M->Gold, "gold", store, &iter);
+    }
 
-    if (M->Palladium->ounce_f)
+    if (M->Palladium->ounce_f) {
+      rows->metal_row[1] = main_store_row(store);
       main_prmry_add_bul_store(M->Palladium, "palladium", store, &iter);
+    }
 
-    if (M->Platinum->ounce_f)
+    if (M->Platinum->ounce_f) {
+      rows->metal_row[2] = main_store_row(store);
       main_prmry_add_bul_store(M->Platinum, "platinum", store, &iter);
+    }
 
-    if (M->Silver->ounce_f)
+    if (M->Silver->ounce_f) {
+      rows->metal_row[3] = main_store_row(store);
       main_prmry_add_bul_store(M->Silver, "silver", store, &iter);
+    }
 
     gtk_list_store_append(store, &iter);
     gtk_list_store_set(store, &iter, MAIN_COLUMN_TYPE, "blank_space_primary",
@@ -217,20 +560,9 @@ static GtkListStore *main_primary_store(portfolio_packet *pkg) {
           }
         }
 
+        rows->equity_row[c] = main_store_row(store);
         gtk_list_store_append(store, &iter);
-        gtk_list_store_set(
-            store, &iter, MAIN_COLUMN_TYPE, "equity", MAIN_COLUMN_SYMBOL,
-            F->Equity[c]->symbol_stock_ch, MAIN_COLUMN_ONE,
-            F->Equity[c]->symbol_stock_mrkd_ch, MAIN_COLUMN_TWO,
-            F->Equity[c]->current_price_stock_mrkd_ch, MAIN_COLUMN_THREE,
-            F->Equity[c]->opening_stock_mrkd_ch, MAIN_COLUMN_FOUR,
-            F->Equity[c]->cost_mrkd_ch, MAIN_COLUMN_FIVE,
-            F->Equity[c]->range_mrkd_ch, MAIN_COLUMN_SIX,
-            F->Equity[c]->prev_closing_stock_mrkd_ch, MAIN_COLUMN_SEVEN,
-            F->Equity[c]->change_share_stock_mrkd_ch, MAIN_COLUMN_EIGHT,
-            F->Equity[c]->current_investment_stock_mrkd_ch, MAIN_COLUMN_NINE,
-            F->Equity[c]->total_cost_mrkd_ch, MAIN_COLUMN_TEN,
-            F->Equity[c]->total_gain_mrkd_ch, -1);
+        main_prmry_set_equity_row(F->Equity[c], store, &iter);
 
         c++;
       }
@@ -255,51 +587,32 @@ static GtkListStore *main_primary_store(portfolio_packet *pkg) {
   }
 
   if (D->cash_f) {
+    rows->cash_row = main_store_row(store);
     gtk_list_store_append(store, &iter);
-    gtk_list_store_set(store, &iter, MAIN_COLUMN_TYPE, "cash",
-                       MAIN_COLUMN_SYMBOL, "", MAIN_COLUMN_ONE,
-                       headings_mkd->cash, MAIN_COLUMN_TWO, D->cash_mrkd_ch,
-                       MAIN_COLUMN_FOUR, D->cash_cost_mrkd_ch, -1);
+    main_prmry_set_cash_row(pkg, store, &iter);
 
     no_assets = FALSE;
   }
 
   if (M->bullion_port_value_f) {
+    rows->bullion_total_row = main_store_row(store);
     gtk_list_store_append(store, &iter);
-
-    gtk_list_store_set(store, &iter, MAIN_COLUMN_TYPE, "bullion_total",
-                       MAIN_COLUMN_SYMBOL, "", MAIN_COLUMN_ONE,
-                       headings_mkd->bullion, MAIN_COLUMN_TWO,
-                       M->bullion_port_value_mrkd_ch, MAIN_COLUMN_THREE,
-                       M->bullion_port_day_gain_mrkd_ch, MAIN_COLUMN_FOUR,
-                       M->bullion_port_cost_mrkd_ch, MAIN_COLUMN_FIVE,
-                       M->bullion_port_total_gain_mrkd_ch, -1);
+    main_prmry_set_bul_total_row(pkg, store, &iter);
   }
 
   if (F->stock_port_value_f) {
+    rows->equity_total_row = main_store_row(store);
     gtk_list_store_append(store, &iter);
-    gtk_list_store_set(store, &iter, MAIN_COLUMN_TYPE, "equity_total",
-                       MAIN_COLUMN_SYMBOL, "", MAIN_COLUMN_ONE,
-                       headings_mkd->equity, MAIN_COLUMN_TWO,
-                       F->stock_port_value_mrkd_ch, MAIN_COLUMN_THREE,
-                       F->stock_port_day_gain_mrkd_ch, MAIN_COLUMN_FOUR,
-                       F->stock_port_cost_mrkd_ch, MAIN_COLUMN_FIVE,
-                       F->stock_port_total_gain_mrkd_ch, -1);
+    main_prmry_set_equity_total_row(pkg, store, &iter);
   }
 
   if (D->portfolio_value_f) {
     gtk_list_store_append(store, &iter);
     gtk_list_store_set(store, &iter, MAIN_COLUMN_TYPE, "blank_space_primary",
                        MAIN_COLUMN_SYMBOL, "", -1);
+    rows->portfolio_row = main_store_row(store);
     gtk_list_store_append(store, &iter);
-
-    gtk_list_store_set(store, &iter, MAIN_COLUMN_TYPE, "blank_space_primary",
-                       MAIN_COLUMN_SYMBOL, "", MAIN_COLUMN_ONE,
-                       headings_mkd->portfolio, MAIN_COLUMN_TWO,
-                       D->portfolio_value_mrkd_ch, MAIN_COLUMN_THREE,
-                       D->portfolio_day_gain_mrkd_ch, MAIN_COLUMN_FOUR,
-                       D->portfolio_cost_mrkd_ch, MAIN_COLUMN_FIVE,
-                       D->portfolio_total_gain_mrkd_ch, -1);
+    main_prmry_set_portfolio_row(pkg, store, &iter);
 
     gtk_list_store_append(store, &iter);
     gtk_list_store_set(store, &iter, MAIN_COLUMN_TYPE, "blank_space_primary",
@@ -313,6 +626,8 @@ static GtkListStore *main_primary_store(portfolio_packet *pkg) {
                        headings_mkd->no_assets, -1);
   }
 
+  g_object_set_data_full(G_OBJECT(store), "primary-rows", rows, g_free);
+
   /* Indicate that the default view is not displayed. */
   pkg->SetDefaultView(FALSE);
 
@@ -532,6 +847,12 @@ static void set_indices_labels(portfolio_packet *pkg) {
 
 gint MainPrimaryTreeview(gpointer pkg_data) {
   portfolio_packet *pkg = (portfolio_packet *)pkg_data;
+  gint64 start = TraceBegin();
+
+  /* The display strings are read without the ToStrings lock, keep their
+     arena generation. */
+  StrArenaReadBegin();
+
   /* Show the Indices Labels */
   show_indices(pkg);
 
@@ -545,7 +866,7 @@ gint MainPrimaryTreeview(gpointer pkg_data) {
   main_tree_view_clr();
 
   /* Set the columns for the new TreeView model */
-  main_set_columns(GUI_COLUMN_PRIMARY);
+  main_set_columns(GUI_COLUMN_PRIMARY, pkg);
 
   /* Set up the storage container */
   store = main_primary_store(pkg);
@@ -560,6 +881,149 @@ gint MainPrimaryTreeview(gpointer pkg_data) {
   /* Remove Grid Lines. */
   gtk_tree_view_set_grid_lines(GTK_TREE_VIEW(list),
                                GTK_TREE_VIEW_GRID_LINES_NONE);
+  StrArenaReadEnd();
+
+  TraceEnd("MainPrimaryTreeview", NULL, start);
+  return 0;
+}
+
+static void main_set_nth_row(GtkListStore *store, gint row,
+                             GtkTreeIter *iter, gboolean *found)
+/* Point iter at row, found is FALSE if there is no such row. */
+{
+  *found = row >= 0 && gtk_tree_model_iter_nth_child(GTK_TREE_MODEL(store),
+                                                     iter, NULL, row);
+}
+
+static gboolean main_primary_totals(portfolio_packet *pkg,
+                                    GtkListStore *store,
+                                    const primary_rows_t *rows)
+/* Set the rows a fetch cycle changes in place, FALSE if a row is not where
+   main_primary_store put it. */
+{
+  metal *M = pkg->GetMetalClass();
+  equity_folder *F = pkg->GetEquityFolderClass();
+  bullion *metals[4] = {M->Gold, M->Palladium, M->Platinum, M->Silver};
+  const gchar *names[4] = {"gold", "palladium", "platinum", "silver"};
+  GtkTreeIter iter;
+  gboolean found;
+  gchar *row_symbol = NULL;
+
+  for (guint8 g = 0; g < 4; g++) {
+    if (rows->metal_row[g] < 0)
+      continue;
+    main_set_nth_row(store, rows->metal_row[g], &iter, &found);
+    if (!found)
+      return FALSE;
+    main_prmry_set_bul_row(metals[g], names[g], store, &iter);
+  }
+
+  /* Only the equities this cycle's ToStrings converted, the streamed rows
+     were set as their transfers completed. */
+  for (guint8 c = 0; c < F->size; c++) {
+    if (F->Equity[c]->strings_pass != F->strings_pass)
+      continue;
+    main_set_nth_row(store, rows->equity_row[c], &iter, &found);
+    if (!found)
+      return FALSE;
+    gtk_tree_model_get(GTK_TREE_MODEL(store), &iter, MAIN_COLUMN_SYMBOL,
+                       &row_symbol, -1);
+    found = g_strcmp0(row_symbol, F->Equity[c]->symbol_stock_ch) == 0;
+    g_free(row_symbol);
+    if (!found)
+      return FALSE;
+    main_prmry_set_equity_row(F->Equity[c], store, &iter);
+  }
+
+  main_set_nth_row(store, rows->cash_row, &iter, &found);
+  if (found)
+    main_prmry_set_cash_row(pkg, store, &iter);
+
+  main_set_nth_row(store, rows->bullion_total_row, &iter, &found);
+  if (found)
+    main_prmry_set_bul_total_row(pkg, store, &iter);
+
+  main_set_nth_row(store, rows->equity_total_row, &iter, &found);
+  if (found)
+    main_prmry_set_equity_total_row(pkg, store, &iter);
+
+  main_set_nth_row(store, rows->portfolio_row, &iter, &found);
+  if (found)
+    main_prmry_set_portfolio_row(pkg, store, &iter);
+
+  return TRUE;
+}
+
+gint MainPrimaryTreeviewTotals(gpointer pkg_data)
+/* The end of a fetch cycle, update the indices, bullion, totals, and
+   unstreamed equity rows of the current primary treeview in place.
+
+   Rebuilds the view if it isn't the primary view or its rows moved. */
+{
+  portfolio_packet *pkg = (portfolio_packet *)pkg_data;
+  GtkWidget *list = GetWidget("MainTreeView");
+  GtkTreeModel *model = gtk_tree_view_get_model(GTK_TREE_VIEW(list));
+  primary_rows_t *rows = NULL;
+  gboolean updated = FALSE;
+
+  if (pkg->IsDefaultView())
+    return 0;
+
+  if (model)
+    rows = g_object_get_data(G_OBJECT(model), "primary-rows");
+  if (rows == NULL || rows->layout != main_primary_layout(pkg))
+    return MainPrimaryTreeview(pkg_data);
+
+  gint64 start = TraceBegin();
+  StrArenaReadBegin();
+  set_indices_labels(pkg);
+  updated = main_primary_totals(pkg, GTK_LIST_STORE(model), rows);
+  StrArenaReadEnd();
+  TraceEnd("MainPrimaryTreeviewTotals", NULL, start);
+
+  if (!updated)
+    return MainPrimaryTreeview(pkg_data);
+
+  return 0;
+}
+
+gint MainPrimaryTreeviewRow(gpointer pkg_symbol_data)
+/* Update one equity row of the current primary treeview, the portfolio
+   totals are set by MainPrimaryTreeviewTotals at the end of the fetch. */
+{
+  packet_symbol *data = (packet_symbol *)pkg_symbol_data;
+  portfolio_packet *pkg = (portfolio_packet *)data->pkg;
+  const gchar *symbol = data->symbol;
+  equity_folder *F = pkg->GetEquityFolderClass();
+  GtkWidget *list = GetWidget("MainTreeView");
+  GtkTreeModel *model = gtk_tree_view_get_model(GTK_TREE_VIEW(list));
+  GtkTreeIter iter;
+  gchar *type = NULL, *row_symbol = NULL;
+
+  if (model == NULL || pkg->IsDefaultView())
+    return 0;
+
+  MutexLock(&mutexes[CLASS_TOSTRINGS_MUTEX]);
+  stock *S = NULL;
+  for (guint8 c = 0; c < F->size && S == NULL; c++)
+    if (g_strcmp0(F->Equity[c]->symbol_stock_ch, symbol) == 0)
+      S = F->Equity[c];
+
+  gboolean valid = S && gtk_tree_model_get_iter_first(model, &iter);
+  while (valid) {
+    gtk_tree_model_get(model, &iter, MAIN_COLUMN_TYPE, &type,
+                       MAIN_COLUMN_SYMBOL, &row_symbol, -1);
+    gboolean found = g_strcmp0(type, "equity") == 0 &&
+                     g_strcmp0(row_symbol, symbol) == 0;
+    g_free(type);
+    g_free(row_symbol);
+    if (found) {
+      main_prmry_set_equity_row(S, GTK_LIST_STORE(model), &iter);
+      break;
+    }
+    valid = gtk_tree_model_iter_next(model, &iter);
+  }
+  g_mutex_unlock(&mutexes[CLASS_TOSTRINGS_MUTEX]);
 
   return 0;
 }
@@ -581,10 +1045,12 @@ gint MainDefaultTreeview(gpointer pkg_data) {
   main_tree_view_clr();
 
   /* Set the columns for the new TreeView model */
-  main_set_columns(GUI_COLUMN_DEFAULT);
+  main_set_columns(GUI_COLUMN_DEFAULT, pkg);
 
   /* Set up the storage container */
+  StrArenaReadBegin();
   store = main_default_store(pkg);
+  StrArenaReadEnd();
 
   /* Add the store of data to the TreeView. */
   gtk_tree_view_set_model(GTK_TREE_VIEW(list), GTK_TREE_MODEL(store));
@@ -671,6 +1137,9 @@ gint MainHideWindows() {
   window = GetWidget("HotkeysWindow");
   gtk_widget_set_visible(window, FALSE);
 
+  window = GetWidget("DiagnosticsWindow");
+  gtk_widget_set_visible(window, FALSE);
+
   window = GetWidget("ApiWindow");
   gtk_widget_set_visible(window, FALSE);
 
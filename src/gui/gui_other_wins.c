@@ -510,4 +510,86 @@ gint HotkeysShowHide() {
     gtk_widget_set_visible(window, TRUE);
 
   return 0;
-}
\ No newline at end of file
+}
+
+static const gchar *diagnostics_col_names[DIAGNOSTICS_N_COLUMNS] = {
+    "Scope",   "Host / Symbol", "Requests", "Failed", "p50 ms",
+    "p95 ms",  "p99 ms",        "Max ms",   "DNS ms", "Connect ms",
+    "TLS ms",  "TTFB ms",       "KiB"};
+
+gint DiagnosticsSetTreeview()
+/* Show the per host and per symbol request timing, slowest tail first. */
+{
+  GtkWidget *list = GetWidget("DiagnosticsTreeView");
+  GtkListStore *store = gtk_list_store_new(
+      DIAGNOSTICS_N_COLUMNS, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING,
+      G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING,
+      G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING,
+      G_TYPE_STRING, G_TYPE_STRING);
+  GtkTreeIter iter;
+  GPtrArray *rows = TelemetrySnapshot();
+  gchar *val_arr[DIAGNOSTICS_N_COLUMNS];
+
+  for (guint i = 0; i < rows->len; i++) {
+    const telemetry_row *r = g_ptr_array_index(rows, i);
+
+    val_arr[DIAGNOSTICS_COLUMN_SCOPE] = g_strdup(r->scope);
+    /* The columns are rendered as markup. */
+    val_arr[DIAGNOSTICS_COLUMN_KEY] = g_markup_escape_text(r->key, -1);
+    val_arr[DIAGNOSTICS_COLUMN_REQUESTS] =
+        g_strdup_printf("%" G_GUINT64_FORMAT, r->count);
+    val_arr[DIAGNOSTICS_COLUMN_FAILED] =
+        g_strdup_printf("%" G_GUINT64_FORMAT, r->failed);
+    val_arr[DIAGNOSTICS_COLUMN_P50] = g_strdup_printf("%.1f", r->p50_ms);
+    val_arr[DIAGNOSTICS_COLUMN_P95] = g_strdup_printf("%.1f", r->p95_ms);
+    val_arr[DIAGNOSTICS_COLUMN_P99] = g_strdup_printf("%.1f", r->p99_ms);
+    val_arr[DIAGNOSTICS_COLUMN_MAX] = g_strdup_printf("%.1f", r->max_ms);
+    val_arr[DIAGNOSTICS_COLUMN_DNS] = g_strdup_printf("%.1f", r->dns_ms);
+    val_arr[DIAGNOSTICS_COLUMN_CONNECT] =
+        g_strdup_printf("%.1f", r->connect_ms);
+    val_arr[DIAGNOSTICS_COLUMN_TLS] = g_strdup_printf("%.1f", r->tls_ms);
+    val_arr[DIAGNOSTICS_COLUMN_TTFB] = g_strdup_printf("%.1f", r->ttfb_ms);
+    val_arr[DIAGNOSTICS_COLUMN_KIB] = g_strdup_printf("%.1f", r->kib);
+
+    gtk_list_store_append(store, &iter);
+    for (gint c = 0; c < DIAGNOSTICS_N_COLUMNS; c++) {
+      gtk_list_store_set(store, &iter, c, val_arr[c], -1);
+      g_free(val_arr[c]);
+    }
+  }
+  g_ptr_array_unref(rows);
+
+  TreeViewClear(list);
+  for (gint c = 0; c < DIAGNOSTICS_N_COLUMNS; c++)
+    AddColumnToTreeview(diagnostics_col_names[c], c, list);
+
+  gtk_tree_view_set_model(GTK_TREE_VIEW(list), GTK_TREE_MODEL(store));
+  g_object_unref(store);
+
+  gtk_tree_view_set_headers_visible(GTK_TREE_VIEW(list), TRUE);
+  return 0;
+}
+
+gint DiagnosticsShowHide() {
+  GtkWidget *window = GetWidget("DiagnosticsWindow");
+  gboolean visible = gtk_widget_is_visible(window);
+
+  if (visible) {
+    gtk_widget_set_visible(window, FALSE);
+  } else {
+    DiagnosticsSetTreeview();
+    gtk_widget_set_visible(window, TRUE);
+  }
+
+  return 0;
+}
+
+gint DiagnosticsExport(portfolio_packet *pkg)
+/* Write the request timing histograms to the cache directory. */
+{
+  meta *D = pkg->GetMetaClass();
+  gchar *path = g_strconcat(D->cache_dir_ch, "/telemetry.csv", NULL);
+  TelemetryExportCsv(path);
+  g_free(path);
+  return 0;
+}
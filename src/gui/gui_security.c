@@ -104,7 +104,7 @@ static gpointer fetch_data_for_new_stock(gpointer data) {
   portfolio_packet *pkg = (portfolio_packet *)data;
   equity_folder *F = pkg->GetEquityFolderClass();
 
-  g_mutex_lock(&mutexes[CLASS_MEMBER_MUTEX]);
+  MutexLock(&mutexes[CLASS_MEMBER_MUTEX]);
 
   /* The new stock is currently at the end of the Equity array. */
   SetUpCurlHandle(F->Equity[F->size - 1]->easy_hnd, pkg->multicurl_main_hnd,
@@ -171,7 +171,7 @@ static void add_equity_to_folder(gchar *symbol, const gchar *shares,
 static gpointer add_security_ok_thd(gpointer data) {
   /* This mutex prevents the program from crashing if a
       MAIN_FETCH_BTN signal is run in parallel with this thread. */
-  g_mutex_lock(&mutexes[FETCH_DATA_MUTEX]);
+  MutexLock(&mutexes[FETCH_DATA_MUTEX]);
 
   /* Unpack the package */
   portfolio_packet *package = (portfolio_packet *)data;
@@ -188,14 +188,13 @@ static gpointer add_security_ok_thd(gpointer data) {
   g_free(symbol);
 
   g_mutex_unlock(&mutexes[FETCH_DATA_MUTEX]);
-  g_thread_exit(NULL);
   return NULL;
 }
 
 static gpointer remove_security_ok_thd(gpointer data) {
   /* This mutex prevents the program from crashing if a
      MAIN_FETCH_BTN signal is run in parallel with this thread. */
-  g_mutex_lock(&mutexes[FETCH_DATA_MUTEX]);
+  MutexLock(&mutexes[FETCH_DATA_MUTEX]);
 
   /* Unpack the package */
   portfolio_packet *pkg = (portfolio_packet *)data;
@@ -206,7 +205,7 @@ static gpointer remove_security_ok_thd(gpointer data) {
   gint index = gtk_combo_box_get_active(GTK_COMBO_BOX(ComboBox));
   if (index == 0) {
     g_mutex_unlock(&mutexes[FETCH_DATA_MUTEX]);
-    g_thread_exit(NULL);
+    return NULL;
   }
   if (index == 1) {
     SqliteEquityRemoveAll(D);
@@ -233,7 +232,6 @@ static gpointer remove_security_ok_thd(gpointer data) {
     gdk_threads_add_idle(MainPrimaryTreeview, data);
 
   g_mutex_unlock(&mutexes[FETCH_DATA_MUTEX]);
-  g_thread_exit(NULL);
   return NULL;
 }
 
@@ -241,15 +239,12 @@ gint SecurityOk(portfolio_packet *pkg) {
   GtkWidget *stack = GetWidget("SecurityStack");
   const gchar *name = gtk_stack_get_visible_child_name(GTK_STACK(stack));
 
-  GThread *g_thread_id;
   if (g_strcmp0(name, "add") == 0) {
-    /* Add the data in a separate thread */
-    g_thread_id = g_thread_new(NULL, add_security_ok_thd, pkg);
-    g_thread_unref(g_thread_id);
+    /* Add the data on the worker pool */
+    TaskSubmit(TASK_LANE_IO, TASK_NONE, add_security_ok_thd, pkg, NULL);
   } else {
-    /* Remove the data in a separate thread */
-    g_thread_id = g_thread_new(NULL, remove_security_ok_thd, pkg);
-    g_thread_unref(g_thread_id);
+    /* Remove the data on the worker pool */
+    TaskSubmit(TASK_LANE_IO, TASK_NONE, remove_security_ok_thd, pkg, NULL);
   }
   return 0;
 }
@@ -34,27 +34,6 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "../include/mutex.h"     /* GMutex mutexes */
 #include "../include/workfuncs.h" /* includes class_types.h [portfolio_packet, meta, etc] */
 
-static gboolean cond_sleep(GCond *cond_var, GMutex *mutex, gint64 wait_time) {
-  g_mutex_lock(mutex);
-  wait_time += g_get_monotonic_time();
-  /* Sleep */
-  if (g_cond_wait_until(cond_var, mutex, wait_time)) {
-    /* if cond signaled */
-    g_mutex_unlock(mutex);
-    return TRUE;
-  }
-
-  g_mutex_unlock(mutex);
-  return FALSE;
-}
-
-static void cancel_thread(GCond *cond_var, GMutex *mutex) {
-  /* Signal thread to exit. */
-  g_mutex_lock(mutex);
-  g_cond_signal(cond_var);
-  g_mutex_unlock(mutex);
-}
-
 static gint64 main_fetch_iter(portfolio_packet *pkg) {
   /* The number of microseconds between data fetch operations. */
   if (pkg->GetUpdatesPerMinute() <= 0.0f) {
@@ -64,40 +43,12 @@ static gint64 main_fetch_iter(portfolio_packet *pkg) {
   }
 }
 
-static gboolean main_fetch_sleep_init(gint64 start_curl,
-                                      portfolio_packet *pkg) {
-  meta *D = pkg->GetMetaClass();
-  gint64 micro_sec_per_iter = main_fetch_iter(pkg);
-  gint64 wait_time;
-
-  /* Find out how long cURL processing took. */
-  gint64 curl_proc_time = g_get_monotonic_time() - start_curl;
-
-  if (curl_proc_time < micro_sec_per_iter) {
-    /* Wait this many microseconds, accounts for cURL processing time. */
-    wait_time = micro_sec_per_iter - curl_proc_time;
-    return cond_sleep(&D->gthread_main_fetch_cond,
-                      &mutexes[FETCH_DATA_COND_MUTEX], wait_time);
-  } else if (micro_sec_per_iter == 0) {
-    /* Continuous updating for an unlimited number of API calls
-       per minute [subscription accounts]. */
-    wait_time = G_TIME_SPAN_SECOND;
-    return cond_sleep(&D->gthread_main_fetch_cond,
-                      &mutexes[FETCH_DATA_COND_MUTEX], wait_time);
-  }
-
-  /* Continue loop without sleeping */
-  return FALSE;
-}
-
-static gboolean main_fetch_awakens(gint64 start_curl, portfolio_packet *pkg) {
-  /* If hours to update is zero, the market is closed, or fetching was canceled;
-   * exit thread before sleep. */
-  if (!pkg->GetHoursOfUpdates() || pkg->IsClosed() || !pkg->IsFetchingData())
-    return TRUE;
-
-  /* sleep, returns TRUE if cond signalled */
-  return main_fetch_sleep_init(start_curl, pkg);
+static guint main_fetch_period(portfolio_packet *pkg) {
+  /* The fetch timer period in seconds, continuous updating for an unlimited
+     number of API calls per minute [subscription accounts] is once a
+     second. */
+  gint64 period_s = main_fetch_iter(pkg) / G_TIME_SPAN_SECOND;
+  return period_s > 0 ? (guint)period_s : 1;
 }
 
 static gint64 main_fetch_length(portfolio_packet *pkg) {
@@ -114,7 +65,23 @@ static gboolean main_fetch_check(gint64 start_fetch, portfolio_packet *pkg) {
   return FALSE;
 }
 
-static void main_fetch_exit(portfolio_packet *pkg) {
+static gboolean main_fetch_closed(portfolio_packet *pkg)
+/* The fixed schedule's session ends at the NYSE close, the adaptive one at
+   the end of the equities' extended hours. */
+{
+  if (AdaptiveRefresh())
+    return !RefreshSessionOpen(g_get_real_time() / G_USEC_PER_SEC);
+  return pkg->IsClosed();
+}
+
+static void main_fetch_stop(portfolio_packet *pkg)
+/* End the fetch session.  Call with FETCH_CYCLE_MUTEX held. */
+{
+  meta *D = pkg->GetMetaClass();
+
+  TimerRemove(D->main_fetch_timer_id);
+  D->main_fetch_timer_id = 0;
+
   pkg->FreeMainCurlData();
 
   /* Reset FetchingData flag. */
@@ -125,141 +92,174 @@ static void main_fetch_exit(portfolio_packet *pkg) {
 
   /* Reset Fetch Button label. */
   gdk_threads_add_idle(MainFetchBTNLabel, pkg);
-  g_thread_exit(NULL);
 }
 
-static gpointer main_fetch_thd(gpointer pkg_data) {
+static gpointer main_fetch_cycle(gpointer pkg_data)
+/* One refresh of the fetch session, on the fetch lane.  The session's timer
+   submits one each period, a cycle running late delays the next. */
+{
   portfolio_packet *pkg = (portfolio_packet *)pkg_data;
+  meta *D = pkg->GetMetaClass();
 
-  gdk_threads_add_idle(MainFetchBTNLabel, pkg);
-
-  gint64 start_fetch = g_get_monotonic_time();
-  gint64 start_curl;
+  MutexLock(&mutexes[FETCH_CYCLE_MUTEX]);
+  gint64 start_curl = g_get_monotonic_time();
+
+  /* The session ended, or a late cycle already used this period [the timer
+     fires on the period's boundaries, the first cycle ran at the button
+     press]. */
+  if (D->main_fetch_timer_id == 0 ||
+      (!AdaptiveRefresh() && start_curl - D->main_fetch_cycle_start <
+                                 main_fetch_iter(pkg) - G_TIME_SPAN_SECOND)) {
+    g_mutex_unlock(&mutexes[FETCH_CYCLE_MUTEX]);
+    return NULL;
+  }
+  D->main_fetch_cycle_start = start_curl;
+
+  /* Follow the updates per minute, if changed in the preferences during the
+     session [the adaptive refresh reads them in PlanRefresh]. */
+  if (!AdaptiveRefresh())
+    TimerSetPeriod(D->main_fetch_timer_id, main_fetch_period(pkg));
+
+  /* Canceled [or exiting] since the last cycle. */
+  if (!pkg->IsFetchingData()) {
+    main_fetch_stop(pkg);
+    g_mutex_unlock(&mutexes[FETCH_CYCLE_MUTEX]);
+    return NULL;
+  }
 
-  do {
-    start_curl = g_get_monotonic_time();
+  /* With the adaptive refresh the timer fires each second, a cycle fetches
+     the quotes due [none skips it, unless the session is over]. */
+  if (AdaptiveRefresh() && !pkg->PlanRefresh(main_fetch_period(pkg))) {
+    if (main_fetch_closed(pkg) ||
+        !main_fetch_check(D->main_fetch_start, pkg))
+      main_fetch_stop(pkg);
+    g_mutex_unlock(&mutexes[FETCH_CYCLE_MUTEX]);
+    return NULL;
+  }
 
-    /* This mutex prevents the program from crashing if an
-       MAIN_EXIT, SECURITY_OK_BTN, or API_OK_BTN thread is run
-       concurrently with this thread. */
-    g_mutex_lock(&mutexes[FETCH_DATA_MUTEX]);
-    if (pkg->GetData()) {
-      g_mutex_unlock(&mutexes[FETCH_DATA_MUTEX]);
-      break;
-    }
+  /* This mutex prevents the program from crashing if an
+     MAIN_EXIT, SECURITY_OK_BTN, or API_OK_BTN thread is run
+     concurrently with this thread. */
+  MutexLock(&mutexes[FETCH_DATA_MUTEX]);
+  if (pkg->GetData()) {
     g_mutex_unlock(&mutexes[FETCH_DATA_MUTEX]);
+    MetricsFetchCycle(g_get_monotonic_time() - start_curl, TRUE);
+    main_fetch_stop(pkg);
+    g_mutex_unlock(&mutexes[FETCH_CYCLE_MUTEX]);
+    return NULL;
+  }
+  g_mutex_unlock(&mutexes[FETCH_DATA_MUTEX]);
 
-    /* Reset the progressbar */
-    gdk_threads_add_idle(MainProgBarReset, NULL);
+  /* Reset the progressbar */
+  gdk_threads_add_idle(MainProgBarReset, NULL);
 
-    pkg->ExtractData();
-    pkg->Calculate();
-    pkg->ToStrings();
+  pkg->ExtractData();
+  pkg->Calculate();
+  pkg->ToStrings();
+  MetricsFetchCycle(g_get_monotonic_time() - start_curl, FALSE);
 
-    /* Set Gtk treeview. */
-    gdk_threads_add_idle(MainPrimaryTreeview, pkg);
+  /* Set the totals, the streamed rows are already set. */
+  gdk_threads_add_idle(MainPrimaryTreeviewTotals, pkg);
 
-    if (main_fetch_awakens(start_curl, pkg))
-      break;
-  } while (main_fetch_check(start_fetch, pkg));
+  /* If hours to update is zero, the market is closed [the adaptive refresh
+     runs through the extended hours], fetching was canceled, or the hours
+     to update have passed; end the session. */
+  if (!pkg->GetHoursOfUpdates() || main_fetch_closed(pkg) ||
+      !pkg->IsFetchingData() || !main_fetch_check(D->main_fetch_start, pkg))
+    main_fetch_stop(pkg);
 
-  main_fetch_exit(pkg);
+  g_mutex_unlock(&mutexes[FETCH_CYCLE_MUTEX]);
   return NULL;
 }
 
+static gboolean main_fetch_timer(gpointer pkg_data)
+/* The fetch session's timer, the cycle runs on the fetch lane. */
+{
+  TaskSubmit(TASK_LANE_FETCH, TASK_COALESCE, main_fetch_cycle, pkg_data,
+             NULL);
+  return TRUE;
+}
+
 gpointer GUIThreadHandler_main_fetch(gpointer pkg_data)
-/* A thread that handles the main_fetch_thd thread. */
+/* A thread that starts and stops the fetch session. */
 {
   if (!g_mutex_trylock(&mutexes[FETCH_DATA_HANDLER_MUTEX]))
-    g_thread_exit(NULL);
+    return NULL;
 
   portfolio_packet *pkg = (portfolio_packet *)pkg_data;
   meta *D = pkg->GetMetaClass();
 
-  /* If the main_fetch_thd thread is currently running. */
+  /* If a fetch session is currently running. */
   if (pkg->IsFetchingData()) {
     /* Reset FetchingData flag. */
     pkg->SetFetchingData(FALSE);
-
-    /* Exit fetching data thread. */
-    cancel_thread(&D->gthread_main_fetch_cond, &mutexes[FETCH_DATA_COND_MUTEX]);
     pkg->StopMultiCurlMain();
-    g_thread_join(D->gthread_main_fetch_id);
 
-    /* If the main_fetch_thd is not running. */
+    /* Wait for a running cycle, then end the session [unless the cycle
+       ended it]. */
+    MutexLock(&mutexes[FETCH_CYCLE_MUTEX]);
+    if (D->main_fetch_timer_id)
+      main_fetch_stop(pkg);
+    g_mutex_unlock(&mutexes[FETCH_CYCLE_MUTEX]);
+
+    /* If a fetch session is not running. */
   } else {
-    /* This flag needs to be set TRUE before g_thread_new. */
+    /* This flag needs to be set TRUE before the first cycle. */
     pkg->SetFetchingData(TRUE);
-
-    /* Create fetching data thread. */
-    g_cond_clear(&D->gthread_main_fetch_cond);
-    g_cond_init(&D->gthread_main_fetch_cond);
-    D->gthread_main_fetch_id = g_thread_new(NULL, main_fetch_thd, pkg_data);
+    gdk_threads_add_idle(MainFetchBTNLabel, pkg);
+
+    /* The first cycle now, the timer paces the rest. */
+    MutexLock(&mutexes[FETCH_CYCLE_MUTEX]);
+    D->main_fetch_start = g_get_monotonic_time();
+    D->main_fetch_cycle_start = 0;
+    D->main_fetch_timer_id = TimerAdd(
+        AdaptiveRefresh() ? 1 : main_fetch_period(pkg), main_fetch_timer,
+        pkg_data);
+    g_mutex_unlock(&mutexes[FETCH_CYCLE_MUTEX]);
+    TaskSubmit(TASK_LANE_FETCH, TASK_NONE, main_fetch_cycle, pkg_data, NULL);
   }
 
   g_mutex_unlock(&mutexes[FETCH_DATA_HANDLER_MUTEX]);
-  g_thread_exit(NULL);
   return NULL;
 }
 
-gpointer GUIThread_clock(gpointer pkg_data) {
-  /*
-     Set the wallclock to the NY time.
-     Display whether the market is open or closed,
-     time remaining until closed, or if it is a holiday.
-  */
+gboolean GUITimer_clock(gpointer pkg_data)
+/* Set the wallclock to the NY time.
+   Display whether the market is open or closed,
+   time remaining until closed, or if it is a holiday.
+
+   Every second while the market is open, on the minute while it's closed
+   [including holidays and the early closes]. */
+{
   portfolio_packet *pkg = (portfolio_packet *)pkg_data;
   meta *D = pkg->GetMetaClass();
-  gint64 wait_time;
-
-  /* If there were a blocking variation of gdk_threads_add_idle, we could
-     structure this more rigidly. For the time being we will assume the
-     market_closed_bool flag is always set within the current second. */
-  while (D->clocks_displayed_bool) {
-    gdk_threads_add_idle(MainSetClocks, pkg_data);
-
-    /* Set Sleep until the end of the current second. */
-    wait_time = ClockSleepSecond();
-
-    if (cond_sleep(&D->gthread_clocks_cond, &mutexes[CLOCKS_COND_MUTEX],
-                   wait_time))
-      break;
-
-    /* Will take into account holidays,
-       including the black friday early close.
-       Updated in MainSetClocks() */
-    if (D->market_closed_bool) {
 
-      /* Set Sleep until the end of the current minute. */
-      wait_time = ClockSleepMinute();
-
-      if (cond_sleep(&D->gthread_clocks_cond, &mutexes[CLOCKS_COND_MUTEX],
-                     wait_time))
-        break;
-    }
-  }
+  if (!D->clocks_displayed_bool)
+    return FALSE;
 
-  g_thread_exit(NULL);
-  return NULL;
+  gdk_threads_add_idle(MainSetClocks, pkg_data);
+  TimerSetPeriod(D->clocks_timer_id,
+                 GetTimeData(NULL, NULL, NULL, NULL, NULL, NULL, NULL) ? 60
+                                                                       : 1);
+  return TRUE;
 }
 
 gpointer GUIThreadHandler_clock(gpointer pkg_data)
-/* A thread that handles the clock thread. */
+/* A thread that adds and removes the clock timer. */
 {
   if (!g_mutex_trylock(&mutexes[CLOCKS_HANDLER_MUTEX]))
-    g_thread_exit(NULL);
+    return NULL;
 
   portfolio_packet *pkg = (portfolio_packet *)pkg_data;
   meta *D = pkg->GetMetaClass();
 
-  /* If the clock thread is currently running. */
+  /* If the clock timer is currently running. */
   if (pkg->IsClockDisplayed()) {
     pkg->SetClockDisplayed(FALSE);
 
-    /* Exit clock thread. */
-    cancel_thread(&D->gthread_clocks_cond, &mutexes[CLOCKS_COND_MUTEX]);
-    g_thread_join(D->gthread_clocks_id);
-    g_cond_clear(&D->gthread_clocks_cond);
+    /* Remove the clock timer. */
+    TimerRemove(D->clocks_timer_id);
+    D->clocks_timer_id = 0;
 
     /* Hide revealer */
     gdk_threads_add_idle(MainHideClocks, NULL);
@@ -267,14 +267,14 @@ gpointer GUIThreadHandler_clock(gpointer pkg_data)
     /* Make sure the pref window clock switch is set correctly. */
     gdk_threads_add_idle(PrefSetClockSwitch, pkg_data);
 
-    /* If the clock thread is not running. */
+    /* If the clock timer is not running. */
   } else {
-    /* This flag needs to be set TRUE before g_thread_new. */
+    /* This flag needs to be set TRUE before the first tick. */
     pkg->SetClockDisplayed(TRUE);
 
-    /* Create clock thread. */
-    g_cond_init(&D->gthread_clocks_cond);
-    D->gthread_clocks_id = g_thread_new(NULL, GUIThread_clock, pkg_data);
+    /* Add the clock timer, set the clocks until its first tick. */
+    D->clocks_timer_id = TimerAdd(1, GUITimer_clock, pkg_data);
+    gdk_threads_add_idle(MainSetClocks, pkg_data);
 
     /* Show revealer */
     gdk_threads_add_idle(MainDisplayClocks, NULL);
@@ -284,7 +284,6 @@ gpointer GUIThreadHandler_clock(gpointer pkg_data)
   }
 
   g_mutex_unlock(&mutexes[CLOCKS_HANDLER_MUTEX]);
-  g_thread_exit(NULL);
   return NULL;
 }
 
@@ -301,20 +300,18 @@ gpointer GUIThread_recalculate(gpointer pkg_data) {
     gdk_threads_add_idle(MainPrimaryTreeview, pkg);
   }
 
-  g_thread_exit(NULL);
   return NULL;
 }
 
 gpointer GUIThread_api_ok(gpointer pkg_data) {
   portfolio_packet *pkg = (portfolio_packet *)pkg_data;
 
-  g_mutex_lock(&mutexes[FETCH_DATA_MUTEX]);
+  MutexLock(&mutexes[FETCH_DATA_MUTEX]);
 
   APIOk(pkg);
 
   g_mutex_unlock(&mutexes[FETCH_DATA_MUTEX]);
 
-  g_thread_exit(NULL);
   return NULL;
 }
 
@@ -328,7 +325,7 @@ gpointer GUIThread_bul_fetch(gpointer pkg_data) {
     num_metals++;
 
   /* Ensures that pkg->multicurl_main_hnd is free to use. */
-  g_mutex_lock(&mutexes[CLASS_MEMBER_MUTEX]);
+  MutexLock(&mutexes[CLASS_MEMBER_MUTEX]);
 
   /* This func doesn't have a mutex. */
   M->SetUpCurl(pkg);
@@ -358,7 +355,6 @@ gpointer GUIThread_bul_fetch(gpointer pkg_data) {
   /* Update the main window treeview. */
   gdk_threads_add_idle(MainPrimaryTreeview, pkg_data);
 
-  g_thread_exit(NULL);
   return NULL;
 }
 
@@ -375,8 +371,6 @@ static void history_fetch_exit(history_cleanup *hist_data) {
 
   if (hist_data->symbol)
     g_free(hist_data->symbol);
-
-  g_thread_exit(NULL);
 }
 
 void dstry_notify_func_string_font(gpointer string_font_data) {
@@ -406,7 +400,7 @@ gpointer GUIThread_history_fetch(gpointer pkg_data) {
   GtkListStore *store = NULL;
 
   /* Prevents concurrent history fetch requests. */
-  g_mutex_lock(&mutexes[HISTORY_FETCH_MUTEX]);
+  MutexLock(&mutexes[HISTORY_FETCH_MUTEX]);
 
   /* Get the symbol string */
   HistoryGetSymbol(&hstry_data.symbol);
@@ -418,6 +412,13 @@ gpointer GUIThread_history_fetch(gpointer pkg_data) {
 
   /* Perform multicurl. */
   hstry_data.HistoryOutput = HistoryFetchData(hstry_data.symbol, pkg);
+  /* A newer history request supersedes this one. */
+  if (TaskCancelled() && hstry_data.HistoryOutput) {
+    g_mutex_unlock(&mutexes[HISTORY_FETCH_MUTEX]);
+    dstry_notify_func_string_font(str_font_container);
+    history_fetch_exit(&hstry_data);
+    return NULL;
+  }
   if (pkg->IsExitingApp() || hstry_data.HistoryOutput == NULL) {
     gdk_threads_add_idle(HistoryTreeViewClear, NULL);
     /* The str_font_container is freed in dstry_notify_func_string_font */
@@ -426,14 +427,18 @@ gpointer GUIThread_history_fetch(gpointer pkg_data) {
                               dstry_notify_func_string_font);
     g_mutex_unlock(&mutexes[HISTORY_FETCH_MUTEX]);
     history_fetch_exit(&hstry_data);
+    return NULL;
   }
 
   /* Clear the current TreeView model */
   gdk_threads_add_idle(HistoryTreeViewClear, NULL);
 
-  /* Perform calculations and set the liststore. */
+  /* Perform calculations and set the liststore [its markup uses the font's
+     span templates, SetFont swaps them under the ToStrings lock]. */
+  MutexLock(&mutexes[CLASS_TOSTRINGS_MUTEX]);
   store = HistoryMakeStore(hstry_data.HistoryOutput->memory,
                            hstry_data.HistoryOutput->size);
+  g_mutex_unlock(&mutexes[CLASS_TOSTRINGS_MUTEX]);
 
   /* Set and display the history treeview model. */
   /* dstry_notify_func_store will unref the store */
@@ -480,7 +485,7 @@ gpointer GUIThread_pref_sym_update(gpointer pkg_data) {
       g_free(sym_map);
     }
     pkg->SetSymNameMap(NULL);
-    g_thread_exit(NULL);
+    return NULL;
   }
 
   if (sym_map) {
@@ -503,7 +508,6 @@ gpointer GUIThread_pref_sym_update(gpointer pkg_data) {
       gdk_threads_add_idle(MainDefaultTreeview, pkg);
   }
 
-  g_thread_exit(NULL);
   return NULL;
 }
 
@@ -518,7 +522,7 @@ gpointer GUIThread_completion_set(gpointer pkg_data) {
   pkg->SetSymNameMap(sym_map);
 
   if (pkg->IsExitingApp())
-    g_thread_exit(NULL);
+    return NULL;
 
   /* Destroy the sn_map after setting the two widgets
    * [dstry_notify_func_snmap()]. */
@@ -529,10 +533,19 @@ gpointer GUIThread_completion_set(gpointer pkg_data) {
     pkg->SetSymNameMap(NULL);
   }
 
-  g_thread_exit(NULL);
   return NULL;
 }
 
+static void main_exit_window_state(portfolio_packet *pkg)
+/* The maximized states are saved with the app data. */
+{
+  meta *D = pkg->GetMetaClass();
+  D->window_struct.main_win_maximized_bool =
+      gtk_window_is_maximized(GTK_WINDOW(GetGObject("MainWindow")));
+  D->window_struct.histry_win_maximized_bool =
+      gtk_window_is_maximized(GTK_WINDOW(GetGObject("HistoryWindow")));
+}
+
 static void main_exit_set_flags(portfolio_packet *pkg) {
   if (pkg->IsFetchingData()) {
     pkg->SetFetchingData(FALSE);
@@ -546,6 +559,72 @@ static void main_exit_set_flags(portfolio_packet *pkg) {
   pkg->StopMultiCurlAll();
 }
 
+gpointer GUIThread_flush(gpointer pkg_data) {
+  portfolio_packet *pkg = (portfolio_packet *)pkg_data;
+
+  /* Skip this flush if a fetch or a settings change holds the data, the
+     next period saves it. */
+  if (!g_mutex_trylock(&mutexes[FETCH_DATA_MUTEX]))
+    return NULL;
+
+  if (!pkg->IsExitingApp())
+    pkg->SaveSqlData();
+
+  g_mutex_unlock(&mutexes[FETCH_DATA_MUTEX]);
+  return NULL;
+}
+
+gboolean GUITimer_flush(gpointer pkg_data) {
+  TaskSubmit(TASK_LANE_IO, TASK_COALESCE, GUIThread_flush, pkg_data, NULL);
+  return TRUE;
+}
+
+gpointer GUIThread_warmup(gpointer pkg_data) {
+  portfolio_packet *pkg = (portfolio_packet *)pkg_data;
+
+  /* A running fetch cycle or session already holds warm connections. */
+  if (!g_mutex_trylock(&mutexes[FETCH_CYCLE_MUTEX]))
+    return NULL;
+  if (pkg->IsFetchingData() || pkg->IsExitingApp()) {
+    g_mutex_unlock(&mutexes[FETCH_CYCLE_MUTEX]);
+    return NULL;
+  }
+
+  /* One cycle through the main multi handle resolves and connects the
+     quote hosts, its connection cache keeps them for the first refresh of
+     the session.  The previous closes are shown before the open. */
+  MutexLock(&mutexes[FETCH_DATA_MUTEX]);
+  gint64 start = TraceBegin();
+  gint ret = pkg->GetData();
+  TraceEnd("Warmup", NULL, start);
+  g_mutex_unlock(&mutexes[FETCH_DATA_MUTEX]);
+
+  gdk_threads_add_idle(MainProgBarReset, NULL);
+  if (ret == 0) {
+    pkg->ExtractData();
+    pkg->Calculate();
+    pkg->ToStrings();
+    gdk_threads_add_idle(MainPrimaryTreeview, pkg);
+  }
+
+  g_mutex_unlock(&mutexes[FETCH_CYCLE_MUTEX]);
+  return NULL;
+}
+
+gboolean GUITimer_warmup(gpointer pkg_data) {
+  portfolio_packet *pkg = (portfolio_packet *)pkg_data;
+  meta *D = pkg->GetMetaClass();
+
+  TaskSubmit(TASK_LANE_FETCH, TASK_COALESCE, GUIThread_warmup, pkg_data,
+             NULL);
+
+  /* The next trading day's warm-up, this single shot timer is removed. */
+  gint64 now_s = g_get_real_time() / G_USEC_PER_SEC;
+  TimerAddAt(MarketNextOpen(now_s + D->warmup_lead_s) - D->warmup_lead_s,
+             GUITimer_warmup, pkg_data);
+  return FALSE;
+}
+
 gpointer GUIThread_main_exit(gpointer pkg_data) {
   portfolio_packet *pkg = (portfolio_packet *)pkg_data;
 
@@ -557,15 +636,16 @@ gpointer GUIThread_main_exit(gpointer pkg_data) {
   main_exit_set_flags(pkg);
 
   /* This mutex prevents the program from crashing if a
-     main_fetch_thd thread is run concurrently with this thread. */
-  g_mutex_lock(&mutexes[FETCH_DATA_MUTEX]);
+     fetch cycle is run concurrently with this thread. */
+  MutexLock(&mutexes[FETCH_DATA_MUTEX]);
 
   /* Save application data in Sqlite. */
+  main_exit_window_state(pkg);
   pkg->SaveSqlData();
 
   /* Hold the application until the Sqlite sym-name map thread is finished
    * [prevents db write errors]. */
-  g_mutex_lock(&mutexes[SYMBOL_NAME_MAP_SQLITE_MUTEX]);
+  MutexLock(&mutexes[SYMBOL_NAME_MAP_SQLITE_MUTEX]);
 
   /* Exit the GTK main loop. */
   gtk_main_quit();
@@ -573,6 +653,5 @@ gpointer GUIThread_main_exit(gpointer pkg_data) {
   g_mutex_unlock(&mutexes[SYMBOL_NAME_MAP_SQLITE_MUTEX]);
   g_mutex_unlock(&mutexes[FETCH_DATA_MUTEX]);
 
-  g_thread_exit(NULL);
   return NULL;
 }
\ No newline at end of file
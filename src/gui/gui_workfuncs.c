@@ -61,13 +61,14 @@ gint TreeViewClear(GtkWidget *treeview) {
 static GtkListStore *completion_set_store(symbol_name_map *sn_map) {
   if (sn_map == NULL)
     return NULL;
-  GtkListStore *store =
-      gtk_list_store_new(3, G_TYPE_STRING, G_TYPE_STRING, G_TYPE_STRING);
+  GtkListStore *store = gtk_list_store_new(4, G_TYPE_STRING, G_TYPE_STRING,
+                                           G_TYPE_STRING, G_TYPE_UINT);
   GtkTreeIter iter;
 
   gchar item[35];
   /* Populate the GtkListStore with the string of stock symbols in column 0,
-     stock names in column 1, and symbols & names in column 2. */
+     stock names in column 1, symbols & names in column 2, and the map
+     position [the trigram index row] in column 3. */
   for (gushort i = 0; i < sn_map->size; i++) {
     g_snprintf(item, 35, "%s - %s", sn_map->sn_container_arr[i]->symbol,
                sn_map->sn_container_arr[i]->security_name);
@@ -78,22 +79,17 @@ static GtkListStore *completion_set_store(symbol_name_map *sn_map) {
     /* Completion matches based off of the symbol or the company name, inserts
      * the symbol, displays both */
     gtk_list_store_set(store, &iter, 0, sn_map->sn_container_arr[i]->symbol, 1,
-                       sn_map->sn_container_arr[i]->security_name, 2, item, -1);
+                       sn_map->sn_container_arr[i]->security_name, 2, item, 3,
+                       (guint)i, -1);
   }
   return store;
 }
 
-static gboolean completion_match(GtkEntryCompletion *completion,
-                                 const gchar *key, GtkTreeIter *iter,
-                                 gpointer data) {
-  UNUSED(data)
-
-  GtkTreeModel *model = gtk_entry_completion_get_model(completion);
-  gchar *item_symb, *item_name;
-  /* We are finding matches based off of column 0 and 1, however,
-     we display column 2 in our 3 column model */
-  gtk_tree_model_get(model, iter, 0, &item_symb, 1, &item_name, -1);
-  gboolean ans = FALSE, symbol_match = TRUE, name_match = TRUE;
+gboolean CompletionPrefixMatch(const gchar *key, const gchar *item_symb,
+                               const gchar *item_name)
+/* TRUE if key is a case insensitive prefix of the symbol or the name. */
+{
+  gboolean symbol_match = TRUE, name_match = TRUE;
 
   gushort N = 0;
   while (key[N]) {
@@ -109,13 +105,38 @@ static gboolean completion_match(GtkEntryCompletion *completion,
   }
 
   /* if either the symbol or the name match the key value, return TRUE. */
-  ans = symbol_match || name_match;
+  return symbol_match || name_match;
+}
+
+static gboolean completion_match(GtkEntryCompletion *completion,
+                                 const gchar *key, GtkTreeIter *iter,
+                                 gpointer data) {
+  UNUSED(data)
+
+  GtkTreeModel *model = gtk_entry_completion_get_model(completion);
+  gchar *item_symb, *item_name;
+  /* We are finding matches based off of column 0 and 1, however,
+     we display column 2 in our 3 column model */
+  gtk_tree_model_get(model, iter, 0, &item_symb, 1, &item_name, -1);
+  gboolean ans = CompletionPrefixMatch(key, item_symb, item_name);
   g_free(item_symb);
   g_free(item_name);
 
   return ans;
 }
 
+static gboolean completion_index_match(GtkEntryCompletion *completion,
+                                       const gchar *key, GtkTreeIter *iter,
+                                       gpointer query_data) {
+  /* Substring and typo tolerant matching from the trigram index; the index
+     lookup runs once per key, each row is then a score array read. */
+  GtkTreeModel *model = gtk_entry_completion_get_model(completion);
+  guint pos;
+  gtk_tree_model_get(model, iter, 3, &pos, -1);
+
+  return SNQueryScore((symbol_name_query *)query_data, key, pos) > 0.0f;
+}
+
 gint CompletionSet(symbol_name_map *sn_map, guintptr gui_completion_sig) {
   if (sn_map == NULL)
     return 0;
@@ -131,8 +152,15 @@ gint CompletionSet(symbol_name_map *sn_map, guintptr gui_completion_sig) {
   gtk_entry_completion_set_model(completion, GTK_TREE_MODEL(store));
   g_object_unref(G_OBJECT(store));
 
-  gtk_entry_completion_set_match_func(
-      completion, (GtkEntryCompletionMatchFunc)completion_match, NULL, NULL);
+  /* Use the fuzzy index if it was built, otherwise prefix matching.
+     Each widget keeps its own lookup state, freed with the completion. */
+  if (sn_map->index)
+    gtk_entry_completion_set_match_func(
+        completion, (GtkEntryCompletionMatchFunc)completion_index_match,
+        SNQueryNew(sn_map->index), SNQueryFree);
+  else
+    gtk_entry_completion_set_match_func(
+        completion, (GtkEntryCompletionMatchFunc)completion_match, NULL, NULL);
 
   /* Set entrybox completion widget. */
   gtk_entry_set_completion(GTK_ENTRY(EntryBox), completion);
@@ -164,8 +192,6 @@ gint CompletionSet(symbol_name_map *sn_map, guintptr gui_completion_sig) {
 }
 
 void StartCompletionThread(portfolio_packet *pkg) {
-  GThread *g_thread_id;
-
   /* Set up the EntryBox Completion Widgets
      This will populate the symbol to name mapping,
      from an sqlite Db when the application loads.
@@ -173,11 +199,11 @@ void StartCompletionThread(portfolio_packet *pkg) {
      The list of symbol to name mappings need to be
      downloaded by the user [in the preferences window]
      if the db isn't already populated. */
-  g_thread_id = g_thread_new(NULL, GUIThread_completion_set, pkg);
-  g_thread_unref(g_thread_id);
+  TaskSubmit(TASK_LANE_IO, TASK_COALESCE, GUIThread_completion_set, pkg,
+             NULL);
 }
 
-void StartClockThread(portfolio_packet *pkg)
+void StartClockTimer(portfolio_packet *pkg)
 /* Set the initial display of the clocks.
    We don't want the revealer animation on startup. */
 {
@@ -185,12 +211,12 @@ void StartClockThread(portfolio_packet *pkg)
 
   GtkWidget *revealer = GetWidget("MainClockRevealer");
   if (pkg->IsClockDisplayed()) {
-    /* Start the clock thread. */
+    /* Add the clock timer. */
     /* gdk_threads_add_idle (in this thread) creates a pending event for the
        gtk_main loop. When the gtk_main loop starts the event will be processed.
     */
-    g_cond_init(&D->gthread_clocks_cond);
-    D->gthread_clocks_id = g_thread_new(NULL, GUIThread_clock, pkg);
+    D->clocks_timer_id = TimerAdd(1, GUITimer_clock, pkg);
+    gdk_threads_add_idle(MainSetClocks, pkg);
   }
 
   /* Revealer animation set to 0 milliseconds */
@@ -202,6 +228,31 @@ void StartClockThread(portfolio_packet *pkg)
   gtk_revealer_set_transition_duration(GTK_REVEALER(revealer), 300);
 }
 
+void StartFlushTimer(portfolio_packet *pkg)
+/* Save the application data every STATE_FLUSH_SEC, a crash loses at most
+   that much of the window and preference changes. */
+{
+  TimerAdd(STATE_FLUSH_SEC, GUITimer_flush, pkg);
+}
+
+void StartWarmupTimer(portfolio_packet *pkg)
+/* With FINANCIALS_WARMUP_SEC set, connect to the quote hosts and prefetch
+   the previous closes that many seconds before each open [at most
+   WARMUP_MAX_SEC]. */
+{
+  meta *D = pkg->GetMetaClass();
+  const gchar *lead_ch = g_getenv("FINANCIALS_WARMUP_SEC");
+  guint64 lead_s = lead_ch ? g_ascii_strtoull(lead_ch, NULL, 10) : 0;
+
+  if (lead_s == 0)
+    return;
+  D->warmup_lead_s = (guint)MIN(lead_s, WARMUP_MAX_SEC);
+
+  gint64 now_s = g_get_real_time() / G_USEC_PER_SEC;
+  TimerAddAt(MarketNextOpen(now_s + D->warmup_lead_s) - D->warmup_lead_s,
+             GUITimer_warmup, pkg);
+}
+
 static void set_widget_css(GtkWidget *widget, const gchar *css) {
   GtkCssProvider *css_provider = gtk_css_provider_new();
 
@@ -87,6 +87,22 @@ typedef struct {
   gchar *no_assets;
 } heading_str_t;
 
+/* The trading sessions the adaptive refresh follows. */
+enum { REFRESH_EQUITY, REFRESH_INDEX, REFRESH_FUTURES, REFRESH_CRYPTO };
+enum { REFRESH_CLOSED, REFRESH_EXTENDED, REFRESH_OPEN }; /* Their states. */
+
+typedef struct { /* A quote's adaptive refresh schedule. */
+  guint8 session;     /* One of the REFRESH_ sessions. */
+  guint8 state;       /* The session's state at the last plan. */
+  gboolean due_bool;  /* Fetched this cycle, TRUE unless a plan cleared it. */
+  gint64 fetch_s;     /* The last planned fetch, unix seconds. */
+  gint64 interval_s;  /* The planned refresh interval. */
+  gint64 price_s;     /* The last nonzero quote, */
+  gdouble price_f;    /* its value, */
+  gdouble vol_f;      /* and the moving average of the absolute log return
+                         per root second [0 until two quotes]. */
+} refresh_state;
+
 /* class type definitions */
 struct bullion {
   /* Data Variables */
@@ -128,6 +144,8 @@ struct bullion {
 
   CURL *YAHOO_hnd; /* Bullion cURL Easy Handle. */
   MemType CURLDATA;
+
+  refresh_state refresh; /* The futures session. */
 };
 
 struct metal {
@@ -208,6 +226,19 @@ struct stock {
 
   CURL *easy_hnd; /* cURL Easy Handle. */
   MemType JSON;
+
+  gboolean streamed_bool; /* Extracted and converted as its transfer
+                             completed, the cycle's ExtractData, Calculate,
+                             and ToStrings skip it [cleared after that
+                             ToStrings]. */
+  gboolean held_bool;     /* Not fetched this cycle [the adaptive refresh],
+                             the cycle's Calculate and ToStrings keep its
+                             values and strings [cleared after that
+                             ToStrings]. */
+  guint strings_pass;     /* The folder's ToStrings pass that last converted
+                             it [the GUI updates only those rows]. */
+
+  refresh_state refresh; /* The equity session, extended hours included. */
 };
 
 struct equity_folder {
@@ -225,6 +256,8 @@ struct equity_folder {
   /* Can have up to 255 stocks [0-254]: 8 bits. */
   guint8 size;
 
+  guint strings_pass; /* Counts the ToStrings passes. */
+
   /* Pango Markup language strings */
   gchar *stock_port_value_mrkd_ch;      /* Total value of equity holdings */
   gchar *stock_port_day_gain_mrkd_ch;   /* Total value of equity holdings day
@@ -238,6 +271,7 @@ struct equity_folder {
   void (*GenerateURL)(portfolio_packet *pkg);
   gint (*SetUpCurl)(portfolio_packet *pkg);
   void (*ExtractData)();
+  const gchar *(*ExtractStock)(CURL *hnd, guint8 digits_right);
   void (*AddStock)(const gchar *symbol, const gchar *shares, const gchar *cost);
   void (*Sort)();
   void (*Reset)();
@@ -252,6 +286,8 @@ struct meta {
                                  the main and rsi windows. */
 
   symbol_name_map *sym_map; /* The symbol to name mapping struct */
+  symbol_name_index *sym_index; /* The latest trigram index of the mapping,
+                                   the base of the next rebuild. */
 
   gdouble cash_f; /* Total value of cash */
 
@@ -321,6 +357,7 @@ struct meta {
   gchar *crypto_bitcoin_value_p_chg_ch;
 
   gchar *config_dir_ch;     /* Path to the application config directory */
+  gchar *cache_dir_ch;      /* Path to the application cache directory */
   gchar *sqlite_db_path_ch; /* Path to the sqlite db file */
   gchar *sqlite_symbol_name_db_path_ch; /* Path to the sqlite symbol-name db
                                            file */
@@ -329,6 +366,10 @@ struct meta {
   gboolean fetching_data_bool; /* Indicates a fetch operation in progress. */
   gboolean market_closed_bool; /* Indicates if the market is open or closed. */
   gboolean exit_app_bool; /* Indicates if we are exiting the application. */
+  gboolean headless_bool; /* Running without GTK [daemon or batch mode], no
+                             gui widgets are updated. */
+  GSourceFunc row_func;   /* Posts a streamed equity row to the main loop,
+                             set by the GUI [NULL without GTK]. */
   gboolean multicurl_cancel_main_bool; /* Indicates if we should cancel the
                                             main multicurl request. */
   gboolean index_bar_revealed_bool;    /* Indicates if the indices bar is
@@ -359,11 +400,18 @@ struct meta {
   MemType INDEX_SP_CURLDATA;
   MemType CRYPTO_BITCOIN_CURLDATA;
 
-  /* Thread Ids and cond variables */
-  GCond gthread_clocks_cond;
-  GCond gthread_main_fetch_cond;
-  GThread *gthread_clocks_id;
-  GThread *gthread_main_fetch_id;
+  refresh_state index_dow_refresh; /* The index sessions, and bitcoin's. */
+  refresh_state index_nasdaq_refresh;
+  refresh_state index_sp_refresh;
+  refresh_state crypto_bitcoin_refresh;
+
+  /* The timer wheel ids of the clocks and the fetch session, 0 if not
+     running. */
+  guint clocks_timer_id;
+  guint main_fetch_timer_id;
+  gint64 main_fetch_start;       /* Monotonic start of the fetch session, */
+  gint64 main_fetch_cycle_start; /* and of its latest cycle. */
+  guint warmup_lead_s; /* The pre-open warm-up lead, 0 if not enabled. */
 
   /* Methods/Function pointers. */
   void (*ToStringsPortfolio)();
@@ -402,6 +450,9 @@ struct portfolio_packet {
   void (*SetClosed)(gboolean closed_bool);
   gboolean (*IsExitingApp)();
   void (*SetExitingApp)(gboolean exiting_bool);
+  gboolean (*IsHeadless)();
+  void (*SetHeadless)(gboolean headless_bool);
+  void (*SetRowFunc)(GSourceFunc row_func);
   gboolean (*IsMainCurlCanceled)();
   void (*SetMainCurlCanceled)(gboolean canceled_bool);
   gdouble (*GetHoursOfUpdates)();
@@ -421,6 +472,7 @@ struct portfolio_packet {
   gboolean (*IsSnmapDbBusy)();
   void (*SetSnmapDbBusy)(gboolean busy_bool);
   void (*SetSecurityNames)();
+  guint (*PlanRefresh)(guint period_s);
 };
 
 #endif /* CLASS_TYPES_HEADER_H */
\ No newline at end of file
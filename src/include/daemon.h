@@ -0,0 +1,54 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+#ifndef DAEMON_HEADER_H
+#define DAEMON_HEADER_H
+
+#include "class_types.h" /* portfolio_packet */
+
+/* The Unix socket name, under $XDG_RUNTIME_DIR [or the config directory]. */
+#ifndef DAEMON_SOCKET_NAME
+#define DAEMON_SOCKET_NAME "financials.sock"
+#endif
+
+/* Concurrent connections, a subscriber holds one for its lifetime. */
+#ifndef DAEMON_MAX_CLIENTS
+#define DAEMON_MAX_CLIENTS 64
+#endif
+
+/* daemon */
+gchar *DaemonSnapshotJson(portfolio_packet *pkg, gint failed);
+gint DaemonRun(portfolio_packet *pkg, guint16 port);
+
+/* batch */
+gint BatchRun(portfolio_packet *pkg, const gchar *format_ch);
+
+#endif /* DAEMON_HEADER_H */
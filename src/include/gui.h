@@ -50,12 +50,18 @@ void AddColumnToTreeview(const gchar *col_name, const gint col_num,
                          GtkWidget *treeview);
 gint TreeViewClear(GtkWidget *treeview);
 gint CompletionSet(symbol_name_map *sn_map, guintptr gui_completion_sig);
+gboolean CompletionPrefixMatch(const gchar *key, const gchar *item_symb,
+                               const gchar *item_name);
 void StartCompletionThread(portfolio_packet *pkg);
-void StartClockThread(portfolio_packet *pkg);
+void StartClockTimer(portfolio_packet *pkg);
+void StartFlushTimer(portfolio_packet *pkg);
+void StartWarmupTimer(portfolio_packet *pkg);
 void SetLabelFonts(const gchar *font_str);
 
 /* gui_main */
 gint MainPrimaryTreeview(gpointer pkg_data);
+gint MainPrimaryTreeviewTotals(gpointer pkg_data);
+gint MainPrimaryTreeviewRow(gpointer pkg_symbol_data);
 gint MainDefaultTreeview(gpointer pkg_data);
 gint MainFetchBTNLabel(gpointer pkg_data);
 gint MainSetClocks(gpointer pkg_data);
@@ -91,6 +97,9 @@ gint AboutShowHide();
 void AboutSetLabel();
 gint HotkeysShowHide();
 void HotkeysSetTreeview();
+gint DiagnosticsShowHide();
+gint DiagnosticsSetTreeview();
+gint DiagnosticsExport(portfolio_packet *pkg);
 
 /* gui_history */
 gint HistoryShowHide(portfolio_packet *pkg);
@@ -124,7 +133,6 @@ gboolean GUICallback_main_treeview_click(GtkWidget *treeview,
 /* GUI Thread Functions */
 gpointer GUIThreadHandler_main_fetch(gpointer pkg_data);
 gpointer GUIThreadHandler_clock(gpointer pkg_data);
-gpointer GUIThread_clock(gpointer pkg_data);
 gpointer GUIThread_history_fetch(gpointer pkg_data);
 gpointer GUIThread_pref_sym_update(gpointer pkg_data);
 gpointer GUIThread_completion_set(gpointer pkg_data);
@@ -132,5 +140,12 @@ gpointer GUIThread_api_ok(gpointer pkg_data);
 gpointer GUIThread_recalculate(gpointer pkg_data);
 gpointer GUIThread_bul_fetch(gpointer pkg_data);
 gpointer GUIThread_main_exit(gpointer pkg_data);
+gpointer GUIThread_flush(gpointer pkg_data);
+gpointer GUIThread_warmup(gpointer pkg_data);
+
+/* GUI Timer Functions [timer wheel callbacks] */
+gboolean GUITimer_clock(gpointer pkg_data);
+gboolean GUITimer_flush(gpointer pkg_data);
+gboolean GUITimer_warmup(gpointer pkg_data);
 
 #endif /* GUI_HEADER_H */
\ No newline at end of file
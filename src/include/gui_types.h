@@ -40,9 +40,28 @@ typedef struct { /* A mapping between sec symbols and sec names */
   gchar *security_name;
 } symbol_to_security_name_container;
 
+typedef struct { /* A trigram index over the symbol-name mapping array. */
+  gchar **symbol_arr;        /* Lowercase symbols, by map position. */
+  gchar **text_arr;          /* Normalized "symbol name" strings. */
+  GArray **gram_arr;         /* Distinct trigrams of each text string. */
+  GHashTable *posting_table; /* A trigram to GArray of map positions. */
+  gushort size;
+  gint ref_count;
+} symbol_name_index;
+
+typedef struct { /* Per completion widget lookup state on a symbol_name_index */
+  symbol_name_index *index;
+  gchar *key;           /* The last key looked up. */
+  guint8 *hit_arr;      /* Shared trigram counts, by map position. */
+  gfloat *score_arr;    /* Match scores, by map position; 0 is no match. */
+  gushort *touched_arr; /* Map positions with a non-zero hit count. */
+  gushort touched_num;
+} symbol_name_query;
+
 typedef struct { /* A handle to the symbol-name mapping array. */
   symbol_to_security_name_container **sn_container_arr;
   GHashTable *hash_table;
+  symbol_name_index *index; /* Fuzzy lookup index, NULL if not built. */
   gushort size;
 } symbol_name_map;
 
@@ -52,6 +71,12 @@ typedef struct { /* A container to pass a string and a font name between
   gchar *font;
 } string_font;
 
+typedef struct { /* A container to pass the packet and a stock symbol to the
+                    gtk main loop */
+  gpointer pkg;
+  gchar *symbol;
+} packet_symbol;
+
 /* Window Signals */
 enum { GUI_MAIN_WINDOW, GUI_HISTORY_WINDOW };
 
@@ -78,6 +103,25 @@ enum {
   MAIN_N_COLUMNS
 };
 
+/* Main TreeView Numeric Cell Styles [FINANCIALS_NUMERIC_COLUMNS] */
+enum {
+  CELL_MARKUP, /* The column's markup string [headings, totals, bullion]. */
+  CELL_BLANK,
+  CELL_PRICE,  /* a, black. */
+  CELL_GREY,   /* a, grey. */
+  CELL_RANGE,  /* a - b, grey. */
+  CELL_CHANGE, /* a over b percent, colored by sign. */
+  CELL_TOTAL,  /* a over b, b colored by sign. */
+  CELL_SYMBOL  /* The row symbol over a shares. */
+};
+
+/* In the numeric mode each of MAIN_COLUMN_ONE to MAIN_COLUMN_TEN also has a
+   style, a, and b column after the markup columns. */
+#define MAIN_CELL_STYLE(col) (MAIN_N_COLUMNS + 3 * ((col)-MAIN_COLUMN_ONE))
+#define MAIN_CELL_A(col) (MAIN_CELL_STYLE(col) + 1)
+#define MAIN_CELL_B(col) (MAIN_CELL_STYLE(col) + 2)
+#define MAIN_N_NUMERIC_COLUMNS MAIN_CELL_STYLE(MAIN_N_COLUMNS)
+
 /* History TreeView Column Numbers */
 enum {
   HISTORY_COLUMN_ONE,
@@ -93,6 +137,24 @@ enum {
   HISTORY_N_COLUMNS
 };
 
+/* Diagnostics TreeView Column Numbers */
+enum {
+  DIAGNOSTICS_COLUMN_SCOPE,
+  DIAGNOSTICS_COLUMN_KEY,
+  DIAGNOSTICS_COLUMN_REQUESTS,
+  DIAGNOSTICS_COLUMN_FAILED,
+  DIAGNOSTICS_COLUMN_P50,
+  DIAGNOSTICS_COLUMN_P95,
+  DIAGNOSTICS_COLUMN_P99,
+  DIAGNOSTICS_COLUMN_MAX,
+  DIAGNOSTICS_COLUMN_DNS,
+  DIAGNOSTICS_COLUMN_CONNECT,
+  DIAGNOSTICS_COLUMN_TLS,
+  DIAGNOSTICS_COLUMN_TTFB,
+  DIAGNOSTICS_COLUMN_KIB,
+  DIAGNOSTICS_N_COLUMNS
+};
+
 /* Callback Index Signals */
 typedef enum {
   MAIN_FETCH_BTN,
@@ -118,6 +180,10 @@ typedef enum {
   HOTKEYS_TOGGLE_BTN,
   PREF_TOGGLE_BTN,
   PREF_SYMBOL_UPDATE_BTN,
+  TRACE_EXPORT_BTN,
+  DIAGNOSTICS_TOGGLE_BTN,
+  DIAGNOSTICS_REFRESH_BTN,
+  DIAGNOSTICS_EXPORT_BTN,
   SIGNAL_NUM
 } cb_signal;
 
@@ -71,6 +71,22 @@ POSSIBILITY OF SUCH DAMAGE.
 #define NEW_YORK_TIME_ZONE "America/New_York"
 #endif
 
+/* The timer wheel periods, in seconds, of the response cache expiry and
+ * the application data flush. */
+#ifndef HTTP_CACHE_EXPIRE_SEC
+#define HTTP_CACHE_EXPIRE_SEC 60
+#endif
+
+#ifndef STATE_FLUSH_SEC
+#define STATE_FLUSH_SEC 300
+#endif
+
+/* The longest pre-open warm-up lead, libcurl doesn't reuse a connection
+ * idle for more than 118 seconds. */
+#ifndef WARMUP_MAX_SEC
+#define WARMUP_MAX_SEC 110
+#endif
+
 /* The Yahoo! URL Macros are used by the GetYahooUrl ()
  * function */
 #ifndef YAHOO_URL_ONE
@@ -36,9 +36,56 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "multicurl_types.h" /* MemType, CURL, CURLM */
 
 /* Function Prototypes */
+
+/* http_cache */
+void HttpCacheInit(const gchar *dir);
+void HttpCacheDestruct();
+void HttpCacheExpire();
+gboolean HttpCacheLookup(const gchar *url, const gchar *cache_key,
+                         curl_write_callback write_func, gpointer data);
+void HttpCacheRequest(CURL *hnd, const gchar *url, const gchar *cache_key,
+                      curl_write_callback write_func, gpointer data);
+gushort HttpCacheFinish(CURL *hnd, CURLcode rc);
+void HttpCacheAbandon(CURL *hnd);
+void HttpCacheReport();
+gchar *HttpCacheUrlKey(const gchar *url);
+
+/* telemetry */
+void TelemetryRecord(CURL *hnd, CURLcode rc);
+void TelemetryDestruct();
+gint64 TelemetryHostPercentileUs(const gchar *url, gdouble p);
+GPtrArray *TelemetrySnapshot();
+gboolean TelemetryExportCsv(const gchar *path);
+void TelemetryPrometheus(GString *out);
+
+/* transport */
+void TransportInit();
+void TransportDestruct();
+void TransportSetBaseUrl(const gchar *url);
+gchar *TransportUrl(const gchar *url);
+gboolean TransportActive();
+gboolean TransportRecording();
+gboolean TransportReplaying();
+void TransportRecord(const gchar *url, CURLcode rc, glong code,
+                     gint64 start_us, gint64 duration_us, const gchar *body,
+                     gsize len);
+gboolean TransportReplayRequest(CURLM *mh, const gchar *url,
+                                curl_write_callback write_func,
+                                gpointer data);
+gushort TransportReplayPerform(CURLM *mh);
+
+/* multicurl */
+void SetMultiCurlProgressFunc(multicurl_progress_func progress_func);
 void FreeMemtype(MemType *mem_data);
 gpointer SetUpCurlHandle(CURL *hnd, CURLM *mh, gchar *url, MemType *output);
+gpointer SetUpCurlHandleValidated(CURL *hnd, CURLM *mh, gchar *url,
+                                  const gchar *cache_key, MemType *output);
+gpointer SetUpCurlHandleStream(CURL *hnd, CURLM *mh, gchar *url,
+                               const gchar *cache_key,
+                               curl_write_callback write_func, gpointer data);
 gushort PerformMultiCurl(CURLM *mh, gdouble size);
+gushort PerformMultiCurlStream(CURLM *mh, gdouble size,
+                               multicurl_done_func done_func, gpointer data);
 gushort PerformMultiCurl_no_prog(CURLM *mh);
 
 #endif /* MULTICURL_HEADER_H */
\ No newline at end of file
@@ -45,4 +45,65 @@ struct MemType {
   gchar *memory;
 };
 
+/* Called with each easy handle as its transfer completes successfully,
+   while the rest of the batch is still running. */
+typedef void (*multicurl_done_func)(CURL *hnd, gpointer data);
+
+/* Called with the completed fraction of a batch, the pointer outlives the
+   call [the GUI passes it to the main loop]. */
+typedef void (*multicurl_progress_func)(gdouble *fraction);
+
+/* Response cache URL classes, each has its own freshness lifetime. */
+enum {
+  HTTP_CLASS_NONE,
+  HTTP_CLASS_QUOTE,
+  HTTP_CLASS_RANGE,
+  HTTP_CLASS_HISTORY,
+  HTTP_CLASS_SYMBOL_LIST,
+  HTTP_CLASS_NUM
+};
+
+/* Latency histogram buckets, see telemetry.c */
+#define TELEMETRY_BUCKETS 14
+/* Transfers per host before its percentiles set the timeouts and hedging. */
+#define TELEMETRY_MIN_SAMPLES 20
+
+typedef struct { /* Network statistics for one host or symbol. */
+  const gchar *scope; /* "host" or "symbol" */
+  gchar *key;
+  guint64 count;
+  guint64 failed;
+  gdouble p50_ms;
+  gdouble p95_ms;
+  gdouble p99_ms;
+  gdouble max_ms;
+  gdouble dns_ms; /* Phase averages. */
+  gdouble connect_ms;
+  gdouble tls_ms;
+  gdouble ttfb_ms;
+  gdouble kib;
+  guint64 bucket_arr[TELEMETRY_BUCKETS];
+} telemetry_row;
+
+typedef struct { /* The state of one transfer, set as the easy handle's
+                    CURLOPT_PRIVATE. */
+  curl_write_callback write_func; /* The consumer's write callback. */
+  gpointer write_data;
+  gchar *key;        /* The cache key, NULL if the request isn't cached. */
+  guint8 url_class;  /* One of the HTTP_CLASS enum values. */
+  gboolean revalidate; /* A background refresh of a stale entry. */
+  gchar *url;        /* The request URL and body, if recording. */
+  GString *record;
+  gint64 start_us;   /* Monotonic time the request was set up. */
+  gchar *body_path;  /* Cache files, NULL if the request isn't cached. */
+  gchar *part_path;
+  gchar *validator_path;
+  FILE *tee;                  /* The body being copied to part_path. */
+  gchar *etag;                /* Response validators. */
+  gchar *last_modified;
+  struct curl_slist *headers; /* Conditional request headers. */
+  gsize delivered;            /* Decoded body bytes passed to the consumer. */
+  gsize not_modified;         /* Body bytes served on a 304 reply. */
+} http_transfer;
+
 #endif /* MULTICURL_TYPES_HEADER_H */
\ No newline at end of file
@@ -41,16 +41,25 @@ enum {
   CLASS_CALCULATE_MUTEX,
   CLASS_EXTRACT_DATA_MUTEX,
   CLASS_TOSTRINGS_MUTEX,
-  CLOCKS_COND_MUTEX,
   CLOCKS_HANDLER_MUTEX,
   FETCH_DATA_MUTEX,
-  FETCH_DATA_COND_MUTEX,
+  FETCH_CYCLE_MUTEX,
   FETCH_DATA_HANDLER_MUTEX,
   HISTORY_FETCH_MUTEX,
   MULTICURL_PROG_MUTEX,
   MULTICURL_NO_PROG_MUTEX,
   MULTICURL_REM_HAND_MUTEX,
+  MULTICURL_HEDGE_MUTEX,
+  HTTP_CACHE_MUTEX,
+  TELEMETRY_MUTEX,
+  TASK_POOL_MUTEX,
+  TIMER_WHEEL_MUTEX,
+  TRANSPORT_MUTEX,
+  DAEMON_MUTEX,
+  QUOTE_BOARD_MUTEX,
+  METRICS_MUTEX,
   SYMBOL_NAME_MAP_SQLITE_MUTEX,
+  SYMBOL_NAME_INDEX_MUTEX,
   SQLITE_MUTEX,
   MUTEX_NUMBER
 };
@@ -58,4 +67,7 @@ enum {
 /* Globals */
 extern GMutex mutexes[MUTEX_NUMBER]; /* A Glib Mutex Array */
 
+/* g_mutex_lock () with lock wait metrics [workfuncs/metrics.c]. */
+void MutexLock(GMutex *mutex);
+
 #endif /* MUTEX_HEADER_H */
\ No newline at end of file
@@ -0,0 +1,145 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+#ifndef QUOTE_BOARD_HEADER_H
+#define QUOTE_BOARD_HEADER_H
+
+/* Plain C11 [no glib], the reader library is linked by other local
+   processes. */
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+
+/* A fixed-layout file under $XDG_RUNTIME_DIR, mapped by the publisher
+   [financials] and any number of readers.  One 64 byte header, then one
+   cache-line record per quote guarded by a seqlock: the writer makes the
+   sequence odd, writes, and makes it even again; a reader copies the record
+   and retries if the sequence was odd or moved. */
+#ifndef QUOTE_BOARD_NAME
+#define QUOTE_BOARD_NAME "financials.quotes"
+#endif
+
+#define QUOTE_BOARD_MAGIC 0x31425146u /* "FQB1" */
+#define QUOTE_BOARD_VERSION 1u
+/* 255 equities, four indices, four metals. */
+#define QUOTE_BOARD_SLOTS 264u
+#define QUOTE_BOARD_SYMBOL_LEN 20u
+/* A write takes well under a microsecond, this is a stuck sequence. */
+#define QUOTE_BOARD_READ_RETRIES 100000
+
+typedef struct {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t slots;
+  _Atomic uint32_t count; /* Records in use, assigned in order. */
+  _Atomic uint32_t epoch; /* Bumped when a publisher starts [slots move]. */
+  uint32_t writer_pid;
+  char pad[40];
+} quote_board_header;
+
+typedef struct {
+  _Atomic uint32_t seq; /* Odd while the record is being written. */
+  char symbol[QUOTE_BOARD_SYMBOL_LEN]; /* "AAPL", "gold", "dow", ... */
+  double price;
+  double change;
+  double change_percent;
+  double prev_close;
+  int64_t time_us; /* Wall clock of the update, 0 for an unused record. */
+} __attribute__((aligned(64))) quote_board_record;
+
+_Static_assert(sizeof(quote_board_header) == 64, "header is one cache line");
+_Static_assert(sizeof(quote_board_record) == 64, "record is one cache line");
+
+#define QUOTE_BOARD_SIZE                                                       \
+  (sizeof(quote_board_header) + QUOTE_BOARD_SLOTS * sizeof(quote_board_record))
+
+static inline void quote_board_record_write(quote_board_record *rec,
+                                            const quote_board_record *src)
+/* Single writer per record [the publisher holds QUOTE_BOARD_MUTEX]. */
+{
+  uint32_t seq = atomic_load_explicit(&rec->seq, memory_order_relaxed);
+  atomic_store_explicit(&rec->seq, seq + 1, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+
+  memcpy(rec->symbol, src->symbol, sizeof(rec->symbol));
+  rec->price = src->price;
+  rec->change = src->change;
+  rec->change_percent = src->change_percent;
+  rec->prev_close = src->prev_close;
+  rec->time_us = src->time_us;
+
+  atomic_store_explicit(&rec->seq, seq + 2, memory_order_release);
+}
+
+static inline int quote_board_record_read(const quote_board_record *rec,
+                                          quote_board_record *out)
+/* Copy a consistent record into out, no syscalls.  Returns the number of
+   retries [contention with the writer], or -1 after
+   QUOTE_BOARD_READ_RETRIES [a publisher died mid-write]. */
+{
+  int retries = 0;
+  quote_board_record *r = (quote_board_record *)rec;
+
+  for (; retries < QUOTE_BOARD_READ_RETRIES; retries++) {
+    uint32_t s1 = atomic_load_explicit(&r->seq, memory_order_acquire);
+    if (!(s1 & 1u)) {
+      memcpy(out->symbol, r->symbol, sizeof(out->symbol));
+      out->price = r->price;
+      out->change = r->change;
+      out->change_percent = r->change_percent;
+      out->prev_close = r->prev_close;
+      out->time_us = r->time_us;
+      atomic_thread_fence(memory_order_acquire);
+      if (atomic_load_explicit(&r->seq, memory_order_relaxed) == s1) {
+        atomic_store_explicit(&out->seq, s1, memory_order_relaxed);
+        return retries;
+      }
+    }
+  }
+  return -1;
+}
+
+/* quote_board [publisher, inside financials] */
+void QuoteBoardInit(void);
+void QuoteBoardPublish(const char *symbol, double price, double change,
+                       double change_percent, double prev_close);
+void QuoteBoardDestruct(void);
+
+/* quote_board_reader [libquoteboard.a] */
+typedef struct quote_board quote_board;
+
+quote_board *QuoteBoardOpen(const char *path);
+int QuoteBoardFind(const quote_board *qb, const char *symbol);
+int QuoteBoardRead(const quote_board *qb, int slot, quote_board_record *out);
+uint32_t QuoteBoardEpoch(const quote_board *qb);
+void QuoteBoardClose(quote_board *qb);
+
+#endif /* QUOTE_BOARD_HEADER_H */
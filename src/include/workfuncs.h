@@ -34,7 +34,16 @@ POSSIBILITY OF SUCH DAMAGE.
 #define WORKFUNCS_HEADER_H
 
 #include "class_types.h" /* equity_folder, metal, meta, portfolio_packet */
-#include "gui_types.h"   /* symbol_name_map */
+#include "gui_types.h"   /* symbol_name_map, symbol_name_index */
+
+/* metrics */
+void MetricsInit();
+void MetricsDestruct();
+void MetricsStage(const gchar *name, gint64 dur_us);
+void MetricsFetchCycle(gint64 dur_us, gboolean failed);
+void MetricsZeroQuotes(const gchar *provider, guint n);
+void MetricsSqlite(gint64 dur_us);
+gchar *MetricsRender();
 
 /* pango_formatting */
 enum {
@@ -54,12 +63,17 @@ enum {
   GREEN_ITALIC,
   RED_ITALIC,
   BLUE_ITALIC,
-  BLACK_ITALIC
+  BLACK_ITALIC,
+  PANGO_FORMATS
 };
 
 enum { MON_STR, PER_STR, NUM_STR };
 
+/* Enough for any FormatDouble () string [it truncates past this]. */
+#define FORMAT_BUF_SIZE 64
+
 void SetFont(const gchar *fnt);
+gboolean NumericColumns();
 void DoubleToFormattedStrPango(gchar **dst, const gdouble num,
                                const guint8 digits_right,
                                const guint format_type, const guint color);
@@ -74,6 +88,22 @@ void SymbolStrPango(gchar **dest, const gchar *symbol_ch,
                     const double quantity_f, const guint8 digits_right,
                     const guint color);
 
+/* refresh_sched */
+gboolean AdaptiveRefresh();
+void RefreshStateInit(refresh_state *R, guint8 session);
+gboolean RefreshSessionOpen(gint64 now_s);
+guint RefreshPlan(refresh_state **R, guint n, guint period_s, gint64 now_s);
+void RefreshObserve(refresh_state *R, gdouble price_f, gint64 now_s);
+
+/* sn_index */
+symbol_name_index *SNIndexNew(const symbol_name_map *sn_map,
+                              const symbol_name_index *prev);
+symbol_name_index *SNIndexRef(symbol_name_index *idx);
+void SNIndexUnref(symbol_name_index *idx);
+symbol_name_query *SNQueryNew(symbol_name_index *idx);
+void SNQueryFree(gpointer query_data);
+gfloat SNQueryScore(symbol_name_query *q, const gchar *key, guint pos);
+
 /* sn_map */
 void AddSymbolToMap(const gchar *symbol, const gchar *name,
                     symbol_name_map *sn_map);
@@ -84,6 +114,17 @@ gchar *GetSecurityName(gchar *s, const symbol_name_map *sn_map, meta *D);
 void SNMapDestruct(symbol_name_map *sn_map);
 void CreateHashTable(symbol_name_map *sn_map);
 
+/* str_arena */
+void StrArenaEnter();
+void StrArenaLeave();
+void StrArenaPublish();
+void StrArenaReadBegin();
+void StrArenaReadEnd();
+gchar *StrArenaRealloc(gchar *str, const gsize keep, const gsize size);
+gchar *StrArenaKeep(gchar *str);
+void StrArenaFree(gchar *str);
+void StrArenaDestruct();
+
 /* string_formatting */
 gboolean CheckValidString(const gchar *string);
 gboolean CheckIfStringDoubleNumber(const gchar *string);
@@ -91,6 +132,8 @@ gboolean CheckIfStringDoublePositiveNumber(const gchar *string);
 gboolean CheckIfStringLongPositiveNumber(const gchar *string);
 void CopyString(gchar **dst, const gchar *src);
 void ToNumStr(gchar *s);
+gsize FormatDouble(gchar *buf, gsize size, const gdouble num,
+                   const guint8 digits_right, const guint format_type);
 void StringToMonStr(gchar **dst, const gchar *src, const guint8 digits_right);
 void DoubleToFormattedStr(gchar **dst, const gdouble num,
                           const guint8 digits_right, const guint format_type);
@@ -99,11 +142,56 @@ gchar *PangoToCssFontStr(const gchar *pango_fnt_str);
 gchar *SnPrint(const gchar *fmt, ...);
 void ClearStr(gchar **str);
 
+/* task_pool */
+typedef enum {
+  TASK_LANE_INTERACTIVE, /* Recalculations, thread toggles, exit. */
+  TASK_LANE_FETCH,       /* Network fetches. */
+  TASK_LANE_IO,          /* Database writes, symbol lists [last, drained
+                            on exit]. */
+  TASK_LANE_NUM
+} task_lane;
+
+typedef enum {
+  TASK_NONE = 0,
+  TASK_COALESCE = 1 << 0,
+  TASK_SUPERSEDE = 1 << 1
+} task_flags;
+
+void TaskPoolInit();
+void TaskPoolDestruct();
+void TaskSubmit(task_lane lane, task_flags flags, GThreadFunc func,
+                gpointer data, GDestroyNotify free_func);
+void TaskCancelLane(task_lane lane);
+gboolean TaskCancelled();
+
+/* timer_wheel */
+typedef gboolean (*timer_func)(gpointer data); /* FALSE removes the timer. */
+
+void TimerWheelInit();
+void TimerWheelDestruct();
+guint TimerAdd(guint period_s, timer_func func, gpointer data);
+guint TimerAddAt(gint64 unix_s, timer_func func, gpointer data);
+void TimerSetPeriod(guint id, guint period_s);
+void TimerRemove(guint id);
+
 /* time_funcs */
 guint64 ClockSleepMinute();
 guint64 ClockSleepSecond();
 gboolean GetTimeData(gboolean *holiday, gchar **holiday_str, gint *h_r,
                      gint *m_r, gint *s_r, gint *h_cur, gint *m_cur);
+void TimeDataDestruct();
+gint MarketDayAt(gint64 unix_s, gint *weekday, gint64 *open_s,
+                 gint64 *close_s);
+gint64 MarketNextOpen(gint64 unix_s);
+
+/* trace */
+void TraceInit(const gchar *path);
+void TraceDestruct();
+gint64 TraceBegin();
+void TraceEvent(const gchar *name, const gchar *detail, gint64 start_us,
+                gint64 dur_us);
+void TraceEnd(const gchar *name, const gchar *detail, gint64 start_us);
+gboolean TraceExport();
 
 /* working_functions */
 gdouble CalcGain(gdouble cur_price, gdouble prev_price);
@@ -114,5 +202,7 @@ gdouble CalcRsi(gdouble avg_gain, gdouble avg_loss);
 gchar *ExtractYahooData(FILE *fp, gdouble *prev_closing_f,
                         gdouble *cur_price_f);
 void GetYahooUrl(gchar **url_ch, const gchar *symbol_ch, guint period);
+void GetYahooHistoryUrl(gchar **url_ch, const gchar *symbol_ch,
+                        guint period);
 
 #endif /* WORKFUNCS_HEADER_H */
\ No newline at end of file
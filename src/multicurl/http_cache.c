@@ -0,0 +1,811 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <glib/gprintf.h> /* g_fprintf() */
+#include <glib/gstdio.h>  /* g_remove(), g_rename() */
+#include <unistd.h>       /* close() */
+
+#include "../include/macros.h" /* YAHOO_URL_ONE, YAHOO_URL_TWO */
+#include "../include/multicurl.h"
+#include "../include/multicurl_types.h" /* http_transfer */
+#include "../include/mutex.h"
+#include "../include/workfuncs.h" /* TaskSubmit () */
+
+/* Two layers sit beneath SetUpCurlHandle and PerformMultiCurl.
+
+   The response cache answers requests of the cacheable URL classes from
+   memory or disk, without touching curl, while the entry is fresh.  A stale
+   entry [within its class's stale window] is served as well, and revalidated
+   on the worker pool [the fetch lane].
+
+   The validator cache keeps the ETag/Last-Modified values of stored
+   responses, so requests for expired entries are sent conditionally; a 304
+   reply is answered from the stored body.  Callers can also key a request
+   explicitly [history is keyed by its whole URL, fixed for the day]. */
+
+/* Keep at most this many body bytes in memory, the disk tier holds the rest.
+ */
+#define HTTP_CACHE_MEMORY_MAX (16 * 1024 * 1024)
+
+/* Drop disk entries not fetched or revalidated in this long [a day's
+   history URL is used once]. */
+#define HTTP_CACHE_DISK_MAX_SEC (30 * 86400)
+
+typedef struct {
+  const gchar *name;
+  gint64 fresh_sec; /* Served without a request. */
+  gint64 stale_sec; /* After fresh, served and revalidated in the
+                       background. */
+} http_cache_class;
+
+static const http_cache_class cache_classes[HTTP_CLASS_NUM] = {
+    [HTTP_CLASS_NONE] = {"other", 0, 0},
+    /* Live quotes are never answered from the cache. */
+    [HTTP_CLASS_QUOTE] = {"quote", 0, 0},
+    /* The 7 day Yahoo! windows; indices, crypto, and bullion. */
+    [HTTP_CLASS_RANGE] = {"range", 30, 300},
+    [HTTP_CLASS_HISTORY] = {"history", 900, 86400},
+    /* The nasdaqtrader lists change once a day. */
+    [HTTP_CLASS_SYMBOL_LIST] = {"symbol list", 43200, 604800},
+};
+
+typedef struct { /* A memory tier entry. */
+  gchar *body;      /* NULL until loaded from the disk tier. */
+  gsize size;
+  gint64 fetched;   /* Unix time of the last 200 or 304 reply. */
+  guint8 url_class; /* Set on lookup, for the expiry. */
+} http_cache_entry;
+
+typedef struct {
+  guint64 hits;
+  guint64 stale_hits;
+  guint64 misses;
+  guint64 revalidations;
+} http_cache_stats;
+
+typedef struct { /* Arguments to revalidate_task. */
+  gchar *url;
+  gchar *cache_key;
+  gchar *key;
+} revalidate_request;
+
+/* The cache state and counters are guarded by HTTP_CACHE_MUTEX. */
+static gchar *cache_dir = NULL;
+static GHashTable *memory_table = NULL;       /* Key to http_cache_entry. */
+static GHashTable *revalidating_table = NULL; /* Keys being revalidated. */
+static gsize memory_bytes = 0;
+static http_cache_stats stats[HTTP_CLASS_NUM];
+
+static guint64 bytes_received = 0;     /* Body bytes on the wire. */
+static guint64 bytes_delivered = 0;    /* Decoded body bytes passed on. */
+static guint64 bytes_not_modified = 0; /* Bodies served on a 304 reply. */
+
+static void entry_free(gpointer data) {
+  http_cache_entry *e = (http_cache_entry *)data;
+  g_free(e->body);
+  g_free(e);
+}
+
+static void disk_prune()
+/* Remove the disk entries whose validators weren't written in
+   HTTP_CACHE_DISK_MAX_SEC, and the partial bodies as old [an unclean exit's].
+   Call with HTTP_CACHE_MUTEX held. */
+{
+  GDir *dir = g_dir_open(cache_dir, 0, NULL);
+  if (dir == NULL)
+    return;
+
+  gint64 oldest = g_get_real_time() / G_TIME_SPAN_SECOND -
+                  HTTP_CACHE_DISK_MAX_SEC;
+  const gchar *name;
+  while ((name = g_dir_read_name(dir))) {
+    gboolean part = strstr(name, ".part.") != NULL;
+    if (!part && !g_str_has_suffix(name, ".validators"))
+      continue;
+
+    gchar *path = g_build_filename(cache_dir, name, NULL);
+    GStatBuf st;
+    if (g_stat(path, &st) == 0 && st.st_mtime < oldest) {
+      if (!part) {
+        gchar *body_path =
+            g_strndup(path, strlen(path) - strlen(".validators"));
+        g_remove(body_path);
+        g_free(body_path);
+      }
+      g_remove(path);
+    }
+    g_free(path);
+  }
+  g_dir_close(dir);
+}
+
+void HttpCacheInit(const gchar *dir) {
+  MutexLock(&mutexes[HTTP_CACHE_MUTEX]);
+
+  /* Make the cache dir if it doesn't exist, along with parent dirs [private
+     to the user]. */
+  g_free(cache_dir);
+  cache_dir = g_strdup(dir);
+  g_mkdir_with_parents(cache_dir, 0700);
+  disk_prune();
+
+  if (memory_table == NULL)
+    memory_table =
+        g_hash_table_new_full(g_str_hash, g_str_equal, g_free, entry_free);
+  if (revalidating_table == NULL)
+    revalidating_table =
+        g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+
+  g_mutex_unlock(&mutexes[HTTP_CACHE_MUTEX]);
+}
+
+void HttpCacheDestruct() {
+  MutexLock(&mutexes[HTTP_CACHE_MUTEX]);
+
+  /* A revalidation still running finds the tables gone. */
+  if (memory_table)
+    g_hash_table_destroy(memory_table);
+  if (revalidating_table)
+    g_hash_table_destroy(revalidating_table);
+  memory_table = revalidating_table = NULL;
+  memory_bytes = 0;
+
+  g_free(cache_dir);
+  cache_dir = NULL;
+
+  g_mutex_unlock(&mutexes[HTTP_CACHE_MUTEX]);
+}
+
+static gint64 unix_time_sec() { return g_get_real_time() / G_TIME_SPAN_SECOND; }
+
+void HttpCacheExpire()
+/* Drop the memory tier entries past their class's stale window [on the
+   timer wheel].  The disk tier keeps their bodies and validators for the
+   conditional requests. */
+{
+  MutexLock(&mutexes[HTTP_CACHE_MUTEX]);
+  if (memory_table == NULL) {
+    g_mutex_unlock(&mutexes[HTTP_CACHE_MUTEX]);
+    return;
+  }
+
+  gint64 now = unix_time_sec();
+  GHashTableIter iter;
+  gpointer value;
+  g_hash_table_iter_init(&iter, memory_table);
+  while (g_hash_table_iter_next(&iter, NULL, &value)) {
+    http_cache_entry *e = (http_cache_entry *)value;
+    const http_cache_class *c = &cache_classes[e->url_class];
+    if (now - e->fetched < c->fresh_sec + c->stale_sec)
+      continue;
+    memory_bytes -= e->body ? e->size : 0;
+    g_hash_table_iter_remove(&iter);
+  }
+  g_mutex_unlock(&mutexes[HTTP_CACHE_MUTEX]);
+}
+
+static gint64 yahoo_span(const gchar *url)
+/* Return period2 - period1 of a Yahoo! URL in seconds, 0 if not found. */
+{
+  const gchar *p1 = strstr(url, "period1="), *p2 = strstr(url, "period2=");
+  if (p1 == NULL || p2 == NULL)
+    return 0;
+  return g_ascii_strtoll(p2 + 8, NULL, 10) - g_ascii_strtoll(p1 + 8, NULL, 10);
+}
+
+static guint8 url_class(const gchar *url) {
+  if (url == NULL)
+    return HTTP_CLASS_NONE;
+
+  if (g_str_has_prefix(url, YAHOO_URL_ONE))
+    return yahoo_span(url) > 86400 * 31 ? HTTP_CLASS_HISTORY
+                                         : HTTP_CLASS_RANGE;
+
+  if (strstr(url, "SymDir") || g_str_has_suffix(url, ".txt"))
+    return HTTP_CLASS_SYMBOL_LIST;
+
+  if (strstr(url, "quote"))
+    return HTTP_CLASS_QUOTE;
+
+  return HTTP_CLASS_NONE;
+}
+
+gchar *HttpCacheUrlKey(const gchar *url)
+/* Return a key that identifies a URL across refresh cycles.  Yahoo! URLs
+   carry a time window that moves every second, they are keyed by the text
+   before the window and its span.  Must free return value. */
+{
+  const gchar *window = strstr(url, YAHOO_URL_TWO);
+  if (window)
+    return g_strdup_printf("%.*s?span=%" G_GINT64_FORMAT, (gint)(window - url),
+                           url, yahoo_span(url));
+
+  return g_strdup(url);
+}
+
+static gchar *transfer_key(const gchar *url, const gchar *cache_key,
+                           guint8 *cls)
+/* Set the URL class, return the cache key of a request or NULL if it isn't
+   cached.  Must free return value. */
+{
+  *cls = url_class(url);
+
+  /* Recorded and replayed sessions see every response unaltered. */
+  if (TransportActive())
+    return NULL;
+
+  if (cache_key)
+    return g_strdup(cache_key);
+
+  if (cache_classes[*cls].fresh_sec == 0)
+    return NULL;
+
+  return HttpCacheUrlKey(url);
+}
+
+static gchar *cache_file_path(const gchar *key, const gchar *suffix)
+/* Return the cache file path for a key.  Must free return value. */
+{
+  gchar *hash = g_compute_checksum_for_string(G_CHECKSUM_SHA1, key, -1);
+  gchar *path = g_strconcat(cache_dir, "/", hash, suffix, NULL);
+  g_free(hash);
+  return path;
+}
+
+static http_cache_entry *entry_lookup(const gchar *key)
+/* Find the memory tier entry of a key, adding it from the disk tier [without
+   the body] if needed.  Returns NULL on a miss.  Call with HTTP_CACHE_MUTEX
+   held. */
+{
+  http_cache_entry *e = g_hash_table_lookup(memory_table, key);
+  if (e)
+    return e;
+
+  gchar *body_path = cache_file_path(key, "");
+  gchar *validator_path = cache_file_path(key, ".validators");
+  GKeyFile *kf = g_key_file_new();
+
+  if (g_file_test(body_path, G_FILE_TEST_EXISTS) &&
+      g_key_file_load_from_file(kf, validator_path, G_KEY_FILE_NONE, NULL)) {
+    e = g_malloc0(sizeof(*e));
+    e->fetched = g_key_file_get_int64(kf, "Validators", "Fetched", NULL);
+    g_hash_table_insert(memory_table, g_strdup(key), e);
+  }
+
+  g_key_file_free(kf);
+  g_free(validator_path);
+  g_free(body_path);
+  return e;
+}
+
+static gboolean entry_load_body(const gchar *key, http_cache_entry *e)
+/* Make sure the entry's body is in memory, evicting other bodies to stay
+   within HTTP_CACHE_MEMORY_MAX.  Call with HTTP_CACHE_MUTEX held. */
+{
+  if (e->body)
+    return TRUE;
+
+  gchar *body_path = cache_file_path(key, "");
+  gboolean ok = g_file_get_contents(body_path, &e->body, &e->size, NULL);
+  g_free(body_path);
+  if (!ok)
+    return FALSE;
+
+  memory_bytes += e->size;
+
+  GHashTableIter iter;
+  gpointer other;
+  g_hash_table_iter_init(&iter, memory_table);
+  while (memory_bytes > HTTP_CACHE_MEMORY_MAX &&
+         g_hash_table_iter_next(&iter, NULL, &other)) {
+    http_cache_entry *o = (http_cache_entry *)other;
+    if (o == e || o->body == NULL)
+      continue;
+    memory_bytes -= o->size;
+    g_free(o->body);
+    o->body = NULL;
+    o->size = 0;
+  }
+
+  return TRUE;
+}
+
+static void entry_drop(const gchar *key)
+/* Remove a key from both tiers.  Call with HTTP_CACHE_MUTEX held. */
+{
+  http_cache_entry *e = g_hash_table_lookup(memory_table, key);
+  if (e) {
+    memory_bytes -= e->body ? e->size : 0;
+    g_hash_table_remove(memory_table, key);
+  }
+
+  gchar *path = cache_file_path(key, "");
+  g_remove(path);
+  g_free(path);
+  path = cache_file_path(key, ".validators");
+  g_remove(path);
+  g_free(path);
+}
+
+static void transfer_free(http_transfer *t) {
+  if (t == NULL)
+    return;
+  if (t->tee) {
+    fclose(t->tee);
+    g_remove(t->part_path);
+  }
+  if (t->record)
+    g_string_free(t->record, TRUE);
+  g_free(t->url);
+  g_free(t->key);
+  g_free(t->body_path);
+  g_free(t->part_path);
+  g_free(t->validator_path);
+  g_free(t->etag);
+  g_free(t->last_modified);
+  curl_slist_free_all(t->headers);
+  g_free(t);
+}
+
+static gsize transfer_write_callback(gchar *ptr, gsize size, gsize nmemb,
+                                     gpointer userdata)
+/* Count the decoded body, copy it to the cache file [if the request is
+   cached], and hand it to the consumer's write callback. */
+{
+  http_transfer *t = (http_transfer *)userdata;
+  gsize realsize = size * nmemb;
+
+  if (t->tee && fwrite(ptr, 1, realsize, t->tee) != realsize) {
+    /* Don't cache a partial body. */
+    fclose(t->tee);
+    t->tee = NULL;
+    g_remove(t->part_path);
+  }
+
+  if (t->record)
+    g_string_append_len(t->record, ptr, (gssize)realsize);
+
+  t->delivered += realsize;
+  return t->write_func(ptr, size, nmemb, t->write_data);
+}
+
+static gsize discard_write_callback(gchar *ptr, gsize size, gsize nmemb,
+                                    gpointer userdata) {
+  UNUSED(ptr)
+  UNUSED(userdata)
+  return size * nmemb;
+}
+
+static gchar *header_value(const gchar *line, gsize len, const gchar *name)
+/* Return the value of a "Name: value" header line if the name matches,
+   otherwise NULL.  Must free return value. */
+{
+  gsize name_len = strlen(name);
+  if (len <= name_len + 1 || g_ascii_strncasecmp(line, name, name_len) ||
+      line[name_len] != ':')
+    return NULL;
+
+  gchar *value = g_strndup(line + name_len + 1, len - name_len - 1);
+  return g_strstrip(value);
+}
+
+static gsize transfer_header_callback(gchar *ptr, gsize size, gsize nmemb,
+                                      gpointer userdata)
+/* Collect the response validators. */
+{
+  http_transfer *t = (http_transfer *)userdata;
+  gsize realsize = size * nmemb;
+  gchar *value;
+
+  /* A new status line [redirects] resets the previous response's headers. */
+  if (realsize > 5 && !strncmp(ptr, "HTTP/", 5)) {
+    g_free(t->etag);
+    g_free(t->last_modified);
+    t->etag = t->last_modified = NULL;
+    return realsize;
+  }
+
+  if ((value = header_value(ptr, realsize, "ETag"))) {
+    g_free(t->etag);
+    t->etag = value;
+  } else if ((value = header_value(ptr, realsize, "Last-Modified"))) {
+    g_free(t->last_modified);
+    t->last_modified = value;
+  }
+
+  return realsize;
+}
+
+static void request_add_validators(http_transfer *t)
+/* Make the request conditional if a body and its validators are stored. */
+{
+  if (!g_file_test(t->body_path, G_FILE_TEST_EXISTS))
+    return;
+
+  GKeyFile *kf = g_key_file_new();
+  if (g_key_file_load_from_file(kf, t->validator_path, G_KEY_FILE_NONE,
+                                NULL)) {
+    gchar *etag = g_key_file_get_string(kf, "Validators", "ETag", NULL);
+    gchar *lm = g_key_file_get_string(kf, "Validators", "Last-Modified", NULL);
+    gchar *hdr;
+
+    if (etag && etag[0]) {
+      hdr = g_strconcat("If-None-Match: ", etag, NULL);
+      t->headers = curl_slist_append(t->headers, hdr);
+      g_free(hdr);
+    }
+    if (lm && lm[0]) {
+      hdr = g_strconcat("If-Modified-Since: ", lm, NULL);
+      t->headers = curl_slist_append(t->headers, hdr);
+      g_free(hdr);
+    }
+    g_free(etag);
+    g_free(lm);
+  }
+  g_key_file_free(kf);
+}
+
+void HttpCacheRequest(CURL *hnd, const gchar *url, const gchar *cache_key,
+                      curl_write_callback write_func, gpointer data)
+/* Attach the transfer state to an easy handle; compressed transfer encodings
+   are negotiated for every request.  Cacheable requests are copied to disk
+   and sent conditionally.  Must be followed by HttpCacheFinish on completion.
+ */
+{
+  /* Free the state of an aborted previous transfer on this handle. */
+  http_transfer *t = NULL;
+  curl_easy_getinfo(hnd, CURLINFO_PRIVATE, (gchar **)&t);
+  transfer_free(t);
+
+  t = g_malloc0(sizeof(*t));
+  t->write_func = write_func;
+  t->write_data = data;
+  t->key = transfer_key(url, cache_key, &t->url_class);
+
+  if (TransportRecording()) {
+    t->url = g_strdup(url);
+    t->record = g_string_new(NULL);
+    t->start_us = g_get_monotonic_time();
+  }
+
+  if (t->key && cache_dir) {
+    t->body_path = cache_file_path(t->key, "");
+    /* Each transfer writes its own partial body, concurrent transfers of a
+       key each rename a whole one. */
+    t->part_path = cache_file_path(t->key, ".part.XXXXXX");
+    t->validator_path = cache_file_path(t->key, ".validators");
+    request_add_validators(t);
+    gint fd = g_mkstemp(t->part_path);
+    t->tee = fd < 0 ? NULL : fdopen(fd, "wb");
+    if (fd >= 0 && t->tee == NULL) {
+      close(fd);
+      g_remove(t->part_path);
+    }
+  }
+
+  /* An empty string enables every encoding libcurl was built with
+     [gzip, deflate, br, zstd]. */
+  curl_easy_setopt(hnd, CURLOPT_ACCEPT_ENCODING, "");
+  curl_easy_setopt(hnd, CURLOPT_HTTPHEADER, t->headers);
+  curl_easy_setopt(hnd, CURLOPT_HEADERFUNCTION, transfer_header_callback);
+  curl_easy_setopt(hnd, CURLOPT_HEADERDATA, (gpointer)t);
+  curl_easy_setopt(hnd, CURLOPT_WRITEFUNCTION, transfer_write_callback);
+  curl_easy_setopt(hnd, CURLOPT_WRITEDATA, (gpointer)t);
+  curl_easy_setopt(hnd, CURLOPT_PRIVATE, (gpointer)t);
+}
+
+static gpointer revalidate_task(gpointer data)
+/* Refresh a stale entry with a conditional request, on the fetch lane.  The
+   body isn't consumed, HttpCacheFinish stores it. */
+{
+  revalidate_request *r = (revalidate_request *)data;
+  http_transfer *t = NULL;
+
+  CURL *hnd = curl_easy_init();
+  if (hnd) {
+    curl_easy_setopt(hnd, CURLOPT_URL, r->url);
+    curl_easy_setopt(hnd, CURLOPT_USERAGENT, "curl/7.80.0");
+    curl_easy_setopt(hnd, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(hnd, CURLOPT_MAXREDIRS, 5L);
+    curl_easy_setopt(hnd, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(hnd, CURLOPT_CONNECTTIMEOUT_MS, 5000);
+    curl_easy_setopt(hnd, CURLOPT_TIMEOUT_MS, 10000);
+
+    HttpCacheRequest(hnd, r->url, r->cache_key, discard_write_callback, NULL);
+    curl_easy_getinfo(hnd, CURLINFO_PRIVATE, (gchar **)&t);
+    t->revalidate = TRUE;
+
+    HttpCacheFinish(hnd, curl_easy_perform(hnd));
+    curl_easy_cleanup(hnd);
+  }
+  return NULL;
+}
+
+static void revalidate_request_free(gpointer data)
+/* After the task runs, or in its place [cancelled, or no worker pool
+   without the GUI], the next stale hit may revalidate again. */
+{
+  revalidate_request *r = (revalidate_request *)data;
+
+  MutexLock(&mutexes[HTTP_CACHE_MUTEX]);
+  if (revalidating_table)
+    g_hash_table_remove(revalidating_table, r->key);
+  g_mutex_unlock(&mutexes[HTTP_CACHE_MUTEX]);
+
+  g_free(r->url);
+  g_free(r->cache_key);
+  g_free(r->key);
+  g_free(r);
+}
+
+gboolean HttpCacheLookup(const gchar *url, const gchar *cache_key,
+                         curl_write_callback write_func, gpointer data)
+/* Answer a request from the response cache, if its entry is fresh or stale
+   [the latter is revalidated in the background].  The body is passed to the
+   write callback, as if it had been downloaded.
+
+   Returns TRUE if answered, the request must not be performed. */
+{
+  guint8 cls;
+  gchar *key = transfer_key(url, cache_key, &cls);
+  const http_cache_class *c = &cache_classes[cls];
+  gboolean served = FALSE, revalidate = FALSE;
+  gchar *body = NULL;
+  gsize size = 0;
+
+  if (key == NULL || c->fresh_sec == 0) {
+    g_free(key);
+    return FALSE;
+  }
+
+  MutexLock(&mutexes[HTTP_CACHE_MUTEX]);
+
+  http_cache_entry *e = memory_table ? entry_lookup(key) : NULL;
+  gint64 age = e ? unix_time_sec() - e->fetched : -1;
+  if (e)
+    e->url_class = cls;
+
+  if (e && age >= 0 && age < c->fresh_sec + c->stale_sec &&
+      entry_load_body(key, e)) {
+    if (age < c->fresh_sec) {
+      stats[cls].hits++;
+    } else {
+      stats[cls].stale_hits++;
+      /* Only one revalidation per key at a time. */
+      if (!g_hash_table_contains(revalidating_table, key)) {
+        g_hash_table_add(revalidating_table, g_strdup(key));
+        stats[cls].revalidations++;
+        revalidate = TRUE;
+      }
+    }
+
+    /* The consumer's callback runs unlocked, on a copy. */
+    body = g_memdup2(e->body, e->size);
+    size = e->size;
+    served = TRUE;
+  } else {
+    stats[cls].misses++;
+  }
+
+  g_mutex_unlock(&mutexes[HTTP_CACHE_MUTEX]);
+
+  /* If the consumer rejects the body, drop the entry and perform the
+     request [counted as a miss, nothing left to revalidate]. */
+  if (size && write_func(body, 1, size, data) != size) {
+    MutexLock(&mutexes[HTTP_CACHE_MUTEX]);
+    if (memory_table)
+      entry_drop(key);
+    if (revalidate && revalidating_table)
+      g_hash_table_remove(revalidating_table, key);
+    if (age < c->fresh_sec)
+      stats[cls].hits--;
+    else
+      stats[cls].stale_hits--;
+    stats[cls].revalidations -= revalidate ? 1 : 0;
+    stats[cls].misses++;
+    g_mutex_unlock(&mutexes[HTTP_CACHE_MUTEX]);
+    served = revalidate = FALSE;
+  }
+  g_free(body);
+
+  if (revalidate) {
+    revalidate_request *r = g_malloc(sizeof(*r));
+    r->url = g_strdup(url);
+    r->cache_key = g_strdup(cache_key);
+    r->key = g_strdup(key);
+
+    TaskSubmit(TASK_LANE_FETCH, TASK_NONE, revalidate_task, r,
+               revalidate_request_free);
+  }
+
+  g_free(key);
+  return served;
+}
+
+static gboolean serve_not_modified(http_transfer *t)
+/* Hand the stored body to the consumer, as if it had been downloaded. */
+{
+  gchar *body = NULL;
+  gsize len = 0;
+
+  if (t->body_path == NULL ||
+      !g_file_get_contents(t->body_path, &body, &len, NULL))
+    return FALSE;
+
+  gboolean ok = (len == 0 || t->write_func(body, 1, len, t->write_data) == len);
+  t->not_modified = len;
+  g_free(body);
+  return ok;
+}
+
+static void entry_touch(http_transfer *t, gboolean new_body)
+/* Restart the entry's freshness lifetime, on the disk and memory tiers.
+   A new body replaces the one in memory on its next use. */
+{
+  gint64 now = unix_time_sec();
+
+  GKeyFile *kf = g_key_file_new();
+  g_key_file_load_from_file(kf, t->validator_path, G_KEY_FILE_NONE, NULL);
+  if (new_body) {
+    g_key_file_set_string(kf, "Validators", "ETag", t->etag ? t->etag : "");
+    g_key_file_set_string(kf, "Validators", "Last-Modified",
+                          t->last_modified ? t->last_modified : "");
+  }
+  g_key_file_set_int64(kf, "Validators", "Fetched", now);
+  g_key_file_save_to_file(kf, t->validator_path, NULL);
+  g_key_file_free(kf);
+
+  MutexLock(&mutexes[HTTP_CACHE_MUTEX]);
+  http_cache_entry *e =
+      memory_table ? g_hash_table_lookup(memory_table, t->key) : NULL;
+  if (e) {
+    e->fetched = now;
+    if (new_body && e->body) {
+      memory_bytes -= e->size;
+      g_free(e->body);
+      e->body = NULL;
+      e->size = 0;
+    }
+  }
+  g_mutex_unlock(&mutexes[HTTP_CACHE_MUTEX]);
+}
+
+static void store_response(http_transfer *t)
+/* Keep the body if its class is cached or the server sent validators. */
+{
+  fclose(t->tee);
+  t->tee = NULL;
+
+  if (t->etag == NULL && t->last_modified == NULL &&
+      cache_classes[t->url_class].fresh_sec == 0) {
+    /* Nothing to revalidate with, drop any previous entry. */
+    g_remove(t->part_path);
+    g_remove(t->validator_path);
+    g_remove(t->body_path);
+    return;
+  }
+
+  if (g_rename(t->part_path, t->body_path) != 0) {
+    g_remove(t->part_path);
+    return;
+  }
+
+  entry_touch(t, TRUE);
+}
+
+gushort HttpCacheFinish(CURL *hnd, CURLcode rc)
+/* Complete a transfer: answer a 304 from the stored body, store a cacheable
+   200 body, and count the session bytes.
+
+   Returns 0 on success, 1 if the transfer failed. */
+{
+  http_transfer *t = NULL;
+  curl_easy_getinfo(hnd, CURLINFO_PRIVATE, (gchar **)&t);
+  if (t == NULL)
+    return rc == CURLE_OK ? 0 : 1;
+
+  gushort ret = rc == CURLE_OK ? 0 : 1;
+  glong code = 0;
+  curl_off_t wire = 0;
+  curl_easy_getinfo(hnd, CURLINFO_RESPONSE_CODE, &code);
+  curl_easy_getinfo(hnd, CURLINFO_SIZE_DOWNLOAD_T, &wire);
+
+  if (rc == CURLE_OK && code == 304 && t->body_path) {
+    /* A revalidation only refreshes the entry. */
+    if (!t->revalidate && !serve_not_modified(t))
+      ret = 1;
+    entry_touch(t, FALSE);
+  } else if (rc == CURLE_OK && code == 304) {
+    ret = 1;
+  } else if (rc == CURLE_OK && code == 200 && t->tee) {
+    store_response(t);
+  }
+
+  if (t->record)
+    TransportRecord(t->url, rc, code, t->start_us,
+                    g_get_monotonic_time() - t->start_us, t->record->str,
+                    t->record->len);
+
+  MutexLock(&mutexes[HTTP_CACHE_MUTEX]);
+  bytes_received += (guint64)wire;
+  bytes_delivered += t->delivered;
+  bytes_not_modified += t->not_modified;
+  g_mutex_unlock(&mutexes[HTTP_CACHE_MUTEX]);
+
+  curl_easy_setopt(hnd, CURLOPT_HTTPHEADER, NULL);
+  curl_easy_setopt(hnd, CURLOPT_PRIVATE, NULL);
+  transfer_free(t);
+
+  return ret;
+}
+
+void HttpCacheAbandon(CURL *hnd)
+/* Release the state of a transfer that lost to its hedged duplicate, nothing
+   is stored or recorded [the partial cache file is removed]. */
+{
+  http_transfer *t = NULL;
+  curl_easy_getinfo(hnd, CURLINFO_PRIVATE, (gchar **)&t);
+
+  curl_easy_setopt(hnd, CURLOPT_HTTPHEADER, NULL);
+  curl_easy_setopt(hnd, CURLOPT_PRIVATE, NULL);
+  transfer_free(t);
+}
+
+void HttpCacheReport()
+/* Print the response cache statistics and the bytes saved this session by
+   compressed transfers and 304 replies. */
+{
+  MutexLock(&mutexes[HTTP_CACHE_MUTEX]);
+
+  for (guint8 c = 0; c < HTTP_CLASS_NUM; c++) {
+    http_cache_stats *s = &stats[c];
+    if (s->hits + s->stale_hits + s->misses == 0)
+      continue;
+    g_print("HTTP cache [%s]: %" G_GUINT64_FORMAT " hits, %" G_GUINT64_FORMAT
+            " stale hits, %" G_GUINT64_FORMAT " misses, %" G_GUINT64_FORMAT
+            " revalidations.\n",
+            cache_classes[c].name, s->hits, s->stale_hits, s->misses,
+            s->revalidations);
+  }
+
+  guint64 compressed =
+      bytes_delivered > bytes_received ? bytes_delivered - bytes_received : 0;
+
+  if (bytes_delivered || bytes_not_modified)
+    g_print("HTTP session: %" G_GUINT64_FORMAT " KiB received, %" G_GUINT64_FORMAT
+            " KiB saved by compression, %" G_GUINT64_FORMAT
+            " KiB saved by not modified replies.\n",
+            bytes_received / 1024, compressed / 1024,
+            bytes_not_modified / 1024);
+
+  g_mutex_unlock(&mutexes[HTTP_CACHE_MUTEX]);
+}
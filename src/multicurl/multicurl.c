@@ -32,12 +32,21 @@ POSSIBILITY OF SUCH DAMAGE.
 
 #include <glib/gprintf.h> /* g_fprintf() */
 
-#include "../include/gui.h" /* MainProgBar func */
+#include "../include/multicurl.h"
 #include "../include/multicurl_types.h"
 #include "../include/mutex.h"
 
 #define MAX_WAIT_MSECS 50
 
+/* The progress bar, set by the GUI [NULL without GTK]. */
+static multicurl_progress_func progress = NULL;
+
+void SetMultiCurlProgressFunc(multicurl_progress_func progress_func)
+/* Set before the first fetch, the fetch threads only read it. */
+{
+  progress = progress_func;
+}
+
 void FreeMemtype(MemType *mem_data) {
   /* Reset the MemType members, doesn't free the
      object pointer. */
@@ -48,33 +57,6 @@ void FreeMemtype(MemType *mem_data) {
   mem_data->size = 0;
 }
 
-static gushort remove_handles(CURLM *mh) {
-  CURLMsg *msg = NULL;
-  CURL *hnd = NULL;
-  CURLcode rc = 0;
-  gint msgs_left = 0;
-  gushort return_value = 0;
-
-  /* This portion of the code will remove the easy handles from the
-   * mulltihandle. */
-  while ((msg = curl_multi_info_read(mh, &msgs_left))) {
-    if (msg->msg == CURLMSG_DONE) {
-      hnd = msg->easy_handle;
-      rc = msg->data.result;
-      if (rc != CURLE_OK) {
-        g_fprintf(stderr, "CURL code: %d\n", msg->data.result);
-        return_value++;
-      }
-      curl_multi_remove_handle(mh, hnd);
-    } else {
-      g_fprintf(stderr, "error: after curl_multi_info_read(), CURLMsg=%d\n",
-                msg->msg);
-      return_value++;
-    }
-  }
-  return return_value;
-}
-
 /* This callback function example can be found here:
    https://everything.curl.dev/libcurl/callbacks/write
 */
@@ -109,9 +91,383 @@ static gsize write_callback(gchar *ptr, gsize size, gsize nmemb,
   return realsize;
 }
 
+/* Hedged requests.  A buffered request still running past its host's p95
+   latency gets one duplicate transfer; the first successful [2xx] response
+   is used and the other transfer is aborted.  At most one in
+   HEDGE_BUDGET_DIV requests of a batch is hedged. */
+#define HEDGE_BUDGET_DIV 10
+#define HEDGE_MIN_US 20000
+
+/* Hosts with a per key request quota, a duplicate would spend it [and
+   invite the 429 that slows the batch down]. */
+static const gchar *hedge_quota_host_arr[] = {"finnhub.io", NULL};
+
+typedef struct {
+  CURL *primary;
+  CURL *hedge; /* NULL until the duplicate is sent. */
+  MemType *output;
+  MemType hedge_output;
+  gint64 start_us;     /* The first perform after set up. */
+  gint64 threshold_us; /* The host's p95. */
+  CURLcode primary_rc;
+  gboolean failed;         /* One side failed, the other is still running. */
+  gboolean primary_failed; /* The failed side is the primary. */
+} hedge_request;
+
+typedef struct {
+  GHashTable *handles; /* Primary and hedge handles to hedge_request. */
+  guint requests;
+  guint hedged;
+} hedge_batch;
+
+/* Multi handle to hedge_batch, guarded by MULTICURL_HEDGE_MUTEX. */
+static GHashTable *hedge_table = NULL;
+
+static gboolean hedge_quota_host(const gchar *url)
+/* Whether the URL's host limits its request rate. */
+{
+  const gchar *h = strstr(url, "://");
+  h = h ? h + 3 : url;
+  gchar *host = g_strndup(h, strcspn(h, "/:?"));
+  gboolean quota = FALSE;
+
+  for (guint i = 0; hedge_quota_host_arr[i] && !quota; i++)
+    quota = g_strcmp0(host, hedge_quota_host_arr[i]) == 0 ||
+            (g_str_has_suffix(host, hedge_quota_host_arr[i]) &&
+             host[strlen(host) - strlen(hedge_quota_host_arr[i]) - 1] == '.');
+  g_free(host);
+
+  return quota;
+}
+
+static void hedge_register(CURLM *mh, CURL *hnd, const gchar *url,
+                           MemType *output)
+/* Make a buffered request a hedging candidate, if its host has enough
+   samples and no request quota. */
+{
+  if (hedge_quota_host(url))
+    return;
+
+  gint64 p95 = TelemetryHostPercentileUs(url, 0.95);
+  if (p95 < 0)
+    return;
+
+  hedge_request *r = g_malloc0(sizeof(*r));
+  r->primary = hnd;
+  r->output = output;
+  r->threshold_us = MAX(p95, HEDGE_MIN_US);
+
+  MutexLock(&mutexes[MULTICURL_HEDGE_MUTEX]);
+  if (hedge_table == NULL)
+    hedge_table = g_hash_table_new(g_direct_hash, g_direct_equal);
+  hedge_batch *b = g_hash_table_lookup(hedge_table, mh);
+  if (b == NULL) {
+    b = g_malloc0(sizeof(*b));
+    b->handles = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL,
+                                       NULL);
+    g_hash_table_insert(hedge_table, mh, b);
+  }
+  /* A handle set up again before its last perform finished. */
+  g_free(g_hash_table_lookup(b->handles, hnd));
+  g_hash_table_insert(b->handles, hnd, r);
+  b->requests++;
+  g_mutex_unlock(&mutexes[MULTICURL_HEDGE_MUTEX]);
+}
+
+static gboolean hedge_fire(CURLM *mh)
+/* Send a duplicate of each candidate past its threshold, within the batch
+   budget.  The completed transfers must be drained first [remove_handles],
+   a finished but unread primary would be duplicated.
+
+   Returns TRUE if the batch has candidates, their completed transfers are
+   drained after each perform. */
+{
+  gint64 now = g_get_monotonic_time();
+  GHashTableIter iter;
+  gpointer key, value;
+  gboolean in_flight = FALSE;
+
+  MutexLock(&mutexes[MULTICURL_HEDGE_MUTEX]);
+  hedge_batch *b = hedge_table ? g_hash_table_lookup(hedge_table, mh) : NULL;
+  if (b == NULL) {
+    g_mutex_unlock(&mutexes[MULTICURL_HEDGE_MUTEX]);
+    return FALSE;
+  }
+
+  GPtrArray *fired = g_ptr_array_new();
+  g_hash_table_iter_init(&iter, b->handles);
+  while (g_hash_table_iter_next(&iter, &key, &value)) {
+    hedge_request *r = (hedge_request *)value;
+    if (key != r->primary)
+      continue;
+    in_flight = TRUE;
+    if (r->hedge)
+      continue;
+    if (r->start_us == 0)
+      r->start_us = now;
+    if (now - r->start_us < r->threshold_us ||
+        b->hedged >= MAX(1, b->requests / HEDGE_BUDGET_DIV))
+      continue;
+
+    /* The duplicate buffers its own body; the cache state, conditional
+       headers, and private pointer belong to the primary. */
+    r->hedge = curl_easy_duphandle(r->primary);
+    if (r->hedge == NULL)
+      continue;
+    curl_easy_setopt(r->hedge, CURLOPT_WRITEFUNCTION, write_callback);
+    curl_easy_setopt(r->hedge, CURLOPT_WRITEDATA, (gpointer)&r->hedge_output);
+    curl_easy_setopt(r->hedge, CURLOPT_HEADERFUNCTION, NULL);
+    curl_easy_setopt(r->hedge, CURLOPT_HEADERDATA, NULL);
+    curl_easy_setopt(r->hedge, CURLOPT_HTTPHEADER, NULL);
+    curl_easy_setopt(r->hedge, CURLOPT_PRIVATE, NULL);
+    curl_multi_add_handle(mh, r->hedge);
+    g_ptr_array_add(fired, r);
+    b->hedged++;
+  }
+  /* Don't insert while iterating. */
+  for (guint i = 0; i < fired->len; i++) {
+    hedge_request *r = g_ptr_array_index(fired, i);
+    g_hash_table_insert(b->handles, r->hedge, r);
+  }
+  g_ptr_array_free(fired, TRUE);
+  g_mutex_unlock(&mutexes[MULTICURL_HEDGE_MUTEX]);
+
+  return in_flight;
+}
+
+static void hedge_request_free(CURLM *mh, hedge_batch *b, hedge_request *r) {
+  g_hash_table_remove(b->handles, r->primary);
+  if (r->hedge) {
+    g_hash_table_remove(b->handles, r->hedge);
+    curl_multi_remove_handle(mh, r->hedge);
+    curl_easy_cleanup(r->hedge);
+  }
+  FreeMemtype(&r->hedge_output);
+  g_free(r);
+}
+
+static gboolean hedge_done(CURLM *mh, CURL *hnd, CURLcode rc,
+                           gushort *failed, CURL **delivered)
+/* Resolve a completed transfer that belongs to a hedged pair; the first
+   success wins, a failure [a curl error or a non 2xx reply] waits for the
+   other side.  delivered is set to the primary handle once its output holds
+   the winning body.
+
+   The primary's conditional request may also succeed with a 304, which the
+   http cache resolves.
+
+   Returns FALSE if the transfer isn't hedged [the caller finishes it]. */
+{
+  *delivered = NULL;
+  MutexLock(&mutexes[MULTICURL_HEDGE_MUTEX]);
+  hedge_batch *b = hedge_table ? g_hash_table_lookup(hedge_table, mh) : NULL;
+  hedge_request *r = b ? g_hash_table_lookup(b->handles, hnd) : NULL;
+  if (r == NULL || r->hedge == NULL) {
+    if (r)
+      hedge_request_free(mh, b, r);
+    g_mutex_unlock(&mutexes[MULTICURL_HEDGE_MUTEX]);
+    return FALSE;
+  }
+
+  gboolean is_hedge = hnd == r->hedge;
+  curl_multi_remove_handle(mh, hnd);
+
+  glong status = 0;
+  if (rc == CURLE_OK)
+    curl_easy_getinfo(hnd, CURLINFO_RESPONSE_CODE, &status);
+  gboolean ok = (status >= 200 && status < 300) || (!is_hedge && status == 304);
+
+  if (!ok && !r->failed) {
+    r->failed = TRUE;
+    r->primary_failed = !is_hedge;
+    if (!is_hedge)
+      r->primary_rc = rc;
+    g_mutex_unlock(&mutexes[MULTICURL_HEDGE_MUTEX]);
+    return TRUE;
+  }
+
+  if (!is_hedge) {
+    /* A success, or both failed and the primary's reply stands. */
+    if (HttpCacheFinish(r->primary, rc))
+      (*failed)++;
+    else
+      *delivered = r->primary;
+  } else if (ok) {
+    /* The duplicate's body replaces the primary's partial one. */
+    FreeMemtype(r->output);
+    *r->output = r->hedge_output;
+    r->hedge_output.memory = NULL;
+    r->hedge_output.size = 0;
+    curl_multi_remove_handle(mh, r->primary);
+    HttpCacheAbandon(r->primary);
+    *delivered = r->primary;
+  } else {
+    /* Both failed, the primary's reply stands. */
+    if (HttpCacheFinish(r->primary, r->primary_rc))
+      (*failed)++;
+    else
+      *delivered = r->primary;
+  }
+
+  hedge_request_free(mh, b, r);
+  g_mutex_unlock(&mutexes[MULTICURL_HEDGE_MUTEX]);
+  return TRUE;
+}
+
+static gushort hedge_clear(CURLM *mh)
+/* Drop the batch after a perform, abort any duplicates still running.
+
+   Returns the number of failed primaries that were waiting on a duplicate. */
+{
+  gushort failed = 0;
+  MutexLock(&mutexes[MULTICURL_HEDGE_MUTEX]);
+  hedge_batch *b = hedge_table ? g_hash_table_lookup(hedge_table, mh) : NULL;
+  if (b) {
+    GHashTableIter iter;
+    gpointer key, value;
+    GPtrArray *requests = g_ptr_array_new();
+
+    g_hash_table_iter_init(&iter, b->handles);
+    while (g_hash_table_iter_next(&iter, &key, &value))
+      if (key == ((hedge_request *)value)->primary)
+        g_ptr_array_add(requests, value);
+    for (guint i = 0; i < requests->len; i++) {
+      hedge_request *r = g_ptr_array_index(requests, i);
+      if (r->hedge && r->primary_failed)
+        failed += HttpCacheFinish(r->primary, r->primary_rc);
+      hedge_request_free(mh, b, r);
+    }
+    g_ptr_array_free(requests, TRUE);
+
+    g_hash_table_destroy(b->handles);
+    g_hash_table_remove(hedge_table, mh);
+    g_free(b);
+  }
+  g_mutex_unlock(&mutexes[MULTICURL_HEDGE_MUTEX]);
+  return failed;
+}
+
+static gushort remove_handles(CURLM *mh, multicurl_done_func done_func,
+                              gpointer data)
+/* Finish the completed transfers, each successful one is handed to
+   done_func [if not NULL] right away. */
+{
+  CURLMsg *msg = NULL;
+  CURL *hnd = NULL, *delivered = NULL;
+  CURLcode rc = 0;
+  gint msgs_left = 0;
+  gushort return_value = 0;
+
+  /* This portion of the code will remove the easy handles from the
+   * mulltihandle. */
+  while ((msg = curl_multi_info_read(mh, &msgs_left))) {
+    if (msg->msg == CURLMSG_DONE) {
+      hnd = msg->easy_handle;
+      rc = msg->data.result;
+      if (rc != CURLE_OK)
+        g_fprintf(stderr, "CURL code: %d\n", msg->data.result);
+
+      /* Per host and per symbol timing histograms. */
+      TelemetryRecord(hnd, rc);
+
+      /* One side of a hedged pair, the pair decides which body is used. */
+      if (hedge_done(mh, hnd, rc, &return_value, &delivered)) {
+        if (delivered && done_func)
+          done_func(delivered, data);
+        continue;
+      }
+
+      /* Resolve 304 replies, store cacheable bodies. */
+      gushort failed = HttpCacheFinish(hnd, rc);
+      return_value += failed;
+      curl_multi_remove_handle(mh, hnd);
+
+      if (!failed && done_func)
+        done_func(hnd, data);
+    } else {
+      g_fprintf(stderr, "error: after curl_multi_info_read(), CURLMsg=%d\n",
+                msg->msg);
+      return_value++;
+    }
+  }
+  return return_value;
+}
+
+static void set_curl_options(CURL *hnd, CURLM *mh, gchar *url,
+                             const gchar *cache_key,
+                             curl_write_callback write_func, gpointer data)
+/* Set the common easy handle options and add the handle to the multi handle.
+ */
+{
+  /* Requests can be redirected to a local server [the path is kept]. */
+  gchar *local_url = TransportUrl(url);
+  if (local_url) {
+    set_curl_options(hnd, mh, local_url, cache_key, write_func, data);
+    g_free(local_url);
+    return;
+  }
+
+  /* Replayed responses are queued for PerformMultiCurl, the network isn't
+     touched. */
+  if (TransportReplayRequest(mh, url, write_func, data))
+    return;
+
+  /* Fresh [or stale, revalidated in the background] cached responses are
+     served without touching curl, the handle isn't added. */
+  if (HttpCacheLookup(url, cache_key, write_func, data))
+    return;
+
+  /* Setup the cURL options. */
+  curl_easy_setopt(hnd, CURLOPT_BUFFERSIZE, 102400L);
+  /* Set the request URL */
+  curl_easy_setopt(hnd, CURLOPT_URL, url);
+  curl_easy_setopt(hnd, CURLOPT_NOPROGRESS, 1L);
+  curl_easy_setopt(hnd, CURLOPT_USERAGENT, "curl/7.80.0");
+  /* Some URLs require redirection. */
+  curl_easy_setopt(hnd, CURLOPT_FOLLOWLOCATION, 1L);
+  curl_easy_setopt(hnd, CURLOPT_MAXREDIRS, 5L);
+  curl_easy_setopt(hnd, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
+  curl_easy_setopt(hnd, CURLOPT_TCP_KEEPALIVE, 0L);
+  /* cURL advises to use this option in a multithreaded environment. */
+  /* It prevents unix signals during socket operations. */
+  curl_easy_setopt(hnd, CURLOPT_NOSIGNAL, 1L);
+  /* The callback function to write data to [through the http cache layer,
+     which also sets compressed encodings and the conditional headers]. */
+  HttpCacheRequest(hnd, url, cache_key, write_func, data);
+  /* Connection timeout after 5 seconds and a total data transfer timeout
+     after 10 seconds, until the host has enough samples.  Then three times
+     the host's p99 latency [a stuck request is hedged before its timeout].
+   */
+  glong timeout_ms = 10000;
+  gint64 p99 = TelemetryHostPercentileUs(url, 0.99);
+  if (p99 >= 0)
+    timeout_ms = CLAMP((glong)(p99 * 3 / 1000), 1500, timeout_ms);
+  curl_easy_setopt(hnd, CURLOPT_CONNECTTIMEOUT_MS, MIN(timeout_ms, 5000L));
+  curl_easy_setopt(hnd, CURLOPT_TIMEOUT_MS, timeout_ms);
+  /* Uncomment the next line for detailed info on
+     the connections cURL is communicating over. */
+  // curl_easy_setopt(hnd, CURLOPT_VERBOSE, 1L);
+
+  /* Only buffered bodies can be hedged, a stream is consumed as it arrives.
+   */
+  if (write_func == write_callback)
+    hedge_register(mh, hnd, url, (MemType *)data);
+
+  curl_multi_add_handle(mh, hnd);
+}
+
 gpointer SetUpCurlHandle(CURL *hnd, CURLM *mh, gchar *url, MemType *output)
 /* Take in an easy handle pointer address, a multihandle pointer address, a URL,
    and a struct pointer address, add easy handle to multi handle. */
+{
+  return SetUpCurlHandleValidated(hnd, mh, url, NULL, output);
+}
+
+gpointer SetUpCurlHandleValidated(CURL *hnd, CURLM *mh, gchar *url,
+                                  const gchar *cache_key, MemType *output)
+/* Same as SetUpCurlHandle, if cache_key isn't NULL the response is kept on
+   disk with its ETag/Last-Modified validators and later requests are sent
+   conditionally [a 304 reply fills output from disk]. */
 {
   /* Make sure output->memory = NULL
      or an allocated pointer addr. */
@@ -123,34 +479,8 @@ gpointer SetUpCurlHandle(CURL *hnd, CURLM *mh, gchar *url, MemType *output)
   output->size = 0; /* Initialize the size component of the structure. */
 
   if (hnd) {
-    /* Setup the cURL options. */
-    curl_easy_setopt(hnd, CURLOPT_BUFFERSIZE, 102400L);
-    /* Set the request URL */
-    curl_easy_setopt(hnd, CURLOPT_URL, url);
-    curl_easy_setopt(hnd, CURLOPT_NOPROGRESS, 1L);
-    curl_easy_setopt(hnd, CURLOPT_USERAGENT, "curl/7.80.0");
-    /* Some URLs require redirection. */
-    curl_easy_setopt(hnd, CURLOPT_FOLLOWLOCATION, 1L);
-    curl_easy_setopt(hnd, CURLOPT_MAXREDIRS, 5L);
-    curl_easy_setopt(hnd, CURLOPT_HTTP_VERSION, (long)CURL_HTTP_VERSION_2TLS);
-    curl_easy_setopt(hnd, CURLOPT_TCP_KEEPALIVE, 0L);
-    /* cURL advises to use this option in a multithreaded environment. */
-    /* It prevents unix signals during socket operations. */
-    curl_easy_setopt(hnd, CURLOPT_NOSIGNAL, 1L);
-    /* The callback function to write data to. */
-    curl_easy_setopt(hnd, CURLOPT_WRITEFUNCTION, write_callback);
-    /* Send the address of the data struct to callback func. */
-    curl_easy_setopt(hnd, CURLOPT_WRITEDATA, (gpointer)output);
-    /* Connection timeout after 5 seconds. */
-    curl_easy_setopt(hnd, CURLOPT_CONNECTTIMEOUT_MS, 5000);
-    /* Total data transfer timeout after 10 seconds,
-       this is a static use case, don't use in a dynamic use case. */
-    curl_easy_setopt(hnd, CURLOPT_TIMEOUT_MS, 10000);
-    /* Uncomment the next line for detailed info on
-       the connections cURL is communicating over. */
-    // curl_easy_setopt(hnd, CURLOPT_VERBOSE, 1L);
-
-    curl_multi_add_handle(mh, hnd);
+    set_curl_options(hnd, mh, url, cache_key, write_callback,
+                     (gpointer)output);
   } else {
     g_free(output->memory);
     g_print("cURL Library Failed, curl_easy_init() returned NULL.\n");
@@ -161,6 +491,24 @@ gpointer SetUpCurlHandle(CURL *hnd, CURLM *mh, gchar *url, MemType *output)
   return NULL;
 }
 
+gpointer SetUpCurlHandleStream(CURL *hnd, CURLM *mh, gchar *url,
+                               const gchar *cache_key,
+                               curl_write_callback write_func, gpointer data)
+/* Same as SetUpCurlHandleValidated, but the caller's write callback consumes
+   the datastream as it arrives [nothing is buffered here].  The callback
+   returns the number of bytes it handled, anything else aborts the transfer.
+ */
+{
+  if (hnd) {
+    set_curl_options(hnd, mh, url, cache_key, write_func, data);
+  } else {
+    g_print("cURL Library Failed, curl_easy_init() returned NULL.\n");
+    exit(EXIT_FAILURE);
+  }
+
+  return NULL;
+}
+
 gushort PerformMultiCurl(CURLM *mh, gdouble size)
 /* Take in a multi handle pointer and the number of easy handles,
    request data from remote server asynchronously. Update the main
@@ -169,7 +517,17 @@ gushort PerformMultiCurl(CURLM *mh, gdouble size)
    Returns 0 on success, otherwise the number of failed transfers.
 */
 {
-  curl_global_init(CURL_GLOBAL_ALL);
+  return PerformMultiCurlStream(mh, size, NULL, NULL);
+}
+
+gushort PerformMultiCurlStream(CURLM *mh, gdouble size,
+                               multicurl_done_func done_func, gpointer data)
+/* Same as PerformMultiCurl, each completed transfer is handed to done_func
+   as it arrives [processing overlaps the slower transfers]. */
+{
+  if (TransportReplaying())
+    return TransportReplayPerform(mh);
+
   if (!mh) {
     g_print("cURL Library Failed, curl_multi_init() returned NULL.\n");
     exit(EXIT_FAILURE);
@@ -179,13 +537,19 @@ gushort PerformMultiCurl(CURLM *mh, gdouble size)
   gint still_running = 0;
   gushort return_value = 0;
   gdouble fraction = 0.0f;
+  gboolean hedging = FALSE, drained = TRUE;
 
   do {
     gint numfds = 0;
 
     /* This will prevent other threads from interupting the transfer
        [they need to use the same mutex for this to work]. */
-    g_mutex_lock(&mutexes[MULTICURL_PROG_MUTEX]);
+    MutexLock(&mutexes[MULTICURL_PROG_MUTEX]);
+
+    /* Duplicate the requests running past their host's p95 [not while
+       completed transfers may be unread]. */
+    if (drained)
+      hedging = hedge_fire(mh);
 
     mc = curl_multi_perform(mh, &still_running);
 
@@ -205,13 +569,30 @@ gushort PerformMultiCurl(CURLM *mh, gdouble size)
 
     /* Update the GUI Progress Bar */
     fraction = 1 - (still_running / size);
-    MainProgBar(&fraction);
+    if (progress)
+      progress(&fraction);
+
+    /* With hedging candidates, finished transfers are resolved as they
+       arrive so the batch doesn't wait for the losing transfers [or
+       duplicate a finished one].  A stream consumer gets each response as
+       it arrives. */
+    drained = !hedging;
+    if ((hedging || done_func) &&
+        g_mutex_trylock(&mutexes[MULTICURL_REM_HAND_MUTEX])) {
+      return_value += remove_handles(mh, done_func, data);
+      g_mutex_unlock(&mutexes[MULTICURL_REM_HAND_MUTEX]);
+      drained = TRUE;
+    }
 
-    /* if there are still transfers, loop! */
+    /* if there are still transfers, loop!  The batch ends with its slowest
+       transfer, hedging only shortens the duplicated ones.  An unhedged
+       straggler is bounded by its CURLOPT_TIMEOUT_MS [three times its host's
+       p99]; ending the batch on an earlier deadline would drop its quote,
+       which is out of scope here. */
   } while (still_running);
 
   /* Reset the Progress Bar outside this function.
-     [ the MainProgBarReset function ]
+     [ the GUI's MainProgBarReset function ]
      Prevents data corruption through pointer passing.
   */
 
@@ -220,12 +601,14 @@ gushort PerformMultiCurl(CURLM *mh, gdouble size)
   if (g_mutex_trylock(&mutexes[MULTICURL_REM_HAND_MUTEX])) {
 
     /* Remove the easy handles from the mulltihandle. */
-    return_value = remove_handles(mh);
+    return_value += remove_handles(mh, done_func, data);
 
     g_mutex_unlock(&mutexes[MULTICURL_REM_HAND_MUTEX]);
   }
+  MutexLock(&mutexes[MULTICURL_PROG_MUTEX]);
+  return_value += hedge_clear(mh);
+  g_mutex_unlock(&mutexes[MULTICURL_PROG_MUTEX]);
 
-  curl_global_cleanup();
   return return_value;
 }
 
@@ -236,7 +619,9 @@ gushort PerformMultiCurl_no_prog(CURLM *mh)
    Returns 0 on success, otherwise the number of failed transfers.
 */
 {
-  curl_global_init(CURL_GLOBAL_ALL);
+  if (TransportReplaying())
+    return TransportReplayPerform(mh);
+
   if (!mh) {
     g_print("cURL Library Failed, curl_multi_init() returned NULL.\n");
     exit(EXIT_FAILURE);
@@ -245,13 +630,17 @@ gushort PerformMultiCurl_no_prog(CURLM *mh)
   CURLMcode mc = 0;
   gint still_running = 0;
   gushort return_value = 0;
+  gboolean hedging = FALSE;
 
   do {
     gint numfds = 0;
 
     /* This will prevent other threads from interupting the transfer
        [they need to use the same mutex for this to work]. */
-    g_mutex_lock(&mutexes[MULTICURL_NO_PROG_MUTEX]);
+    MutexLock(&mutexes[MULTICURL_NO_PROG_MUTEX]);
+
+    /* Duplicate the requests running past their host's p95. */
+    hedging = hedge_fire(mh);
 
     mc = curl_multi_perform(mh, &still_running);
 
@@ -269,12 +658,16 @@ gushort PerformMultiCurl_no_prog(CURLM *mh)
       break;
     }
 
+    /* Resolve finished transfers of a hedged batch as they arrive. */
+    if (hedging)
+      return_value += remove_handles(mh, NULL, NULL);
+
     /* if there are still transfers, loop! */
   } while (still_running);
 
   /* Remove the easy handles from the mulltihandle. */
-  return_value = remove_handles(mh);
+  return_value += remove_handles(mh, NULL, NULL);
+  return_value += hedge_clear(mh);
 
-  curl_global_cleanup();
   return return_value;
 }
\ No newline at end of file
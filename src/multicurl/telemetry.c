@@ -0,0 +1,382 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <glib/gprintf.h> /* g_fprintf() */
+
+#include "../include/multicurl.h"
+#include "../include/multicurl_types.h" /* telemetry_row */
+#include "../include/mutex.h"
+#include "../include/workfuncs.h" /* TraceEvent () */
+
+/* Per-request network telemetry.  Every completed transfer's curl timings
+   are added to a latency histogram for its host and one for its symbol
+   [the last URL path component, or the symbol query parameter]. */
+
+/* Total time bucket upper bounds in microseconds, the last bucket is
+   unbounded. */
+static const gint64 bucket_bound_arr[TELEMETRY_BUCKETS - 1] = {
+    1000,   2000,    5000,    10000,   20000,   50000,   100000,
+    200000, 500000, 1000000, 2000000, 5000000, 10000000};
+
+typedef struct {
+  guint64 count;
+  guint64 failed; /* A curl error or an HTTP status of 400 or more. */
+  guint64 bytes;
+  gint64 dns_us; /* Phase sums, for the averages. */
+  gint64 connect_us;
+  gint64 tls_us;
+  gint64 ttfb_us;
+  gint64 total_us;
+  gint64 max_us;
+  guint64 bucket_arr[TELEMETRY_BUCKETS];
+} telemetry_histogram;
+
+/* The tables are guarded by TELEMETRY_MUTEX. */
+static GHashTable *host_table = NULL;   /* Host to telemetry_histogram. */
+static GHashTable *symbol_table = NULL; /* Symbol to telemetry_histogram. */
+
+static void url_parts(const gchar *url, gchar *host, gsize host_len,
+                      gchar *symbol, gsize symbol_len)
+/* Copy the URL's host, and its symbol or last path component. */
+{
+  const gchar *h = url ? strstr(url, "://") : NULL;
+  h = h ? h + 3 : "";
+  g_strlcpy(host, h, MIN(host_len, strcspn(h, "/:?") + 1));
+
+  const gchar *s = url ? strstr(url, "symbol=") : NULL;
+  if (s)
+    s += strlen("symbol=");
+  else
+    s = url && strrchr(url, '/') ? strrchr(url, '/') + 1 : "";
+  g_strlcpy(symbol, s, MIN(symbol_len, strcspn(s, "?&") + 1));
+}
+
+static void histogram_add(GHashTable *table, const gchar *key, gint64 dns,
+                          gint64 connect, gint64 tls, gint64 ttfb,
+                          gint64 total, curl_off_t bytes, gboolean failed) {
+  telemetry_histogram *h = g_hash_table_lookup(table, key);
+  if (h == NULL) {
+    h = g_malloc0(sizeof(*h));
+    g_hash_table_insert(table, g_strdup(key), h);
+  }
+
+  guint b = 0;
+  while (b < TELEMETRY_BUCKETS - 1 && total > bucket_bound_arr[b])
+    b++;
+  h->bucket_arr[b]++;
+
+  h->count++;
+  h->failed += failed ? 1 : 0;
+  h->bytes += (guint64)bytes;
+  h->dns_us += dns;
+  h->connect_us += connect;
+  h->tls_us += tls;
+  h->ttfb_us += ttfb;
+  h->total_us += total;
+  h->max_us = MAX(h->max_us, total);
+}
+
+void TelemetryRecord(CURL *hnd, CURLcode rc)
+/* Record a completed transfer [it ended just now] in the histograms and as
+   dns/connect/tls/wait/download trace events. */
+{
+  curl_off_t dns = 0, connect = 0, tls = 0, pretransfer = 0, ttfb = 0,
+             total = 0, bytes = 0;
+  glong code = 0;
+  gchar *url = NULL, host[64], symbol[32];
+
+  curl_easy_getinfo(hnd, CURLINFO_NAMELOOKUP_TIME_T, &dns);
+  curl_easy_getinfo(hnd, CURLINFO_CONNECT_TIME_T, &connect);
+  curl_easy_getinfo(hnd, CURLINFO_APPCONNECT_TIME_T, &tls);
+  curl_easy_getinfo(hnd, CURLINFO_PRETRANSFER_TIME_T, &pretransfer);
+  curl_easy_getinfo(hnd, CURLINFO_STARTTRANSFER_TIME_T, &ttfb);
+  curl_easy_getinfo(hnd, CURLINFO_TOTAL_TIME_T, &total);
+  curl_easy_getinfo(hnd, CURLINFO_SIZE_DOWNLOAD_T, &bytes);
+  curl_easy_getinfo(hnd, CURLINFO_RESPONSE_CODE, &code);
+  curl_easy_getinfo(hnd, CURLINFO_EFFECTIVE_URL, &url);
+  url_parts(url, host, sizeof(host), symbol, sizeof(symbol));
+
+  /* The phases are cumulative from the start of the transfer; a reused
+     connection has no lookup, connect, or handshake phases. */
+  gint64 dns_us = dns, connect_us = MAX(connect - dns, 0),
+         tls_us = MAX(tls - connect, 0);
+  gboolean failed = rc != CURLE_OK || code >= 400;
+
+  gint64 start = g_get_monotonic_time() - total;
+  if (dns_us > 0)
+    TraceEvent("dns", symbol, start, dns_us);
+  if (connect_us > 0)
+    TraceEvent("connect", symbol, start + dns, connect_us);
+  if (tls > 0 && tls_us > 0)
+    TraceEvent("tls", symbol, start + connect, tls_us);
+  if (ttfb > pretransfer)
+    TraceEvent("wait", symbol, start + pretransfer, ttfb - pretransfer);
+  TraceEvent("download", symbol, start + ttfb, total - ttfb);
+
+  MutexLock(&mutexes[TELEMETRY_MUTEX]);
+  if (host_table == NULL) {
+    host_table =
+        g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+    symbol_table =
+        g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+  }
+  histogram_add(host_table, host, dns_us, connect_us, tls_us, ttfb, total,
+                bytes, failed);
+  histogram_add(symbol_table, symbol, dns_us, connect_us, tls_us, ttfb, total,
+                bytes, failed);
+  g_mutex_unlock(&mutexes[TELEMETRY_MUTEX]);
+}
+
+void TelemetryDestruct() {
+  MutexLock(&mutexes[TELEMETRY_MUTEX]);
+  if (host_table)
+    g_hash_table_destroy(host_table);
+  if (symbol_table)
+    g_hash_table_destroy(symbol_table);
+  host_table = symbol_table = NULL;
+  g_mutex_unlock(&mutexes[TELEMETRY_MUTEX]);
+}
+
+static gdouble histogram_percentile_ms(const telemetry_histogram *h,
+                                       gdouble p)
+/* Interpolate a percentile within its bucket, the last bucket ends at the
+   maximum. */
+{
+  gdouble rank = p * (gdouble)h->count;
+  guint64 below = 0;
+
+  for (guint b = 0; b < TELEMETRY_BUCKETS; b++) {
+    if (h->bucket_arr[b] == 0 || below + h->bucket_arr[b] < rank) {
+      below += h->bucket_arr[b];
+      continue;
+    }
+    gdouble lo = b ? (gdouble)bucket_bound_arr[b - 1] : 0.0;
+    gdouble hi = b < TELEMETRY_BUCKETS - 1 ? (gdouble)bucket_bound_arr[b]
+                                           : (gdouble)h->max_us;
+    hi = MIN(hi, (gdouble)h->max_us);
+    gdouble frac = (rank - (gdouble)below) / (gdouble)h->bucket_arr[b];
+    return (lo + frac * (MAX(hi, lo) - lo)) / 1000.0;
+  }
+  return (gdouble)h->max_us / 1000.0;
+}
+
+gint64 TelemetryHostPercentileUs(const gchar *url, gdouble p)
+/* The latency percentile of the URL's host in microseconds, -1 until the
+   host has TELEMETRY_MIN_SAMPLES completed transfers. */
+{
+  gchar host[64], symbol[32];
+  gint64 us = -1;
+  url_parts(url, host, sizeof(host), symbol, sizeof(symbol));
+
+  MutexLock(&mutexes[TELEMETRY_MUTEX]);
+  const telemetry_histogram *h =
+      host_table ? g_hash_table_lookup(host_table, host) : NULL;
+  if (h && h->count >= TELEMETRY_MIN_SAMPLES)
+    us = (gint64)(histogram_percentile_ms(h, p) * 1000.0);
+  g_mutex_unlock(&mutexes[TELEMETRY_MUTEX]);
+
+  return us;
+}
+
+static void telemetry_row_free(gpointer data) {
+  telemetry_row *r = (telemetry_row *)data;
+  g_free(r->key);
+  g_free(r);
+}
+
+static void snapshot_table(GPtrArray *rows, GHashTable *table,
+                           const gchar *scope) {
+  GHashTableIter iter;
+  gpointer key, value;
+
+  g_hash_table_iter_init(&iter, table);
+  while (g_hash_table_iter_next(&iter, &key, &value)) {
+    const telemetry_histogram *h = (telemetry_histogram *)value;
+    telemetry_row *r = g_malloc0(sizeof(*r));
+    gdouble n = (gdouble)h->count * 1000.0;
+
+    r->scope = scope;
+    r->key = g_strdup((gchar *)key);
+    r->count = h->count;
+    r->failed = h->failed;
+    r->p50_ms = histogram_percentile_ms(h, 0.50);
+    r->p95_ms = histogram_percentile_ms(h, 0.95);
+    r->p99_ms = histogram_percentile_ms(h, 0.99);
+    r->max_ms = (gdouble)h->max_us / 1000.0;
+    r->dns_ms = (gdouble)h->dns_us / n;
+    r->connect_ms = (gdouble)h->connect_us / n;
+    r->tls_ms = (gdouble)h->tls_us / n;
+    r->ttfb_ms = (gdouble)h->ttfb_us / n;
+    r->kib = (gdouble)h->bytes / 1024.0;
+    memcpy(r->bucket_arr, h->bucket_arr, sizeof(r->bucket_arr));
+    g_ptr_array_add(rows, r);
+  }
+}
+
+static gint row_cmp(gconstpointer a, gconstpointer b)
+/* Hosts before symbols, then the slowest tail first. */
+{
+  const telemetry_row *ra = *(telemetry_row *const *)a;
+  const telemetry_row *rb = *(telemetry_row *const *)b;
+  gint scope = g_strcmp0(ra->scope, rb->scope);
+  if (scope)
+    return scope;
+  return (ra->p99_ms < rb->p99_ms) - (ra->p99_ms > rb->p99_ms);
+}
+
+GPtrArray *TelemetrySnapshot()
+/* Return the per-host and per-symbol statistics as telemetry_row pointers.
+   Must free return value with g_ptr_array_unref. */
+{
+  GPtrArray *rows = g_ptr_array_new_with_free_func(telemetry_row_free);
+
+  MutexLock(&mutexes[TELEMETRY_MUTEX]);
+  if (host_table) {
+    snapshot_table(rows, host_table, "host");
+    snapshot_table(rows, symbol_table, "symbol");
+  }
+  g_mutex_unlock(&mutexes[TELEMETRY_MUTEX]);
+
+  g_ptr_array_sort(rows, row_cmp);
+  return rows;
+}
+
+static void prometheus_host(GString *out, const gchar *host,
+                            const telemetry_histogram *h) {
+  guint64 cumulative = 0;
+
+  g_string_append_printf(out,
+                         "financials_http_requests_total{host=\"%s\"} "
+                         "%" G_GUINT64_FORMAT "\n"
+                         "financials_http_failures_total{host=\"%s\"} "
+                         "%" G_GUINT64_FORMAT "\n"
+                         "financials_http_received_bytes_total{host=\"%s\"} "
+                         "%" G_GUINT64_FORMAT "\n",
+                         host, h->count, host, h->failed, host, h->bytes);
+  for (guint b = 0; b < TELEMETRY_BUCKETS; b++) {
+    cumulative += h->bucket_arr[b];
+    if (b < TELEMETRY_BUCKETS - 1)
+      g_string_append_printf(out,
+                             "financials_http_request_seconds_bucket"
+                             "{host=\"%s\",le=\"%g\"} %" G_GUINT64_FORMAT "\n",
+                             host, (gdouble)bucket_bound_arr[b] / 1e6,
+                             cumulative);
+    else
+      g_string_append_printf(out,
+                             "financials_http_request_seconds_bucket"
+                             "{host=\"%s\",le=\"+Inf\"} "
+                             "%" G_GUINT64_FORMAT "\n",
+                             host, cumulative);
+  }
+  g_string_append_printf(out,
+                         "financials_http_request_seconds_sum{host=\"%s\"} "
+                         "%.6f\n"
+                         "financials_http_request_seconds_count{host=\"%s\"} "
+                         "%" G_GUINT64_FORMAT "\n",
+                         host, (gdouble)h->total_us / 1e6, host, h->count);
+}
+
+void TelemetryPrometheus(GString *out)
+/* Append the per-host counters and latency histograms in the Prometheus
+   text format [see metrics.c]. */
+{
+  GHashTableIter iter;
+  gpointer key, value;
+
+  g_string_append(out, "# HELP financials_http_requests_total Completed "
+                       "transfers, per host.\n"
+                       "# TYPE financials_http_requests_total counter\n"
+                       "# HELP financials_http_failures_total Transfers with "
+                       "a curl error or an HTTP error status.\n"
+                       "# TYPE financials_http_failures_total counter\n"
+                       "# HELP financials_http_received_bytes_total Bytes "
+                       "downloaded, per host.\n"
+                       "# TYPE financials_http_received_bytes_total counter\n"
+                       "# HELP financials_http_request_seconds Transfer "
+                       "duration, per host.\n"
+                       "# TYPE financials_http_request_seconds histogram\n");
+
+  MutexLock(&mutexes[TELEMETRY_MUTEX]);
+  if (host_table) {
+    g_hash_table_iter_init(&iter, host_table);
+    while (g_hash_table_iter_next(&iter, &key, &value))
+      prometheus_host(out, (const gchar *)key,
+                      (const telemetry_histogram *)value);
+  }
+  g_mutex_unlock(&mutexes[TELEMETRY_MUTEX]);
+}
+
+gboolean TelemetryExportCsv(const gchar *path)
+/* Write the statistics and histogram bucket counts as CSV.
+
+   Returns TRUE on success. */
+{
+  GPtrArray *rows = TelemetrySnapshot();
+  GString *out = g_string_new("scope,key,requests,failed,p50_ms,p95_ms,"
+                              "p99_ms,max_ms,dns_ms,connect_ms,tls_ms,"
+                              "ttfb_ms,kib");
+  gchar num[G_ASCII_DTOSTR_BUF_SIZE];
+
+  for (guint b = 0; b < TELEMETRY_BUCKETS - 1; b++)
+    g_string_append_printf(out, ",le_%" G_GINT64_FORMAT "_ms",
+                           bucket_bound_arr[b] / 1000);
+  g_string_append(out, ",gt_10000_ms\n");
+
+  for (guint i = 0; i < rows->len; i++) {
+    const telemetry_row *r = g_ptr_array_index(rows, i);
+    const gdouble val_arr[] = {r->p50_ms,     r->p95_ms, r->p99_ms,
+                               r->max_ms,     r->dns_ms, r->connect_ms,
+                               r->tls_ms,     r->ttfb_ms, r->kib};
+
+    g_string_append_printf(out, "%s,%s,%" G_GUINT64_FORMAT
+                                ",%" G_GUINT64_FORMAT,
+                           r->scope, r->key, r->count, r->failed);
+    /* Locale independent decimal points. */
+    for (guint v = 0; v < G_N_ELEMENTS(val_arr); v++)
+      g_string_append_printf(
+          out, ",%s", g_ascii_formatd(num, sizeof(num), "%.3f", val_arr[v]));
+    for (guint b = 0; b < TELEMETRY_BUCKETS; b++)
+      g_string_append_printf(out, ",%" G_GUINT64_FORMAT, r->bucket_arr[b]);
+    g_string_append_c(out, '\n');
+  }
+
+  gboolean ok =
+      g_file_set_contents(path, out->str, (gssize)out->len, NULL);
+  if (ok)
+    g_print("Network telemetry written to '%s'.\n", path);
+  else
+    g_fprintf(stderr, "Cannot write the network telemetry to '%s'.\n", path);
+
+  g_string_free(out, TRUE);
+  g_ptr_array_unref(rows);
+  return ok;
+}
@@ -0,0 +1,377 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <glib/gprintf.h> /* g_fprintf() */
+#include <glib/gstdio.h>  /* g_fopen() */
+
+#include "../include/multicurl.h"
+#include "../include/multicurl_types.h"
+#include "../include/mutex.h"
+
+/* A record/replay transport beneath SetUpCurlHandle and PerformMultiCurl.
+
+   FINANCIALS_RECORD=<file> appends every completed transfer [URL, curl code,
+   HTTP status, start offset, duration, and decoded body] to a capture file.
+
+   FINANCIALS_REPLAY=<file> answers requests from a capture file, nothing
+   touches the network.  Responses are delivered after their recorded
+   durations [the transfers of one multi handle overlap, as they did when
+   recorded], or at once with FINANCIALS_REPLAY_SPEED=max.  Each URL's
+   responses are replayed in the order they were recorded, wrapping around
+   when exhausted.  URLs are matched with HttpCacheUrlKey, so moving Yahoo!
+   time windows still match.
+
+   FINANCIALS_BASE_URL=<scheme://host:port> sends every request to a local
+   server instead [bench/mock_server.c], keeping the URL paths.
+
+   The capture file is a header line, then one record per transfer:
+
+     FINCAP 1
+     R <start_us> <duration_us> <curl_code> <http_status> <url_len> <body_len>
+     <url><body> */
+
+#define TRANSPORT_MAGIC "FINCAP 1\n"
+
+enum { TRANSPORT_LIVE, TRANSPORT_RECORD, TRANSPORT_REPLAY };
+
+typedef struct {
+  gint64 start_us;
+  gint64 duration_us;
+  gint rc;
+  glong code;
+  const gchar *body; /* Points into the capture file contents. */
+  gsize len;
+} transport_record;
+
+typedef struct {
+  GPtrArray *records; /* transport_record, in recorded order. */
+  guint next;
+} transport_key_records;
+
+typedef struct {
+  const transport_record *record; /* NULL if the URL wasn't recorded. */
+  gchar *url;
+  curl_write_callback write_func;
+  gpointer data;
+} transport_pending;
+
+/* The transport state is guarded by TRANSPORT_MUTEX, the mode is set once at
+   startup. */
+static guint8 mode = TRANSPORT_LIVE;
+static gboolean replay_max_speed = FALSE;
+static FILE *capture = NULL;
+static gint64 capture_epoch_us = 0;
+static gchar *base_url = NULL;
+static gchar *replay_contents = NULL;
+static GHashTable *replay_table = NULL;  /* Key to transport_key_records. */
+static GHashTable *pending_table = NULL; /* CURLM to GPtrArray of
+                                            transport_pending. */
+
+static void key_records_free(gpointer data) {
+  transport_key_records *k = (transport_key_records *)data;
+  g_ptr_array_free(k->records, TRUE);
+  g_free(k);
+}
+
+static void pending_free(gpointer data) {
+  transport_pending *p = (transport_pending *)data;
+  g_free(p->url);
+  g_free(p);
+}
+
+static void pending_array_free(gpointer data) {
+  g_ptr_array_free((GPtrArray *)data, TRUE);
+}
+
+static gboolean replay_load(const gchar *path)
+/* Parse a capture file into replay_table.  Returns FALSE on a malformed
+   file. */
+{
+  gsize size = 0;
+  if (!g_file_get_contents(path, &replay_contents, &size, NULL) ||
+      !g_str_has_prefix(replay_contents, TRANSPORT_MAGIC))
+    return FALSE;
+
+  replay_table = g_hash_table_new_full(g_str_hash, g_str_equal, g_free,
+                                       key_records_free);
+
+  gchar *pos = replay_contents + strlen(TRANSPORT_MAGIC);
+  gchar *end = replay_contents + size;
+
+  while (pos < end) {
+    transport_record *r = g_malloc0(sizeof(*r));
+    gsize url_len = 0;
+    gchar *line_end = memchr(pos, '\n', (gsize)(end - pos));
+
+    if (line_end == NULL ||
+        sscanf(pos, "R %" G_GINT64_FORMAT " %" G_GINT64_FORMAT " %d %ld %zu %zu",
+               &r->start_us, &r->duration_us, &r->rc, &r->code, &url_len,
+               &r->len) != 6 ||
+        url_len + r->len + 1 > (gsize)(end - line_end)) {
+      g_free(r);
+      return FALSE;
+    }
+
+    gchar *url = g_strndup(line_end + 1, url_len);
+    r->body = line_end + 1 + url_len;
+    pos = (gchar *)r->body + r->len + 1; /* Skip the trailing newline. */
+
+    gchar *key = HttpCacheUrlKey(url);
+    g_free(url);
+
+    transport_key_records *k = g_hash_table_lookup(replay_table, key);
+    if (k == NULL) {
+      k = g_malloc0(sizeof(*k));
+      k->records = g_ptr_array_new_with_free_func(g_free);
+      g_hash_table_insert(replay_table, key, k);
+    } else {
+      g_free(key);
+    }
+    g_ptr_array_add(k->records, r);
+  }
+
+  return TRUE;
+}
+
+void TransportInit()
+/* Select the transport from the environment. */
+{
+  const gchar *record_path = g_getenv("FINANCIALS_RECORD");
+  const gchar *replay_path = g_getenv("FINANCIALS_REPLAY");
+
+  if (g_getenv("FINANCIALS_BASE_URL"))
+    TransportSetBaseUrl(g_getenv("FINANCIALS_BASE_URL"));
+
+  if (replay_path) {
+    if (!replay_load(replay_path)) {
+      g_fprintf(stderr, "Cannot replay '%s', not a valid capture file.\n",
+                replay_path);
+      exit(EXIT_FAILURE);
+    }
+    pending_table = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL,
+                                          pending_array_free);
+    replay_max_speed =
+        !g_strcmp0(g_getenv("FINANCIALS_REPLAY_SPEED"), "max");
+    mode = TRANSPORT_REPLAY;
+
+  } else if (record_path) {
+    gboolean new_file = !g_file_test(record_path, G_FILE_TEST_EXISTS);
+    capture = g_fopen(record_path, "ab");
+    if (capture == NULL) {
+      g_fprintf(stderr, "Cannot record to '%s'.\n", record_path);
+      exit(EXIT_FAILURE);
+    }
+    if (new_file)
+      fputs(TRANSPORT_MAGIC, capture);
+    capture_epoch_us = g_get_monotonic_time();
+    mode = TRANSPORT_RECORD;
+  }
+}
+
+void TransportDestruct() {
+  MutexLock(&mutexes[TRANSPORT_MUTEX]);
+
+  if (capture)
+    fclose(capture);
+  capture = NULL;
+
+  if (pending_table)
+    g_hash_table_destroy(pending_table);
+  if (replay_table)
+    g_hash_table_destroy(replay_table);
+  pending_table = replay_table = NULL;
+
+  g_free(replay_contents);
+  g_free(base_url);
+  replay_contents = base_url = NULL;
+
+  mode = TRANSPORT_LIVE;
+
+  g_mutex_unlock(&mutexes[TRANSPORT_MUTEX]);
+}
+
+void TransportSetBaseUrl(const gchar *url)
+/* Send every later request to url, NULL restores the original hosts. */
+{
+  MutexLock(&mutexes[TRANSPORT_MUTEX]);
+  g_free(base_url);
+  base_url = url ? g_strdup(url) : NULL;
+  /* Drop a trailing slash, the request paths start with one. */
+  if (base_url && g_str_has_suffix(base_url, "/"))
+    base_url[strlen(base_url) - 1] = 0;
+  g_mutex_unlock(&mutexes[TRANSPORT_MUTEX]);
+}
+
+gchar *TransportUrl(const gchar *url)
+/* Return url with its scheme and host replaced by the base URL, or NULL if
+   no base URL is set or url already points at it.  Must free return value.
+ */
+{
+  gchar *local_url = NULL;
+
+  MutexLock(&mutexes[TRANSPORT_MUTEX]);
+
+  const gchar *host = strstr(url, "://");
+  if (base_url && host && !g_str_has_prefix(url, base_url)) {
+    const gchar *path = strchr(host + 3, '/');
+    local_url = g_strconcat(base_url, path ? path : "/", NULL);
+  }
+
+  g_mutex_unlock(&mutexes[TRANSPORT_MUTEX]);
+  return local_url;
+}
+
+gboolean TransportActive() { return mode != TRANSPORT_LIVE; }
+
+gboolean TransportRecording() { return mode == TRANSPORT_RECORD; }
+
+gboolean TransportReplaying() { return mode == TRANSPORT_REPLAY; }
+
+void TransportRecord(const gchar *url, CURLcode rc, glong code,
+                     gint64 start_us, gint64 duration_us, const gchar *body,
+                     gsize len)
+/* Append a completed transfer to the capture file. */
+{
+  MutexLock(&mutexes[TRANSPORT_MUTEX]);
+
+  if (capture) {
+    g_fprintf(capture,
+              "R %" G_GINT64_FORMAT " %" G_GINT64_FORMAT " %d %ld %zu %zu\n",
+              start_us - capture_epoch_us, duration_us, (gint)rc, code,
+              strlen(url), len);
+    fputs(url, capture);
+    fwrite(body, 1, len, capture);
+    fputc('\n', capture);
+    fflush(capture);
+  }
+
+  g_mutex_unlock(&mutexes[TRANSPORT_MUTEX]);
+}
+
+gboolean TransportReplayRequest(CURLM *mh, const gchar *url,
+                                curl_write_callback write_func,
+                                gpointer data)
+/* Queue the next recorded response for a URL on a multi handle, it's
+   delivered by TransportReplayPerform.
+
+   Returns TRUE if replaying, the request must not be performed. */
+{
+  if (mode != TRANSPORT_REPLAY)
+    return FALSE;
+
+  gchar *key = HttpCacheUrlKey(url);
+  transport_pending *p = g_malloc0(sizeof(*p));
+  p->url = g_strdup(url);
+  p->write_func = write_func;
+  p->data = data;
+
+  MutexLock(&mutexes[TRANSPORT_MUTEX]);
+
+  transport_key_records *k =
+      replay_table ? g_hash_table_lookup(replay_table, key) : NULL;
+  if (k) {
+    p->record = g_ptr_array_index(k->records, k->next);
+    k->next = (k->next + 1) % k->records->len;
+  }
+
+  GPtrArray *queue = g_hash_table_lookup(pending_table, mh);
+  if (queue == NULL) {
+    queue = g_ptr_array_new_with_free_func(pending_free);
+    g_hash_table_insert(pending_table, mh, queue);
+  }
+  g_ptr_array_add(queue, p);
+
+  g_mutex_unlock(&mutexes[TRANSPORT_MUTEX]);
+
+  g_free(key);
+  return TRUE;
+}
+
+static gint pending_cmp(gconstpointer a, gconstpointer b)
+/* Order pending responses by their recorded duration. */
+{
+  const transport_pending *pa = *(transport_pending *const *)a;
+  const transport_pending *pb = *(transport_pending *const *)b;
+  gint64 da = pa->record ? pa->record->duration_us : 0;
+  gint64 db = pb->record ? pb->record->duration_us : 0;
+  return (da > db) - (da < db);
+}
+
+gushort TransportReplayPerform(CURLM *mh)
+/* Deliver the responses queued on a multi handle.  At recorded speed each one
+   completes its recorded duration after the call, as concurrent transfers.
+
+   Returns 0 on success, otherwise the number of failed transfers. */
+{
+  gushort return_value = 0;
+
+  MutexLock(&mutexes[TRANSPORT_MUTEX]);
+  GPtrArray *queue = NULL;
+  if (pending_table)
+    g_hash_table_steal_extended(pending_table, mh, NULL, (gpointer *)&queue);
+  g_mutex_unlock(&mutexes[TRANSPORT_MUTEX]);
+
+  if (queue == NULL)
+    return 0;
+
+  g_ptr_array_sort(queue, pending_cmp);
+  gint64 start_us = g_get_monotonic_time();
+
+  for (guint i = 0; i < queue->len; i++) {
+    transport_pending *p = g_ptr_array_index(queue, i);
+    const transport_record *r = p->record;
+
+    if (r == NULL) {
+      g_fprintf(stderr, "No recorded response for %s\n", p->url);
+      return_value++;
+      continue;
+    }
+
+    if (!replay_max_speed) {
+      gint64 wait_us = start_us + r->duration_us - g_get_monotonic_time();
+      if (wait_us > 0)
+        g_usleep((gulong)wait_us);
+    }
+
+    if (r->rc != CURLE_OK)
+      g_fprintf(stderr, "CURL code: %d\n", r->rc);
+
+    /* A rejected body aborts the transfer, as with curl. */
+    if (r->rc != CURLE_OK ||
+        (r->len && p->write_func((gchar *)r->body, 1, r->len, p->data) !=
+                       r->len))
+      return_value++;
+  }
+
+  g_ptr_array_free(queue, TRUE);
+  return return_value;
+}
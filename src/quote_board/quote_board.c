@@ -0,0 +1,182 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <fcntl.h>
+#include <glib.h>
+#include <glib/gprintf.h>
+#include <sys/file.h> /* flock () */
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "../include/mutex.h"
+#include "../include/quote_board.h"
+
+/* The shared-memory quote board publisher, enabled by setting
+   FINANCIALS_QUOTE_BOARD in the environment.  Every extracted quote is
+   written to its record, local readers [see quote_board_reader.c] poll it
+   without a syscall or an API call. */
+
+/* Guarded by QUOTE_BOARD_MUTEX. */
+static quote_board_header *board = NULL;
+static GHashTable *slot_table = NULL; /* symbol -> slot + 1 */
+static gint board_fd = -1;
+
+static quote_board_record *board_records(quote_board_header *H) {
+  return (quote_board_record *)(H + 1);
+}
+
+static void board_reset(quote_board_header *H)
+/* Blank the records, a reader of the previous publisher's board may still
+   be mapped.  The sequence restarts at 0 [odd while blanking], a crashed
+   publisher may have left it odd. */
+{
+  quote_board_record *R = board_records(H);
+
+  for (guint32 s = 0; s < QUOTE_BOARD_SLOTS; s++) {
+    atomic_store_explicit(&R[s].seq, 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    memset(R[s].symbol, 0, sizeof(R[s].symbol));
+    R[s].price = R[s].change = R[s].change_percent = R[s].prev_close = 0;
+    R[s].time_us = 0;
+    atomic_store_explicit(&R[s].seq, 0, memory_order_release);
+  }
+
+  H->magic = QUOTE_BOARD_MAGIC;
+  H->version = QUOTE_BOARD_VERSION;
+  H->slots = QUOTE_BOARD_SLOTS;
+  H->writer_pid = (guint32)getpid();
+  atomic_store_explicit(&H->count, 0, memory_order_release);
+  atomic_fetch_add_explicit(&H->epoch, 1, memory_order_release);
+}
+
+void QuoteBoardInit(void) {
+  if (g_getenv("FINANCIALS_QUOTE_BOARD") == NULL)
+    return;
+
+  const gchar *dir = g_getenv("XDG_RUNTIME_DIR");
+  if (dir == NULL || dir[0] == 0) {
+    g_fprintf(stderr, "XDG_RUNTIME_DIR is unset, no quote board.\n");
+    return;
+  }
+
+  gchar *path = g_build_filename(dir, QUOTE_BOARD_NAME, NULL);
+  gint fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+  if (fd < 0) {
+    g_fprintf(stderr, "Cannot open the quote board '%s'.\n", path);
+    g_free(path);
+    return;
+  }
+
+  /* One publisher at a time, the lock is released when fd closes. */
+  if (flock(fd, LOCK_EX | LOCK_NB) < 0) {
+    g_fprintf(stderr, "The quote board '%s' has another publisher.\n", path);
+    close(fd);
+    g_free(path);
+    return;
+  }
+
+  /* Growing the file never moves a reader's mapping. */
+  void *map = MAP_FAILED;
+  if (ftruncate(fd, QUOTE_BOARD_SIZE) == 0)
+    map = mmap(NULL, QUOTE_BOARD_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+               0);
+  if (map == MAP_FAILED) {
+    g_fprintf(stderr, "Cannot map the quote board '%s'.\n", path);
+    close(fd);
+    g_free(path);
+    return;
+  }
+
+  MutexLock(&mutexes[QUOTE_BOARD_MUTEX]);
+  board = (quote_board_header *)map;
+  board_fd = fd;
+  slot_table = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+  board_reset(board);
+  g_mutex_unlock(&mutexes[QUOTE_BOARD_MUTEX]);
+  g_free(path);
+}
+
+void QuoteBoardPublish(const char *symbol, double price, double change,
+                       double change_percent, double prev_close)
+/* Write one quote to its record, a new symbol takes the next free record.
+   Does nothing if the board is disabled or full. */
+{
+  if (symbol == NULL)
+    return;
+
+  MutexLock(&mutexes[QUOTE_BOARD_MUTEX]);
+  if (board == NULL) {
+    g_mutex_unlock(&mutexes[QUOTE_BOARD_MUTEX]);
+    return;
+  }
+
+  guint slot = GPOINTER_TO_UINT(g_hash_table_lookup(slot_table, symbol));
+  if (slot == 0) {
+    guint32 count = atomic_load_explicit(&board->count, memory_order_relaxed);
+    if (count == QUOTE_BOARD_SLOTS) {
+      g_mutex_unlock(&mutexes[QUOTE_BOARD_MUTEX]);
+      return;
+    }
+    slot = count + 1;
+    g_hash_table_insert(slot_table, g_strdup(symbol), GUINT_TO_POINTER(slot));
+  }
+
+  quote_board_record rec = {0};
+  g_strlcpy(rec.symbol, symbol, sizeof(rec.symbol));
+  rec.price = price;
+  rec.change = change;
+  rec.change_percent = change_percent;
+  rec.prev_close = prev_close;
+  rec.time_us = g_get_real_time();
+  quote_board_record_write(&board_records(board)[slot - 1], &rec);
+
+  /* Publish the record before readers can find it by count. */
+  if (slot > atomic_load_explicit(&board->count, memory_order_relaxed))
+    atomic_store_explicit(&board->count, slot, memory_order_release);
+  g_mutex_unlock(&mutexes[QUOTE_BOARD_MUTEX]);
+}
+
+void QuoteBoardDestruct(void)
+/* The file stays [readers keep their mapping], the next publisher resets
+   it. */
+{
+  MutexLock(&mutexes[QUOTE_BOARD_MUTEX]);
+  if (board) {
+    munmap(board, QUOTE_BOARD_SIZE);
+    close(board_fd);
+    g_hash_table_destroy(slot_table);
+    board = NULL;
+    slot_table = NULL;
+    board_fd = -1;
+  }
+  g_mutex_unlock(&mutexes[QUOTE_BOARD_MUTEX]);
+}
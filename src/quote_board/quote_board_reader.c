@@ -0,0 +1,146 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../include/quote_board.h"
+
+/* The quote board reader library [libquoteboard.a], plain C so a status-bar
+   widget or a script binding can poll the prices financials publishes
+   without glib.  Open once, find each symbol's slot once, then read the
+   slot as often as needed; QuoteBoardEpoch () changes when a new publisher
+   starts and the slots must be found again. */
+
+struct quote_board {
+  int fd;
+  const quote_board_header *header;
+  const quote_board_record *records;
+};
+
+quote_board *QuoteBoardOpen(const char *path)
+/* path NULL opens $XDG_RUNTIME_DIR/financials.quotes.  Returns NULL if the
+   board doesn't exist or isn't a quote board. */
+{
+  char buf[4096];
+
+  if (path == NULL) {
+    const char *dir = getenv("XDG_RUNTIME_DIR");
+    if (dir == NULL || dir[0] == 0)
+      return NULL;
+    if ((size_t)snprintf(buf, sizeof(buf), "%s/%s", dir, QUOTE_BOARD_NAME) >=
+        sizeof(buf))
+      return NULL;
+    path = buf;
+  }
+
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return NULL;
+
+  /* A short file would fault on read. */
+  struct stat st;
+  if (fstat(fd, &st) < 0 || (size_t)st.st_size < QUOTE_BOARD_SIZE) {
+    close(fd);
+    return NULL;
+  }
+
+  void *map = mmap(NULL, QUOTE_BOARD_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED) {
+    close(fd);
+    return NULL;
+  }
+
+  const quote_board_header *H = (const quote_board_header *)map;
+  if (H->magic != QUOTE_BOARD_MAGIC || H->version != QUOTE_BOARD_VERSION ||
+      H->slots != QUOTE_BOARD_SLOTS) {
+    munmap(map, QUOTE_BOARD_SIZE);
+    close(fd);
+    return NULL;
+  }
+
+  quote_board *qb = malloc(sizeof(*qb));
+  if (qb == NULL) {
+    munmap(map, QUOTE_BOARD_SIZE);
+    close(fd);
+    return NULL;
+  }
+  qb->fd = fd;
+  qb->header = H;
+  qb->records = (const quote_board_record *)(H + 1);
+  return qb;
+}
+
+int QuoteBoardFind(const quote_board *qb, const char *symbol)
+/* Returns the symbol's slot, -1 if it hasn't been published. */
+{
+  quote_board_header *H = (quote_board_header *)qb->header;
+  uint32_t count = atomic_load_explicit(&H->count, memory_order_acquire);
+  quote_board_record rec;
+
+  for (uint32_t s = 0; s < count && s < QUOTE_BOARD_SLOTS; s++) {
+    if (quote_board_record_read(&qb->records[s], &rec) < 0)
+      continue;
+    if (strncmp(rec.symbol, symbol, sizeof(rec.symbol)) == 0)
+      return (int)s;
+  }
+  return -1;
+}
+
+int QuoteBoardRead(const quote_board *qb, int slot, quote_board_record *out)
+/* Copy the slot's latest quote into out.  Returns 0, or -1 if the slot is
+   out of range, unused, or stuck mid-write. */
+{
+  if (slot < 0 || (uint32_t)slot >= QUOTE_BOARD_SLOTS)
+    return -1;
+
+  if (quote_board_record_read(&qb->records[slot], out) < 0)
+    return -1;
+  return out->time_us ? 0 : -1;
+}
+
+uint32_t QuoteBoardEpoch(const quote_board *qb) {
+  quote_board_header *H = (quote_board_header *)qb->header;
+  return atomic_load_explicit(&H->epoch, memory_order_acquire);
+}
+
+void QuoteBoardClose(quote_board *qb) {
+  if (qb == NULL)
+    return;
+  munmap((void *)qb->header, QUOTE_BOARD_SIZE);
+  close(qb->fd);
+  free(qb);
+}
@@ -6,7 +6,7 @@
 # define SECTION
 #endif
 
-static const SECTION union { const guint8 data[16488]; const double alignment; void * const ptr;}  resources_resource_data = { {
+static const SECTION union { const guint8 data[16699]; const double alignment; void * const ptr;}  resources_resource_data = { {
   0107, 0126, 0141, 0162, 0151, 0141, 0156, 0164, 0000, 0000, 0000, 0000, 0000, 0000, 0000, 0000, 
   0030, 0000, 0000, 0000, 0220, 0000, 0000, 0000, 0000, 0000, 0000, 0050, 0004, 0000, 0000, 0000, 
   0000, 0000, 0000, 0000, 0003, 0000, 0000, 0000, 0003, 0000, 0000, 0000, 0003, 0000, 0000, 0000, 
@@ -15,7 +15,7 @@ static const SECTION union { const guint8 data[16488]; const double alignment; v
   0057, 0020, 0000, 0000, 0017, 0000, 0166, 0000, 0100, 0020, 0000, 0000, 0052, 0030, 0000, 0000, 
   0324, 0265, 0002, 0000, 0377, 0377, 0377, 0377, 0052, 0030, 0000, 0000, 0001, 0000, 0114, 0000, 
   0054, 0030, 0000, 0000, 0070, 0030, 0000, 0000, 0267, 0013, 0072, 0345, 0002, 0000, 0000, 0000, 
-  0070, 0030, 0000, 0000, 0020, 0000, 0166, 0000, 0110, 0030, 0000, 0000, 0147, 0100, 0000, 0000, 
+  0070, 0030, 0000, 0000, 0020, 0000, 0166, 0000, 0110, 0030, 0000, 0000, 0072, 0101, 0000, 0000, 
   0123, 0164, 0157, 0143, 0153, 0163, 0055, 0151, 0143, 0157, 0156, 0055, 0061, 0062, 0070, 0056, 
   0160, 0156, 0147, 0000, 0000, 0000, 0000, 0000, 0167, 0017, 0000, 0000, 0000, 0000, 0000, 0000, 
   0211, 0120, 0116, 0107, 0015, 0012, 0032, 0012, 0000, 0000, 0000, 0015, 0111, 0110, 0104, 0122, 
@@ -395,649 +395,662 @@ static const SECTION union { const guint8 data[16488]; const double alignment; v
   0202, 0122, 0203, 0266, 0020, 0074, 0000, 0000, 0000, 0000, 0111, 0105, 0116, 0104, 0256, 0102, 
   0140, 0202, 0000, 0000, 0050, 0165, 0165, 0141, 0171, 0051, 0057, 0000, 0000, 0000, 0000, 0000, 
   0001, 0000, 0000, 0000, 0003, 0000, 0000, 0000, 0146, 0151, 0156, 0141, 0156, 0143, 0151, 0141, 
-  0154, 0163, 0056, 0147, 0154, 0141, 0144, 0145, 0233, 0155, 0003, 0000, 0001, 0000, 0000, 0000, 
-  0170, 0332, 0355, 0175, 0353, 0166, 0333, 0070, 0226, 0356, 0177, 0077, 0005, 0132, 0353, 0254, 
-  0236, 0256, 0065, 0241, 0043, 0311, 0161, 0122, 0335, 0125, 0161, 0057, 0331, 0226, 0143, 0235, 
-  0044, 0226, 0333, 0222, 0223, 0316, 0374, 0311, 0120, 0044, 0154, 0141, 0114, 0022, 0054, 0022, 
-  0264, 0255, 0132, 0347, 0205, 0316, 0153, 0234, 0047, 0073, 0000, 0051, 0131, 0222, 0305, 0013, 
-  0300, 0213, 0104, 0111, 0273, 0327, 0232, 0232, 0130, 0044, 0100, 0134, 0366, 0267, 0357, 0330, 
-  0370, 0375, 0237, 0317, 0266, 0205, 0036, 0261, 0347, 0023, 0352, 0174, 0154, 0264, 0016, 0233, 
-  0015, 0204, 0035, 0203, 0232, 0304, 0271, 0377, 0330, 0270, 0035, 0136, 0150, 0277, 0066, 0376, 
-  0171, 0162, 0360, 0373, 0137, 0064, 0015, 0175, 0302, 0016, 0366, 0164, 0206, 0115, 0364, 0104, 
-  0330, 0030, 0335, 0133, 0272, 0211, 0321, 0321, 0341, 0273, 0346, 0141, 0023, 0151, 0032, 0177, 
-  0211, 0070, 0014, 0173, 0167, 0272, 0201, 0117, 0016, 0020, 0372, 0335, 0303, 0177, 0004, 0304, 
-  0303, 0076, 0262, 0310, 0350, 0143, 0343, 0236, 0075, 0374, 0147, 0143, 0376, 0241, 0243, 0303, 
-  0366, 0273, 0306, 0333, 0360, 0075, 0072, 0372, 0037, 0154, 0060, 0144, 0130, 0272, 0357, 0177, 
-  0154, 0174, 0142, 0017, 0137, 0261, 0023, 0064, 0020, 0061, 0077, 0066, 0072, 0327, 0275, 0360, 
-  0017, 0361, 0036, 0177, 0323, 0365, 0250, 0213, 0075, 0066, 0101, 0216, 0156, 0343, 0217, 0215, 
-  0107, 0342, 0223, 0221, 0205, 0033, 0047, 0103, 0057, 0300, 0277, 0277, 0235, 0075, 0215, 0177, 
-  0331, 0320, 0035, 0355, 0216, 0032, 0201, 0337, 0070, 0271, 0320, 0055, 0177, 0365, 0175, 0143, 
-  0114, 0054, 0063, 0372, 0167, 0322, 0240, 0172, 0014, 0333, 0113, 0003, 0073, 0263, 0250, 0217, 
-  0033, 0263, 0106, 0212, 0043, 0314, 0063, 0312, 0270, 0066, 0226, 0076, 0302, 0126, 0003, 0061, 
-  0117, 0167, 0174, 0113, 0147, 0072, 0377, 0340, 0307, 0306, 0004, 0363, 0056, 0176, 0206, 0343, 
-  0223, 0351, 0043, 0360, 0261, 0026, 0070, 0046, 0366, 0054, 0342, 0244, 0015, 0127, 0067, 0014, 
-  0154, 0011, 0042, 0240, 0036, 0172, 0300, 0023, 0076, 0340, 0006, 0362, 0311, 0275, 0243, 0133, 
-  0037, 0033, 0272, 0301, 0310, 0043, 0047, 0217, 0006, 0262, 0071, 0371, 0334, 0021, 0276, 0325, 
-  0174, 0345, 0316, 0077, 0377, 0074, 0353, 0137, 0015, 0157, 0372, 0137, 0176, 0176, 0355, 0014, 
-  0076, 0107, 0173, 0036, 0366, 0365, 0066, 0132, 0343, 0351, 0362, 0277, 0175, 0131, 0377, 0305, 
-  0007, 0253, 0373, 0360, 0235, 0070, 0046, 0175, 0232, 0356, 0202, 0113, 0246, 0177, 0346, 0334, 
-  0363, 0230, 0367, 0115, 0174, 0247, 0007, 0026, 0223, 0043, 0052, 0116, 0335, 0344, 0117, 0075, 
-  0334, 0141, 0251, 0017, 0114, 0073, 0327, 0236, 0210, 0311, 0306, 0215, 0223, 0343, 0343, 0246, 
-  0154, 0213, 0061, 0046, 0367, 0143, 0076, 0252, 0266, 0114, 0023, 0237, 0171, 0164, 0242, 0011, 
-  0220, 0152, 0256, 0356, 0141, 0107, 0162, 0066, 0304, 0240, 0116, 0343, 0144, 0300, 0250, 0361, 
-  0340, 0153, 0342, 0217, 0103, 0327, 0271, 0317, 0152, 0344, 0077, 0020, 0227, 0177, 0345, 0036, 
-  0173, 0332, 0230, 0044, 0176, 0051, 0003, 0134, 0247, 0364, 0171, 0323, 0050, 0262, 0165, 0357, 
-  0236, 0070, 0032, 0243, 0056, 0137, 0344, 0246, 0102, 0213, 0021, 0145, 0214, 0332, 0215, 0223, 
-  0226, 0124, 0043, 0352, 0021, 0276, 0037, 0072, 0043, 0142, 0251, 0071, 0067, 0144, 0304, 0320, 
-  0055, 0231, 0206, 0276, 0253, 0033, 0234, 0047, 0313, 0016, 0156, 0244, 0373, 0130, 0140, 0131, 
-  0163, 0251, 0117, 0242, 0257, 0361, 0251, 0305, 0266, 0134, 0332, 0233, 0370, 0375, 0271, 0242, 
-  0014, 0217, 0050, 0175, 0170, 0141, 0176, 0057, 0077, 0054, 0266, 0313, 0261, 0163, 0031, 0273, 
-  0247, 0322, 0314, 0037, 0323, 0047, 0276, 0031, 0036, 0147, 0142, 0051, 0333, 0036, 0077, 0143, 
-  0031, 0252, 0054, 0064, 0307, 0274, 0124, 0232, 0101, 0173, 0076, 0323, 0075, 0226, 0104, 0172, 
-  0031, 0155, 0261, 0143, 0346, 0154, 0031, 0142, 0344, 0070, 0107, 0303, 0031, 0124, 0224, 0332, 
-  0112, 0043, 0046, 0023, 0071, 0031, 0223, 0015, 0251, 0002, 0261, 0211, 0053, 0366, 0006, 0013, 
-  0125, 0046, 0146, 0367, 0343, 0350, 0244, 0353, 0060, 0157, 0362, 0042, 0221, 0156, 0075, 0353, 
-  0063, 0236, 0204, 0277, 0305, 0023, 0120, 0041, 0042, 0052, 0000, 0230, 0244, 0346, 0214, 0122, 
-  0213, 0161, 0046, 0316, 0360, 0063, 0213, 0125, 0043, 0072, 0256, 0313, 0211, 0005, 0065, 0376, 
-  0252, 0333, 0356, 0157, 0214, 0076, 0140, 0256, 0277, 0241, 0021, 0276, 0243, 0036, 0106, 0023, 
-  0032, 0170, 0350, 0216, 0070, 0316, 0070, 0030, 0035, 0022, 0052, 0224, 0202, 0303, 0203, 0203, 
-  0305, 0127, 0377, 0152, 0261, 0337, 0176, 0364, 0157, 0157, 0120, 0347, 0354, 0254, 0177, 0173, 
-  0065, 0104, 0237, 0273, 0077, 0376, 0172, 0317, 0176, 0153, 0250, 0216, 0363, 0121, 0267, 0270, 
-  0246, 0321, 0070, 0211, 0366, 0106, 0265, 0365, 0062, 0142, 0216, 0163, 0066, 0017, 0101, 0223, 
-  0267, 0261, 0024, 0371, 0307, 0265, 0177, 0236, 0316, 0274, 0171, 0250, 0334, 0324, 0265, 0270, 
-  0072, 0076, 0246, 0026, 0347, 0212, 0311, 0033, 0054, 0261, 0133, 0252, 0337, 0045, 0216, 0033, 
-  0060, 0315, 0015, 0074, 0067, 0324, 0220, 0165, 0313, 0035, 0353, 0351, 0175, 0054, 0353, 0203, 
-  0257, 0173, 0327, 0215, 0007, 0216, 0141, 0271, 0157, 0343, 0147, 0127, 0027, 0373, 0224, 0311, 
-  0125, 0343, 0032, 0337, 0021, 0313, 0312, 0207, 0243, 0271, 0244, 0175, 0227, 0065, 0323, 0304, 
-  0351, 0054, 0250, 0301, 0161, 0334, 0111, 0216, 0037, 0175, 0011, 0015, 0202, 0365, 0062, 0236, 
-  0134, 0153, 0235, 0154, 0271, 0134, 0314, 0071, 0212, 0060, 0043, 0271, 0106, 0213, 0002, 0317, 
-  0122, 0355, 0377, 0177, 0002, 0237, 0221, 0273, 0211, 0064, 0313, 0320, 0031, 0363, 0310, 0050, 
-  0140, 0330, 0217, 0177, 0141, 0361, 0225, 0031, 0271, 0120, 0207, 0161, 0233, 0301, 0347, 0166, 
-  0020, 0347, 0117, 0001, 0377, 0245, 0377, 0074, 0271, 0307, 0216, 0066, 0340, 0163, 0102, 0255, 
-  0346, 0334, 0336, 0171, 0275, 0321, 0351, 0037, 0333, 0041, 0064, 0064, 0067, 0213, 0206, 0145, 
-  0351, 0334, 0375, 0043, 0040, 0154, 0302, 0145, 0364, 0056, 0011, 0350, 0341, 0030, 0057, 0312, 
-  0140, 0034, 0316, 0161, 0021, 0070, 0157, 0220, 0103, 0031, 0042, 0216, 0141, 0005, 0302, 0261, 
-  0203, 0164, 0344, 0117, 0354, 0021, 0265, 0120, 0144, 0306, 0107, 0244, 0053, 0344, 0366, 0230, 
-  0061, 0327, 0377, 0307, 0333, 0267, 0363, 0336, 0336, 0352, 0056, 0171, 0373, 0330, 0172, 0373, 
-  0107, 0300, 0125, 0376, 0177, 0106, 0315, 0076, 0202, 0354, 0256, 0215, 0354, 0226, 0334, 0061, 
-  0220, 0337, 0012, 0034, 0253, 0265, 0131, 0216, 0065, 0300, 0256, 0036, 0272, 0330, 0352, 0047, 
-  0303, 0167, 0150, 0223, 0333, 0240, 0244, 0225, 0247, 0244, 0161, 0041, 0002, 0312, 0331, 0066, 
-  0242, 0340, 0250, 0154, 0024, 0304, 0257, 0115, 0354, 0313, 0113, 0036, 0027, 0116, 0130, 0215, 
-  0154, 0227, 0134, 0022, 0152, 0252, 0160, 0312, 0251, 0066, 0115, 0006, 0112, 0244, 0164, 0242, 
-  0316, 0165, 0057, 0265, 0277, 0014, 0242, 0053, 0203, 0272, 0323, 0050, 0073, 0211, 0252, 0223, 
-  0051, 0172, 0105, 0121, 0325, 0107, 0132, 0104, 0224, 0031, 0364, 0234, 0100, 0126, 0051, 0124, 
-  0002, 0336, 0132, 0360, 0326, 0126, 0341, 0255, 0275, 0372, 0061, 0350, 0016, 0102, 0025, 0331, 
-  0337, 0101, 0243, 0120, 0314, 0016, 0161, 0001, 0203, 0050, 0033, 0143, 0017, 0131, 0304, 0027, 
-  0321, 0373, 0310, 0044, 0360, 0205, 0141, 0070, 0065, 0371, 0270, 0375, 0360, 0364, 0364, 0164, 
-  0350, 0350, 0276, 0251, 0377, 0301, 0373, 0342, 0026, 0307, 0241, 0101, 0355, 0267, 0346, 0204, 
-  0177, 0214, 0030, 0157, 0371, 0012, 0235, 0023, 0357, 0155, 0330, 0113, 0324, 0311, 0041, 0343, 
-  0237, 0005, 0053, 0260, 0116, 0126, 0140, 0276, 0115, 0004, 0303, 0020, 0034, 0273, 0153, 0264, 
-  0031, 0256, 0102, 0352, 0134, 0144, 0101, 0140, 0067, 0200, 0123, 0267, 0240, 0123, 0067, 0042, 
-  0252, 0035, 0026, 0343, 0213, 0240, 0121, 0027, 0333, 0321, 0163, 0220, 0333, 0333, 0055, 0267, 
-  0137, 0357, 0042, 0010, 0156, 0360, 0350, 0202, 0107, 0027, 0074, 0272, 0245, 0152, 0147, 0131, 
-  0366, 0042, 0050, 0153, 0340, 0344, 0055, 0305, 0125, 0050, 0305, 0232, 0325, 0335, 0204, 0173, 
-  0340, 0114, 0216, 0324, 0134, 0304, 0325, 0134, 0177, 0267, 0275, 0311, 0222, 0322, 0173, 0015, 
-  0116, 0350, 0270, 0271, 0304, 0317, 0043, 0027, 0364, 0325, 0041, 0257, 0154, 0227, 0305, 0314, 
-  0165, 0145, 0236, 0062, 0211, 0340, 0247, 0001, 0127, 0244, 0235, 0027, 0303, 0253, 0377, 0371, 
-  0164, 0170, 0125, 0243, 0034, 0360, 0314, 0003, 0034, 0111, 0015, 0307, 0272, 0237, 0257, 0241, 
-  0207, 0015, 0114, 0036, 0161, 0316, 0326, 0231, 0326, 0337, 0031, 0265, 0155, 0302, 0320, 0331, 
-  0130, 0167, 0356, 0261, 0057, 0077, 0033, 0031, 0173, 0055, 0237, 0225, 0047, 0033, 0216, 0131, 
-  0047, 0163, 0125, 0016, 0310, 0044, 0163, 0327, 0376, 0347, 0065, 0062, 0325, 0126, 0071, 0114, 
-  0065, 0136, 0036, 0256, 0034, 0325, 0242, 0363, 0243, 0132, 0206, 0105, 0214, 0007, 0154, 0112, 
-  0236, 0324, 0332, 0062, 0026, 0330, 0312, 0313, 0002, 0023, 0117, 0244, 0275, 0326, 0056, 0010, 
-  0263, 0360, 0110, 0237, 0033, 0163, 0253, 0324, 0177, 0211, 0205, 0031, 0177, 0252, 0173, 0233, 
-  0076, 0326, 0024, 0236, 0212, 0061, 0304, 0061, 0100, 0155, 0024, 0361, 0356, 0344, 0317, 0255, 
-  0314, 0261, 0221, 0056, 0014, 0342, 0040, 0136, 0066, 0367, 0127, 0242, 0232, 0144, 0130, 0247, 
-  0204, 0336, 0123, 0060, 0135, 0130, 0111, 0112, 0302, 0362, 0052, 0232, 0162, 0111, 0143, 0161, 
-  0004, 0165, 0052, 0221, 0353, 0043, 0203, 0303, 0046, 0032, 0165, 0264, 0220, 0311, 0050, 0356, 
-  0140, 0061, 0161, 0352, 0141, 0213, 0340, 0273, 0306, 0211, 0103, 0035, 0005, 0276, 0341, 0006, 
-  0156, 0110, 0040, 0142, 0065, 0145, 0133, 0211, 0363, 0262, 0274, 0045, 0175, 0314, 0173, 0330, 
-  0154, 0301, 0073, 0370, 0066, 0027, 0067, 0277, 0053, 0227, 0233, 0313, 0262, 0302, 0364, 0303, 
-  0271, 0013, 0047, 0267, 0107, 0064, 0140, 0065, 0075, 0273, 0075, 0033, 0032, 0234, 0336, 0336, 
-  0354, 0351, 0155, 0261, 0017, 0245, 0236, 0337, 0126, 0075, 0216, 0275, 0327, 0007, 0236, 0263, 
-  0215, 0004, 0165, 0003, 0241, 0374, 0323, 0316, 0307, 0171, 0217, 0054, 0367, 0154, 0276, 0105, 
-  0165, 0122, 0116, 0052, 0065, 0312, 0136, 0013, 0065, 0362, 0074, 0012, 0356, 0226, 0110, 0133, 
-  0153, 0265, 0177, 0215, 0043, 0157, 0360, 0160, 0154, 0255, 0122, 0173, 0101, 0034, 0335, 0061, 
-  0210, 0156, 0111, 0073, 0006, 0044, 0335, 0361, 0053, 0150, 0344, 0122, 0303, 0140, 0172, 0366, 
-  0224, 0113, 0123, 0245, 0117, 0271, 0146, 0204, 0132, 0355, 0125, 0373, 0170, 0245, 0237, 0247, 
-  0250, 0060, 0306, 0254, 0223, 0061, 0326, 0037, 0047, 0371, 0325, 0360, 0335, 0063, 0152, 0345, 
-  0250, 0176, 0300, 0170, 0067, 0013, 0142, 0071, 0372, 0273, 0106, 0050, 0010, 0311, 0077, 0134, 
-  0013, 0315, 0014, 0274, 0251, 0104, 0071, 0156, 0066, 0163, 0264, 0027, 0006, 0156, 0343, 0304, 
-  0267, 0210, 0311, 0265, 0046, 0127, 0343, 0352, 0207, 0043, 0333, 0113, 0130, 0340, 0310, 0245, 
-  0034, 0206, 0130, 0343, 0252, 0106, 0326, 0334, 0267, 0077, 0163, 0271, 0274, 0164, 0336, 0017, 
-  0331, 0331, 0274, 0052, 0141, 0326, 0071, 0251, 0176, 0213, 0112, 0112, 0155, 0115, 0364, 0165, 
-  0363, 0041, 0321, 0026, 0204, 0104, 0067, 0235, 0277, 0266, 0003, 0271, 0002, 0035, 0156, 0072, 
-  0332, 0256, 0025, 0236, 0074, 0216, 0324, 0020, 0104, 0034, 0237, 0171, 0201, 0315, 0351, 0372, 
-  0020, 0120, 0001, 0151, 0122, 0205, 0131, 0373, 0167, 0074, 0342, 0043, 0303, 0073, 0000, 0226, 
-  0351, 0114, 0000, 0025, 0220, 0127, 0266, 0217, 0262, 0342, 0214, 0272, 0023, 0117, 0330, 0151, 
-  0350, 0377, 0375, 0137, 0324, 0156, 0266, 0333, 0232, 0306, 0377, 0373, 0216, 0233, 0171, 0076, 
-  0243, 0316, 0351, 0340, 0274, 0152, 0140, 0344, 0064, 0150, 0313, 0005, 0126, 0210, 0250, 0137, 
-  0223, 0000, 0025, 0323, 0205, 0317, 0046, 0174, 0204, 0263, 0346, 0016, 0365, 0154, 0335, 0122, 
-  0150, 0376, 0312, 0064, 0366, 0261, 0115, 0254, 0360, 0027, 0371, 0056, 0036, 0165, 0217, 0350, 
-  0016, 0223, 0034, 0003, 0244, 0324, 0155, 0112, 0122, 0016, 0075, 0354, 0230, 0176, 0317, 0330, 
-  0042, 0073, 0050, 0231, 0133, 0104, 0223, 0101, 0302, 0153, 0211, 0070, 0200, 0310, 0275, 0203, 
-  0115, 0064, 0232, 0240, 0013, 0017, 0143, 0227, 0074, 0240, 0073, 0217, 0332, 0350, 0202, 0267, 
-  0021, 0157, 0000, 0347, 0000, 0316, 0001, 0147, 0010, 0367, 0112, 0233, 0030, 0216, 0211, 0217, 
-  0370, 0333, 0367, 0236, 0156, 0043, 0203, 0332, 0330, 0217, 0012, 0222, 0353, 0043, 0237, 0132, 
-  0234, 0202, 0054, 0336, 0005, 0105, 0117, 0272, 0307, 0233, 0262, 0311, 0041, 0160, 0010, 0340, 
-  0020, 0133, 0305, 0041, 0216, 0353, 0227, 0256, 0057, 0376, 0333, 0070, 0021, 0121, 0157, 0245, 
-  0022, 0024, 0121, 0026, 0131, 0254, 0367, 0110, 0150, 0055, 0353, 0055, 0020, 0062, 0060, 0074, 
-  0152, 0131, 0330, 0134, 0311, 0101, 0170, 0365, 0240, 0236, 0007, 0002, 0036, 0147, 0144, 0251, 
-  0332, 0160, 0354, 0207, 0323, 0033, 0351, 0236, 0346, 0122, 0213, 0030, 0234, 0261, 0071, 0370, 
-  0061, 0235, 0257, 0255, 0146, 0021, 0352, 0174, 0145, 0246, 0221, 0023, 0342, 0050, 0025, 0023, 
-  0041, 0216, 0306, 0325, 0064, 0306, 0171, 0351, 0254, 0354, 0175, 0273, 0331, 0314, 0333, 0303, 
-  0254, 0014, 0176, 0353, 0327, 0146, 0131, 0361, 0204, 0157, 0004, 0077, 0271, 0124, 0034, 0115, 
-  0255, 0277, 0114, 0224, 0046, 0202, 0314, 0115, 0304, 0314, 0030, 0143, 0123, 0043, 0331, 0372, 
-  0163, 0342, 0122, 0312, 0131, 0046, 0137, 0010, 0027, 0243, 0176, 0252, 0017, 0257, 0360, 0062, 
-  0227, 0261, 0324, 0171, 0035, 0032, 0177, 0063, 0176, 0211, 0074, 0032, 0313, 0016, 0215, 0103, 
-  0324, 0261, 0054, 0024, 0276, 0342, 0043, 0017, 0373, 0330, 0173, 0304, 0346, 0341, 0301, 0301, 
-  0015, 0066, 0211, 0037, 0311, 0061, 0316, 0353, 0303, 0263, 0166, 0201, 0217, 0021, 0161, 0220, 
-  0117, 0003, 0317, 0300, 0341, 0057, 0043, 0342, 0350, 0336, 0004, 0335, 0161, 0201, 0350, 0277, 
-  0211, 0164, 0033, 0352, 0205, 0377, 0237, 0057, 0350, 0101, 0224, 0237, 0145, 0204, 0101, 0271, 
-  0067, 0110, 0367, 0060, 0342, 0143, 0266, 0011, 0023, 0107, 0365, 0370, 0004, 0036, 0211, 0311, 
-  0377, 0301, 0306, 0072, 0343, 0377, 0301, 0274, 0023, 0313, 0242, 0117, 0242, 0350, 0047, 0307, 
-  0220, 0031, 0112, 0030, 0137, 0064, 0072, 0260, 0061, 0373, 0307, 0101, 0270, 0024, 0177, 0153, 
-  0375, 0202, 0226, 0307, 0345, 0043, 0172, 0067, 0033, 0220, 0101, 0115, 0214, 0154, 0256, 0023, 
-  0361, 0151, 0060, 0235, 0017, 0124, 0364, 0252, 0217, 0350, 0243, 0170, 0064, 0135, 0205, 0260, 
-  0033, 0207, 0162, 0203, 0014, 0277, 0341, 0317, 0211, 0037, 0036, 0035, 0024, 0235, 0054, 0176, 
-  0324, 0061, 0137, 0215, 0210, 0177, 0222, 0023, 0016, 0261, 0261, 0167, 0070, 0035, 0111, 0173, 
-  0165, 0044, 0374, 0213, 0013, 0353, 0061, 0033, 0011, 0237, 0250, 0031, 0360, 0321, 0125, 0061, 
-  0030, 0376, 0311, 0260, 0017, 0361, 0334, 0344, 0044, 0144, 0317, 0102, 0240, 0242, 0325, 0133, 
-  0276, 0023, 0321, 0351, 0110, 0133, 0347, 0332, 0241, 0310, 0276, 0230, 0257, 0172, 0270, 0125, 
-  0374, 0141, 0330, 0174, 0161, 0032, 0263, 0371, 0035, 0375, 0042, 0316, 0363, 0013, 0352, 0022, 
-  0343, 0011, 0007, 0037, 0360, 0135, 0025, 0235, 0115, 0302, 0032, 0255, 0043, 0054, 0350, 0201, 
-  0217, 0215, 0206, 0015, 0270, 0041, 0114, 0075, 0116, 0037, 0374, 0015, 0376, 0021, 0233, 0162, 
-  0345, 0051, 0232, 0071, 0247, 0052, 0223, 0177, 0235, 0023, 0125, 0144, 0016, 0207, 0363, 0364, 
-  0351, 0035, 0173, 0022, 0004, 0061, 0043, 0025, 0321, 0205, 0357, 0142, 0103, 0320, 0013, 0157, 
-  0110, 0004, 0025, 0171, 0202, 0122, 0234, 0210, 0146, 0174, 0077, 0032, 0333, 0360, 0262, 0067, 
-  0100, 0203, 0376, 0305, 0360, 0173, 0347, 0246, 0213, 0370, 0277, 0257, 0157, 0372, 0337, 0172, 
-  0347, 0335, 0163, 0164, 0372, 0003, 0015, 0057, 0273, 0250, 0163, 0073, 0274, 0354, 0337, 0240, 
-  0377, 0376, 0357, 0316, 0200, 0077, 0376, 0217, 0377, 0100, 0235, 0253, 0163, 0376, 0177, 0077, 
-  0120, 0367, 0337, 0327, 0067, 0335, 0301, 0000, 0365, 0157, 0016, 0172, 0137, 0257, 0277, 0364, 
-  0170, 0023, 0336, 0307, 0115, 0347, 0152, 0330, 0353, 0016, 0336, 0240, 0336, 0325, 0331, 0227, 
-  0333, 0363, 0336, 0325, 0247, 0067, 0350, 0364, 0166, 0210, 0256, 0372, 0103, 0364, 0245, 0367, 
-  0265, 0067, 0344, 0257, 0015, 0373, 0157, 0302, 0256, 0247, 0315, 0016, 0346, 0315, 0120, 0377, 
-  0002, 0175, 0355, 0336, 0234, 0135, 0362, 0077, 0073, 0247, 0275, 0057, 0275, 0341, 0217, 0360, 
-  0173, 0027, 0275, 0341, 0225, 0370, 0326, 0005, 0037, 0111, 0007, 0135, 0167, 0156, 0206, 0275, 
-  0263, 0333, 0057, 0235, 0033, 0164, 0175, 0173, 0163, 0335, 0037, 0360, 0121, 0336, 0164, 0017, 
-  0316, 0173, 0203, 0263, 0057, 0235, 0336, 0327, 0056, 0207, 0140, 0357, 0212, 0177, 0021, 0165, 
-  0277, 0165, 0257, 0206, 0150, 0160, 0331, 0371, 0362, 0145, 0161, 0056, 0247, 0135, 0076, 0224, 
-  0316, 0351, 0227, 0156, 0324, 0037, 0237, 0313, 0171, 0357, 0246, 0173, 0066, 0174, 0163, 0320, 
-  0273, 0232, 0376, 0113, 0014, 0237, 0257, 0002, 0037, 0305, 0227, 0067, 0150, 0160, 0335, 0075, 
-  0353, 0211, 0177, 0164, 0377, 0335, 0345, 0103, 0356, 0334, 0374, 0170, 0303, 0147, 0215, 0316, 
-  0372, 0127, 0203, 0356, 0277, 0156, 0371, 0113, 0374, 0041, 0072, 0357, 0174, 0355, 0174, 0352, 
-  0016, 0016, 0376, 0226, 0061, 0161, 0276, 0276, 0147, 0267, 0067, 0335, 0257, 0142, 0144, 0174, 
-  0266, 0203, 0333, 0323, 0301, 0260, 0067, 0274, 0035, 0166, 0321, 0247, 0176, 0377, 0074, 0134, 
-  0316, 0101, 0367, 0346, 0133, 0357, 0254, 0073, 0370, 0015, 0175, 0351, 0017, 0302, 0065, 0271, 
-  0035, 0164, 0337, 0360, 0057, 0014, 0073, 0341, 0207, 0171, 0027, 0174, 0101, 0370, 0143, 0061, 
-  0227, 0333, 0101, 0057, 0134, 0232, 0336, 0325, 0260, 0173, 0163, 0163, 0173, 0075, 0354, 0365, 
-  0257, 0176, 0071, 0270, 0354, 0177, 0347, 0223, 0347, 0143, 0354, 0360, 0246, 0347, 0341, 0032, 
-  0366, 0257, 0302, 0251, 0362, 0165, 0350, 0337, 0374, 0020, 0235, 0212, 0065, 0010, 0227, 0370, 
-  0015, 0372, 0176, 0331, 0345, 0277, 0337, 0210, 0145, 0013, 0223, 0076, 0073, 0142, 0061, 0006, 
-  0303, 0233, 0336, 0331, 0160, 0361, 0065, 0376, 0275, 0141, 0377, 0146, 0210, 0346, 0163, 0104, 
-  0127, 0335, 0117, 0137, 0172, 0237, 0272, 0127, 0147, 0135, 0361, 0264, 0057, 0172, 0371, 0336, 
-  0033, 0164, 0177, 0341, 0073, 0322, 0343, 0043, 0373, 0304, 0227, 0064, 0374, 0354, 0367, 0016, 
-  0377, 0346, 0155, 0070, 0145, 0261, 0023, 0174, 0124, 0321, 0077, 0027, 0250, 0357, 0115, 0270, 
-  0137, 0250, 0167, 0201, 0072, 0347, 0337, 0172, 0142, 0330, 0321, 0313, 0007, 0174, 0207, 0007, 
-  0275, 0051, 0065, 0204, 0113, 0166, 0166, 0071, 0135, 0356, 0303, 0074, 0274, 0135, 0325, 0114, 
-  0223, 0064, 0325, 0162, 0304, 0130, 0076, 0044, 0333, 0114, 0045, 0130, 0156, 0045, 0131, 0157, 
-  0045, 0130, 0160, 0062, 0126, 0134, 0226, 0045, 0227, 0342, 0004, 0111, 0153, 0270, 0006, 0273, 
-  0250, 0125, 0216, 0135, 0064, 0125, 0227, 0124, 0072, 0053, 0371, 0050, 0365, 0026, 0045, 0305, 
-  0265, 0341, 0244, 0327, 0172, 0116, 0172, 0205, 0351, 0200, 0003, 0256, 0125, 0160, 0243, 0301, 
-  0253, 0125, 0122, 0065, 0327, 0211, 0070, 0043, 0305, 0124, 0371, 0266, 0250, 0050, 0301, 0161, 
-  0236, 0354, 0050, 0233, 0027, 0015, 0007, 0265, 0066, 0174, 0120, 0153, 0166, 0172, 0007, 0216, 
-  0152, 0225, 0164, 0124, 0353, 0064, 0260, 0054, 0316, 0116, 0353, 0171, 0130, 0153, 0141, 0160, 
-  0160, 0134, 0153, 0243, 0307, 0265, 0246, 0073, 0261, 0155, 0027, 0156, 0302, 0135, 0230, 0271, 
-  0357, 0302, 0114, 0253, 0330, 0247, 0134, 0245, 0117, 0271, 0072, 0165, 0236, 0122, 0176, 0245, 
-  0235, 0077, 0223, 0322, 0053, 0112, 0275, 0163, 0123, 0134, 0260, 0054, 0374, 0334, 0126, 0140, 
-  0073, 0376, 0307, 0026, 0377, 0267, 0107, 0237, 0374, 0217, 0307, 0341, 0315, 0312, 0151, 0272, 
-  0305, 0047, 0217, 0230, 0165, 0122, 0311, 0144, 0213, 0235, 0347, 0053, 0164, 0276, 0262, 0121, 
-  0062, 0036, 0361, 0134, 0156, 0364, 0225, 0365, 0010, 0267, 0106, 0223, 0327, 0070, 0045, 0303, 
-  0122, 0027, 0236, 0260, 0041, 0027, 0131, 0354, 0047, 0256, 0153, 0104, 0277, 0326, 0271, 0174, 
-  0212, 0366, 0122, 0033, 0063, 0167, 0044, 0051, 0115, 0375, 0313, 0010, 0343, 0054, 0303, 0345, 
-  0150, 0006, 0227, 0366, 0053, 0270, 0050, 0301, 0246, 0226, 0041, 0237, 0051, 0331, 0245, 0037, 
-  0210, 0055, 0223, 0156, 0213, 0005, 0176, 0166, 0046, 0302, 0323, 0017, 0034, 0003, 0373, 0171, 
-  0372, 0124, 0314, 0037, 0251, 0316, 0261, 0230, 0134, 0373, 0260, 0034, 0127, 0134, 0126, 0142, 
-  0105, 0354, 0202, 0343, 0073, 0246, 0361, 0017, 0353, 0306, 0070, 0363, 0020, 0116, 0202, 0357, 
-  0214, 0272, 0052, 0035, 0244, 0144, 0113, 0144, 0270, 0023, 0325, 0041, 0260, 0120, 0225, 0172, 
-  0201, 0225, 0107, 0224, 0224, 0121, 0223, 0272, 0152, 0204, 0344, 0355, 0042, 0263, 0102, 0331, 
-  0125, 0140, 0217, 0260, 0047, 0242, 0131, 0064, 0067, 0142, 0306, 0112, 0365, 0245, 0143, 0227, 
-  0252, 0160, 0017, 0266, 0376, 0254, 0131, 0330, 0271, 0027, 0011, 0012, 0255, 0134, 0204, 0251, 
-  0120, 0053, 0072, 0326, 0277, 0041, 0123, 0057, 0232, 0376, 0231, 0053, 0330, 0241, 0136, 0373, 
-  0171, 0033, 0320, 0337, 0252, 0027, 0372, 0167, 0114, 0000, 0136, 0173, 0330, 0046, 0201, 0015, 
-  0022, 0260, 0112, 0014, 0264, 0366, 0102, 0002, 0116, 0111, 0151, 0127, 0105, 0340, 0164, 0172, 
-  0042, 0245, 0042, 0022, 0202, 0040, 0003, 0253, 0224, 0201, 0245, 0054, 0167, 0055, 0045, 0142, 
-  0013, 0044, 0142, 0275, 0223, 0376, 0174, 0006, 0342, 0260, 0112, 0000, 0264, 0367, 0102, 0034, 
-  0012, 0072, 0332, 0125, 0131, 0050, 0346, 0006, 0202, 0160, 0075, 0202, 0260, 0370, 0132, 0327, 
-  0122, 0012, 0266, 0153, 0055, 0005, 0225, 0223, 0314, 0136, 0245, 0333, 0130, 0211, 0062, 0161, 
-  0047, 0317, 0352, 0011, 0176, 0267, 0033, 0267, 0276, 0124, 0226, 0103, 0050, 0357, 0024, 0311, 
-  0051, 0371, 0252, 0070, 0114, 0265, 0032, 0265, 0032, 0020, 0353, 0021, 0173, 0262, 0161, 0053, 
+  0154, 0163, 0056, 0147, 0154, 0141, 0144, 0145, 0353, 0176, 0003, 0000, 0001, 0000, 0000, 0000, 
+  0170, 0332, 0355, 0175, 0353, 0162, 0343, 0070, 0226, 0346, 0177, 0077, 0005, 0132, 0261, 0321, 
+  0323, 0025, 0223, 0264, 0045, 0071, 0235, 0131, 0335, 0125, 0351, 0016, 0331, 0226, 0323, 0332, 
+  0314, 0264, 0334, 0226, 0234, 0331, 0071, 0177, 0074, 0024, 0011, 0113, 0030, 0123, 0004, 0213, 
+  0004, 0155, 0253, 0142, 0137, 0150, 0137, 0143, 0237, 0154, 0001, 0122, 0262, 0044, 0213, 0027, 
+  0200, 0027, 0211, 0222, 0116, 0107, 0114, 0115, 0132, 0044, 0100, 0134, 0316, 0167, 0356, 0070, 
+  0370, 0375, 0237, 0057, 0143, 0013, 0075, 0141, 0327, 0043, 0324, 0376, 0124, 0153, 0034, 0326, 
+  0153, 0010, 0333, 0006, 0065, 0211, 0075, 0374, 0124, 0273, 0353, 0137, 0152, 0277, 0326, 0376, 
+  0171, 0172, 0360, 0373, 0137, 0064, 0015, 0175, 0306, 0066, 0166, 0165, 0206, 0115, 0364, 0114, 
+  0330, 0010, 0015, 0055, 0335, 0304, 0350, 0370, 0360, 0175, 0375, 0260, 0216, 0064, 0215, 0277, 
+  0104, 0154, 0206, 0335, 0007, 0335, 0300, 0247, 0007, 0010, 0375, 0356, 0342, 0077, 0174, 0342, 
+  0142, 0017, 0131, 0144, 0360, 0251, 0066, 0144, 0217, 0377, 0131, 0233, 0177, 0350, 0370, 0260, 
+  0371, 0276, 0166, 0024, 0274, 0107, 0007, 0377, 0203, 0015, 0206, 0014, 0113, 0367, 0274, 0117, 
+  0265, 0317, 0354, 0361, 0033, 0266, 0375, 0032, 0042, 0346, 0247, 0132, 0353, 0246, 0023, 0374, 
+  0041, 0336, 0343, 0157, 0072, 0056, 0165, 0260, 0313, 0046, 0310, 0326, 0307, 0370, 0123, 0355, 
+  0211, 0170, 0144, 0140, 0341, 0332, 0151, 0337, 0365, 0361, 0357, 0107, 0263, 0247, 0321, 0057, 
+  0033, 0272, 0255, 0075, 0120, 0303, 0367, 0152, 0247, 0227, 0272, 0345, 0255, 0276, 0157, 0214, 
+  0210, 0145, 0206, 0377, 0216, 0033, 0124, 0207, 0341, 0361, 0322, 0300, 0316, 0055, 0352, 0341, 
+  0332, 0254, 0221, 0342, 0010, 0263, 0214, 0062, 0252, 0215, 0245, 0017, 0260, 0125, 0103, 0314, 
+  0325, 0155, 0317, 0322, 0231, 0316, 0077, 0370, 0251, 0066, 0301, 0274, 0213, 0373, 0140, 0174, 
+  0062, 0175, 0370, 0036, 0326, 0174, 0333, 0304, 0256, 0105, 0354, 0244, 0341, 0352, 0206, 0201, 
+  0055, 0101, 0004, 0324, 0105, 0217, 0170, 0302, 0007, 0134, 0103, 0036, 0031, 0332, 0272, 0365, 
+  0251, 0246, 0033, 0214, 0074, 0161, 0362, 0250, 0241, 0061, 0047, 0237, 0007, 0302, 0267, 0232, 
+  0257, 0334, 0305, 0227, 0373, 0363, 0356, 0165, 0377, 0266, 0373, 0365, 0376, 0133, 0253, 0367, 
+  0045, 0334, 0363, 0240, 0257, 0243, 0160, 0215, 0247, 0313, 0177, 0364, 0272, 0376, 0213, 0017, 
+  0126, 0367, 0341, 0007, 0261, 0115, 0372, 0074, 0335, 0005, 0207, 0114, 0377, 0314, 0270, 0347, 
+  0021, 0357, 0233, 0370, 0101, 0367, 0055, 0046, 0107, 0124, 0234, 0272, 0311, 0237, 0172, 0260, 
+  0303, 0122, 0037, 0230, 0166, 0256, 0075, 0023, 0223, 0215, 0152, 0247, 0047, 0047, 0165, 0331, 
+  0026, 0043, 0114, 0206, 0043, 0076, 0252, 0246, 0114, 0023, 0217, 0271, 0164, 0242, 0011, 0220, 
+  0152, 0216, 0356, 0142, 0133, 0162, 0066, 0304, 0240, 0166, 0355, 0264, 0307, 0250, 0361, 0350, 
+  0151, 0342, 0217, 0103, 0307, 0036, 0246, 0065, 0362, 0036, 0211, 0303, 0277, 0062, 0304, 0256, 
+  0066, 0042, 0261, 0137, 0112, 0001, 0327, 0031, 0175, 0331, 0064, 0212, 0306, 0272, 0073, 0044, 
+  0266, 0306, 0250, 0303, 0027, 0271, 0256, 0320, 0142, 0100, 0031, 0243, 0343, 0332, 0151, 0103, 
+  0252, 0021, 0165, 0011, 0337, 0017, 0235, 0021, 0261, 0324, 0234, 0033, 0062, 0142, 0350, 0226, 
+  0114, 0103, 0317, 0321, 0015, 0316, 0223, 0145, 0007, 0067, 0320, 0075, 0054, 0260, 0254, 0071, 
+  0324, 0043, 0341, 0327, 0370, 0324, 0042, 0133, 0056, 0355, 0115, 0364, 0376, 0134, 0123, 0206, 
+  0007, 0224, 0076, 0276, 0062, 0277, 0327, 0037, 0026, 0333, 0145, 0330, 0271, 0224, 0335, 0123, 
+  0151, 0346, 0215, 0350, 0063, 0337, 0014, 0227, 0063, 0261, 0204, 0155, 0217, 0236, 0261, 0014, 
+  0125, 0346, 0232, 0143, 0126, 0052, 0115, 0241, 0075, 0217, 0351, 0056, 0213, 0043, 0275, 0224, 
+  0266, 0330, 0066, 0063, 0266, 0014, 0060, 0162, 0222, 0241, 0341, 0014, 0052, 0112, 0155, 0245, 
+  0021, 0223, 0212, 0234, 0224, 0311, 0006, 0124, 0201, 0330, 0304, 0021, 0173, 0203, 0205, 0052, 
+  0023, 0261, 0373, 0121, 0164, 0322, 0266, 0231, 0073, 0171, 0225, 0110, 0167, 0256, 0365, 0005, 
+  0117, 0202, 0337, 0242, 0011, 0050, 0027, 0021, 0345, 0000, 0114, 0134, 0163, 0106, 0251, 0305, 
+  0070, 0023, 0147, 0370, 0205, 0105, 0252, 0021, 0055, 0307, 0341, 0304, 0202, 0152, 0177, 0325, 
+  0307, 0316, 0157, 0214, 0076, 0142, 0256, 0277, 0241, 0001, 0176, 0240, 0056, 0106, 0023, 0352, 
+  0273, 0350, 0201, 0330, 0366, 0310, 0037, 0034, 0022, 0052, 0224, 0202, 0303, 0203, 0203, 0305, 
+  0127, 0377, 0152, 0261, 0337, 0176, 0166, 0357, 0156, 0121, 0353, 0374, 0274, 0173, 0167, 0335, 
+  0107, 0137, 0332, 0077, 0377, 0072, 0144, 0277, 0325, 0124, 0307, 0371, 0244, 0133, 0134, 0323, 
+  0250, 0235, 0206, 0173, 0243, 0332, 0172, 0031, 0061, 0047, 0031, 0233, 0007, 0240, 0311, 0332, 
+  0130, 0212, 0374, 0243, 0332, 0277, 0114, 0147, 0136, 0077, 0124, 0156, 0352, 0130, 0134, 0035, 
+  0037, 0121, 0213, 0163, 0305, 0370, 0015, 0226, 0330, 0055, 0325, 0357, 0022, 0333, 0361, 0231, 
+  0346, 0370, 0256, 0023, 0150, 0310, 0272, 0345, 0214, 0364, 0344, 0076, 0226, 0365, 0301, 0267, 
+  0275, 0353, 0306, 0043, 0307, 0260, 0334, 0267, 0361, 0213, 0243, 0213, 0175, 0112, 0345, 0252, 
+  0121, 0215, 0037, 0210, 0145, 0145, 0303, 0321, 0134, 0322, 0276, 0117, 0233, 0151, 0354, 0164, 
+  0026, 0324, 0340, 0050, 0356, 0044, 0307, 0217, 0276, 0006, 0006, 0301, 0172, 0031, 0117, 0246, 
+  0265, 0216, 0267, 0134, 0056, 0347, 0034, 0105, 0230, 0221, 0134, 0243, 0105, 0276, 0153, 0251, 
+  0366, 0377, 0077, 0276, 0307, 0310, 0303, 0104, 0232, 0145, 0350, 0214, 0271, 0144, 0340, 0063, 
+  0354, 0105, 0277, 0260, 0370, 0312, 0214, 0134, 0250, 0315, 0270, 0315, 0340, 0161, 0073, 0210, 
+  0363, 0047, 0237, 0377, 0322, 0175, 0231, 0014, 0261, 0255, 0365, 0370, 0234, 0120, 0243, 0076, 
+  0267, 0167, 0336, 0156, 0164, 0362, 0307, 0166, 0010, 0015, 0365, 0315, 0242, 0141, 0131, 0072, 
+  0267, 0377, 0360, 0011, 0233, 0160, 0031, 0275, 0113, 0002, 0272, 0077, 0302, 0213, 0062, 0030, 
+  0007, 0163, 0134, 0004, 0316, 0073, 0144, 0123, 0206, 0210, 0155, 0130, 0276, 0160, 0354, 0040, 
+  0035, 0171, 0223, 0361, 0200, 0132, 0050, 0064, 0343, 0103, 0322, 0025, 0162, 0173, 0304, 0230, 
+  0343, 0375, 0343, 0350, 0150, 0336, 0333, 0221, 0356, 0220, 0243, 0247, 0306, 0321, 0037, 0076, 
+  0127, 0371, 0377, 0031, 0066, 0373, 0004, 0262, 0273, 0062, 0262, 0133, 0162, 0307, 0100, 0176, 
+  0053, 0160, 0254, 0306, 0146, 0071, 0126, 0017, 0073, 0172, 0340, 0142, 0253, 0236, 0014, 0337, 
+  0241, 0115, 0156, 0202, 0222, 0126, 0234, 0222, 0306, 0205, 0010, 0050, 0147, 0333, 0210, 0202, 
+  0343, 0242, 0121, 0020, 0275, 0066, 0221, 0057, 0057, 0171, 0134, 0070, 0141, 0325, 0322, 0135, 
+  0162, 0161, 0250, 0051, 0303, 0051, 0247, 0332, 0064, 0036, 0050, 0241, 0322, 0211, 0132, 0067, 
+  0235, 0304, 0376, 0122, 0210, 0256, 0010, 0352, 0116, 0242, 0354, 0070, 0252, 0216, 0247, 0350, 
+  0025, 0105, 0125, 0037, 0150, 0041, 0121, 0246, 0320, 0163, 0014, 0131, 0045, 0120, 0011, 0170, 
+  0153, 0301, 0133, 0133, 0206, 0267, 0366, 0372, 0147, 0257, 0335, 0013, 0124, 0144, 0157, 0007, 
+  0215, 0102, 0061, 0073, 0304, 0005, 0014, 0242, 0154, 0204, 0135, 0144, 0021, 0117, 0104, 0357, 
+  0103, 0223, 0300, 0023, 0206, 0341, 0324, 0344, 0343, 0366, 0303, 0363, 0363, 0363, 0241, 0255, 
+  0173, 0246, 0376, 0007, 0357, 0213, 0133, 0034, 0207, 0006, 0035, 0037, 0231, 0023, 0376, 0061, 
+  0142, 0034, 0361, 0025, 0272, 0040, 0356, 0121, 0320, 0113, 0330, 0311, 0041, 0343, 0237, 0005, 
+  0053, 0260, 0112, 0126, 0140, 0266, 0115, 0004, 0303, 0020, 0034, 0273, 0153, 0264, 0031, 0256, 
+  0003, 0352, 0134, 0144, 0101, 0140, 0067, 0200, 0123, 0067, 0247, 0123, 0067, 0044, 0252, 0035, 
+  0026, 0343, 0213, 0240, 0121, 0027, 0333, 0341, 0163, 0220, 0333, 0333, 0055, 0267, 0337, 0356, 
+  0042, 0010, 0156, 0360, 0350, 0202, 0107, 0027, 0074, 0272, 0205, 0152, 0147, 0151, 0366, 0042, 
+  0050, 0153, 0340, 0344, 0055, 0304, 0125, 0050, 0305, 0232, 0325, 0335, 0204, 0173, 0340, 0114, 
+  0016, 0325, 0134, 0304, 0325, 0134, 0157, 0267, 0275, 0311, 0222, 0322, 0173, 0015, 0116, 0350, 
+  0250, 0271, 0104, 0317, 0043, 0023, 0364, 0325, 0041, 0257, 0154, 0227, 0105, 0314, 0165, 0145, 
+  0236, 0062, 0211, 0340, 0147, 0076, 0127, 0244, 0355, 0127, 0303, 0253, 0373, 0345, 0254, 0177, 
+  0135, 0241, 0034, 0360, 0324, 0003, 0034, 0161, 0015, 0107, 0272, 0227, 0255, 0241, 0213, 0015, 
+  0114, 0236, 0160, 0306, 0326, 0251, 0326, 0337, 0071, 0035, 0217, 0011, 0103, 0347, 0043, 0335, 
+  0036, 0142, 0117, 0176, 0066, 0062, 0366, 0132, 0066, 0053, 0117, 0066, 0034, 0263, 0116, 0346, 
+  0252, 0034, 0220, 0211, 0347, 0256, 0335, 0057, 0153, 0144, 0252, 0215, 0142, 0230, 0152, 0264, 
+  0074, 0134, 0071, 0252, 0105, 0347, 0107, 0265, 0014, 0213, 0030, 0217, 0330, 0224, 0074, 0251, 
+  0265, 0145, 0054, 0260, 0221, 0225, 0005, 0306, 0236, 0110, 0173, 0253, 0135, 0020, 0146, 0341, 
+  0201, 0076, 0067, 0346, 0126, 0251, 0377, 0012, 0013, 0063, 0376, 0114, 0167, 0067, 0175, 0254, 
+  0051, 0070, 0025, 0143, 0210, 0143, 0200, 0332, 0040, 0344, 0335, 0361, 0237, 0133, 0231, 0143, 
+  0055, 0131, 0030, 0104, 0101, 0274, 0150, 0356, 0257, 0104, 0065, 0361, 0260, 0116, 0010, 0275, 
+  0047, 0140, 0072, 0267, 0222, 0024, 0207, 0345, 0125, 0064, 0145, 0222, 0306, 0342, 0010, 0352, 
+  0124, 0042, 0127, 0107, 0006, 0007, 0115, 0064, 0152, 0153, 0001, 0223, 0121, 0334, 0301, 0174, 
+  0342, 0324, 0305, 0026, 0301, 0017, 0265, 0123, 0233, 0332, 0012, 0174, 0303, 0361, 0235, 0200, 
+  0100, 0304, 0152, 0312, 0266, 0022, 0347, 0145, 0171, 0113, 0372, 0224, 0365, 0260, 0331, 0202, 
+  0167, 0360, 0050, 0023, 0067, 0177, 0050, 0226, 0233, 0313, 0262, 0302, 0344, 0303, 0271, 0013, 
+  0047, 0267, 0007, 0324, 0147, 0025, 0075, 0273, 0075, 0033, 0032, 0234, 0336, 0336, 0354, 0351, 
+  0155, 0261, 0017, 0205, 0236, 0337, 0126, 0075, 0216, 0275, 0327, 0007, 0236, 0323, 0215, 0004, 
+  0165, 0003, 0241, 0370, 0323, 0316, 0047, 0131, 0217, 0054, 0167, 0306, 0174, 0213, 0252, 0244, 
+  0234, 0224, 0152, 0224, 0275, 0025, 0152, 0344, 0145, 0340, 0077, 0054, 0221, 0266, 0326, 0150, 
+  0376, 0032, 0105, 0336, 0340, 0341, 0330, 0132, 0245, 0366, 0222, 0330, 0272, 0155, 0020, 0335, 
+  0222, 0166, 0014, 0110, 0272, 0343, 0127, 0320, 0310, 0245, 0206, 0301, 0364, 0364, 0051, 0027, 
+  0246, 0112, 0237, 0161, 0315, 0010, 0065, 0232, 0253, 0366, 0361, 0112, 0077, 0317, 0141, 0141, 
+  0214, 0131, 0047, 0043, 0254, 0077, 0115, 0262, 0253, 0341, 0273, 0147, 0324, 0312, 0121, 0175, 
+  0217, 0361, 0156, 0026, 0304, 0162, 0370, 0167, 0205, 0120, 0020, 0220, 0177, 0260, 0026, 0232, 
+  0351, 0273, 0123, 0211, 0162, 0122, 0257, 0147, 0150, 0057, 0014, 0334, 0332, 0251, 0147, 0021, 
+  0223, 0153, 0115, 0216, 0306, 0325, 0017, 0133, 0266, 0227, 0240, 0300, 0221, 0103, 0071, 0014, 
+  0261, 0306, 0125, 0215, 0264, 0271, 0157, 0177, 0346, 0162, 0161, 0351, 0274, 0037, 0323, 0263, 
+  0171, 0125, 0302, 0254, 0163, 0122, 0375, 0036, 0226, 0224, 0332, 0232, 0350, 0353, 0346, 0103, 
+  0242, 0015, 0010, 0211, 0156, 0072, 0177, 0155, 0007, 0162, 0005, 0132, 0334, 0164, 0034, 0073, 
+  0126, 0160, 0362, 0070, 0124, 0103, 0020, 0261, 0075, 0346, 0372, 0143, 0116, 0327, 0207, 0200, 
+  0012, 0110, 0223, 0312, 0315, 0332, 0177, 0340, 0001, 0037, 0031, 0336, 0001, 0260, 0114, 0147, 
+  0002, 0250, 0200, 0274, 0262, 0175, 0224, 0025, 0347, 0324, 0231, 0270, 0302, 0116, 0103, 0377, 
+  0357, 0377, 0242, 0146, 0275, 0331, 0324, 0064, 0376, 0337, 0367, 0334, 0314, 0363, 0030, 0265, 
+  0317, 0172, 0027, 0145, 0003, 0043, 0243, 0101, 0133, 0054, 0260, 0002, 0104, 0375, 0032, 0007, 
+  0250, 0210, 0056, 0074, 0066, 0341, 0043, 0234, 0065, 0267, 0251, 0073, 0326, 0055, 0205, 0346, 
+  0157, 0114, 0143, 0017, 0217, 0211, 0025, 0374, 0042, 0337, 0305, 0223, 0356, 0022, 0335, 0146, 
+  0222, 0143, 0200, 0224, 0272, 0115, 0111, 0312, 0276, 0213, 0155, 0323, 0353, 0030, 0133, 0144, 
+  0007, 0305, 0163, 0213, 0160, 0062, 0110, 0170, 0055, 0021, 0007, 0020, 0031, 0332, 0330, 0104, 
+  0203, 0011, 0272, 0164, 0061, 0166, 0310, 0043, 0172, 0160, 0351, 0030, 0135, 0362, 0066, 0342, 
+  0015, 0340, 0034, 0300, 0071, 0340, 0014, 0341, 0136, 0151, 0023, 0375, 0021, 0361, 0020, 0177, 
+  0173, 0350, 0352, 0143, 0144, 0320, 0061, 0366, 0302, 0202, 0344, 0372, 0300, 0243, 0026, 0247, 
+  0040, 0213, 0167, 0101, 0321, 0263, 0356, 0362, 0246, 0154, 0162, 0010, 0034, 0002, 0070, 0304, 
+  0126, 0161, 0210, 0223, 0352, 0245, 0353, 0213, 0377, 0326, 0116, 0105, 0324, 0133, 0251, 0004, 
+  0105, 0230, 0105, 0026, 0351, 0075, 0022, 0132, 0313, 0172, 0013, 0204, 0364, 0014, 0227, 0132, 
+  0026, 0066, 0127, 0162, 0020, 0336, 0074, 0250, 0346, 0201, 0200, 0247, 0031, 0131, 0252, 0066, 
+  0034, 0171, 0301, 0364, 0006, 0272, 0253, 0071, 0324, 0042, 0006, 0147, 0154, 0066, 0176, 0112, 
+  0346, 0153, 0253, 0131, 0204, 0072, 0137, 0231, 0151, 0344, 0204, 0330, 0112, 0305, 0104, 0210, 
+  0255, 0161, 0065, 0215, 0161, 0136, 0072, 0053, 0173, 0337, 0254, 0327, 0263, 0366, 0060, 0053, 
+  0203, 0337, 0370, 0265, 0136, 0124, 0074, 0341, 0073, 0301, 0317, 0016, 0025, 0107, 0123, 0253, 
+  0057, 0023, 0245, 0211, 0040, 0165, 0023, 0061, 0063, 0106, 0330, 0324, 0110, 0272, 0376, 0034, 
+  0273, 0224, 0162, 0226, 0311, 0127, 0302, 0305, 0250, 0227, 0350, 0303, 0313, 0275, 0314, 0105, 
+  0054, 0165, 0126, 0207, 0306, 0337, 0214, 0137, 0102, 0217, 0306, 0262, 0103, 0343, 0020, 0265, 
+  0054, 0013, 0005, 0257, 0170, 0310, 0305, 0036, 0166, 0237, 0260, 0171, 0170, 0160, 0160, 0213, 
+  0115, 0342, 0205, 0162, 0214, 0363, 0372, 0340, 0254, 0235, 0357, 0141, 0104, 0154, 0344, 0121, 
+  0337, 0065, 0160, 0360, 0313, 0200, 0330, 0272, 0073, 0101, 0017, 0134, 0040, 0172, 0357, 0102, 
+  0335, 0206, 0272, 0301, 0377, 0347, 0013, 0172, 0020, 0346, 0147, 0031, 0101, 0120, 0356, 0035, 
+  0322, 0135, 0214, 0370, 0230, 0307, 0204, 0211, 0243, 0172, 0174, 0002, 0117, 0304, 0344, 0377, 
+  0140, 0043, 0235, 0361, 0377, 0140, 0336, 0211, 0145, 0321, 0147, 0121, 0364, 0223, 0143, 0310, 
+  0014, 0044, 0214, 0047, 0032, 0035, 0214, 0061, 0373, 0307, 0101, 0260, 0024, 0177, 0153, 0374, 
+  0202, 0226, 0307, 0345, 0041, 0372, 0060, 0033, 0220, 0101, 0115, 0214, 0306, 0134, 0047, 0342, 
+  0323, 0140, 0072, 0037, 0250, 0350, 0125, 0037, 0320, 0047, 0361, 0150, 0272, 0012, 0101, 0067, 
+  0066, 0345, 0006, 0031, 0176, 0307, 0237, 0023, 0057, 0070, 0072, 0050, 0072, 0131, 0374, 0250, 
+  0155, 0276, 0031, 0021, 0377, 0044, 0047, 0034, 0062, 0306, 0356, 0341, 0164, 0044, 0315, 0325, 
+  0221, 0360, 0057, 0056, 0254, 0307, 0154, 0044, 0174, 0242, 0246, 0317, 0107, 0127, 0306, 0140, 
+  0370, 0047, 0203, 0076, 0304, 0163, 0223, 0223, 0320, 0170, 0026, 0002, 0025, 0255, 0216, 0370, 
+  0116, 0204, 0247, 0043, 0307, 0072, 0327, 0016, 0105, 0366, 0305, 0174, 0325, 0203, 0255, 0342, 
+  0017, 0203, 0346, 0213, 0323, 0230, 0315, 0357, 0370, 0027, 0161, 0236, 0137, 0120, 0227, 0030, 
+  0117, 0060, 0170, 0237, 0357, 0252, 0350, 0154, 0022, 0324, 0150, 0035, 0140, 0101, 0017, 0174, 
+  0154, 0064, 0150, 0300, 0015, 0141, 0352, 0162, 0372, 0340, 0157, 0360, 0217, 0214, 0051, 0127, 
+  0236, 0302, 0231, 0163, 0252, 0062, 0371, 0327, 0071, 0121, 0205, 0346, 0160, 0060, 0117, 0217, 
+  0076, 0260, 0147, 0101, 0020, 0063, 0122, 0021, 0135, 0170, 0016, 0066, 0004, 0275, 0360, 0206, 
+  0104, 0120, 0221, 0053, 0050, 0305, 0016, 0151, 0306, 0363, 0302, 0261, 0365, 0257, 0072, 0075, 
+  0324, 0353, 0136, 0366, 0177, 0264, 0156, 0333, 0210, 0377, 0373, 0346, 0266, 0373, 0275, 0163, 
+  0321, 0276, 0100, 0147, 0077, 0121, 0377, 0252, 0215, 0132, 0167, 0375, 0253, 0356, 0055, 0372, 
+  0357, 0377, 0156, 0365, 0370, 0343, 0377, 0370, 0017, 0324, 0272, 0276, 0340, 0377, 0367, 0023, 
+  0265, 0377, 0175, 0163, 0333, 0356, 0365, 0120, 0367, 0366, 0240, 0363, 0355, 0346, 0153, 0207, 
+  0067, 0341, 0175, 0334, 0266, 0256, 0373, 0235, 0166, 0357, 0035, 0352, 0134, 0237, 0177, 0275, 
+  0273, 0350, 0134, 0177, 0176, 0207, 0316, 0356, 0372, 0350, 0272, 0333, 0107, 0137, 0073, 0337, 
+  0072, 0175, 0376, 0132, 0277, 0373, 0056, 0350, 0172, 0332, 0354, 0140, 0336, 0014, 0165, 0057, 
+  0321, 0267, 0366, 0355, 0371, 0025, 0377, 0263, 0165, 0326, 0371, 0332, 0351, 0377, 0014, 0276, 
+  0167, 0331, 0351, 0137, 0213, 0157, 0135, 0362, 0221, 0264, 0320, 0115, 0353, 0266, 0337, 0071, 
+  0277, 0373, 0332, 0272, 0105, 0067, 0167, 0267, 0067, 0335, 0036, 0037, 0345, 0155, 0373, 0340, 
+  0242, 0323, 0073, 0377, 0332, 0352, 0174, 0153, 0163, 0010, 0166, 0256, 0371, 0027, 0121, 0373, 
+  0173, 0373, 0272, 0217, 0172, 0127, 0255, 0257, 0137, 0027, 0347, 0162, 0326, 0346, 0103, 0151, 
+  0235, 0175, 0155, 0207, 0375, 0361, 0271, 0134, 0164, 0156, 0333, 0347, 0375, 0167, 0007, 0235, 
+  0353, 0351, 0277, 0304, 0360, 0371, 0052, 0360, 0121, 0174, 0175, 0207, 0172, 0067, 0355, 0363, 
+  0216, 0370, 0107, 0373, 0337, 0155, 0076, 0344, 0326, 0355, 0317, 0167, 0174, 0326, 0350, 0274, 
+  0173, 0335, 0153, 0377, 0353, 0216, 0277, 0304, 0037, 0242, 0213, 0326, 0267, 0326, 0347, 0166, 
+  0357, 0340, 0157, 0051, 0023, 0347, 0353, 0173, 0176, 0167, 0333, 0376, 0046, 0106, 0306, 0147, 
+  0333, 0273, 0073, 0353, 0365, 0073, 0375, 0273, 0176, 0033, 0175, 0356, 0166, 0057, 0202, 0345, 
+  0354, 0265, 0157, 0277, 0167, 0316, 0333, 0275, 0337, 0320, 0327, 0156, 0057, 0130, 0223, 0273, 
+  0136, 0373, 0035, 0377, 0102, 0277, 0025, 0174, 0230, 0167, 0301, 0027, 0204, 0077, 0026, 0163, 
+  0271, 0353, 0165, 0202, 0245, 0351, 0134, 0367, 0333, 0267, 0267, 0167, 0067, 0375, 0116, 0367, 
+  0372, 0227, 0203, 0253, 0356, 0017, 0076, 0171, 0076, 0306, 0026, 0157, 0172, 0021, 0254, 0141, 
+  0367, 0072, 0230, 0052, 0137, 0207, 0356, 0355, 0117, 0321, 0251, 0130, 0203, 0140, 0211, 0337, 
+  0241, 0037, 0127, 0155, 0376, 0373, 0255, 0130, 0266, 0040, 0351, 0263, 0045, 0026, 0243, 0327, 
+  0277, 0355, 0234, 0367, 0027, 0137, 0343, 0337, 0353, 0167, 0157, 0373, 0150, 0076, 0107, 0164, 
+  0335, 0376, 0374, 0265, 0363, 0271, 0175, 0175, 0336, 0026, 0117, 0273, 0242, 0227, 0037, 0235, 
+  0136, 0373, 0027, 0276, 0043, 0035, 0076, 0262, 0317, 0174, 0111, 0203, 0317, 0376, 0150, 0361, 
+  0157, 0336, 0005, 0123, 0026, 0073, 0301, 0107, 0025, 0376, 0163, 0201, 0372, 0336, 0005, 0373, 
+  0205, 0072, 0227, 0250, 0165, 0361, 0275, 0043, 0206, 0035, 0276, 0174, 0300, 0167, 0270, 0327, 
+  0231, 0122, 0103, 0260, 0144, 0347, 0127, 0323, 0345, 0076, 0314, 0302, 0333, 0125, 0315, 0064, 
+  0111, 0123, 0055, 0103, 0214, 0345, 0143, 0274, 0315, 0124, 0200, 0345, 0126, 0220, 0365, 0126, 
+  0200, 0005, 0047, 0143, 0305, 0245, 0131, 0162, 0011, 0116, 0220, 0244, 0206, 0153, 0260, 0213, 
+  0032, 0305, 0330, 0105, 0123, 0165, 0111, 0245, 0263, 0202, 0217, 0122, 0157, 0121, 0122, 0134, 
+  0023, 0116, 0172, 0255, 0347, 0244, 0127, 0220, 0016, 0330, 0343, 0132, 0005, 0067, 0032, 0334, 
+  0112, 0045, 0125, 0163, 0235, 0210, 0063, 0122, 0114, 0225, 0157, 0213, 0012, 0023, 0034, 0347, 
+  0311, 0216, 0262, 0171, 0321, 0160, 0120, 0153, 0303, 0007, 0265, 0146, 0247, 0167, 0340, 0250, 
+  0126, 0101, 0107, 0265, 0316, 0174, 0313, 0342, 0354, 0264, 0232, 0207, 0265, 0026, 0006, 0007, 
+  0307, 0265, 0066, 0172, 0134, 0153, 0272, 0023, 0333, 0166, 0341, 0046, 0334, 0205, 0231, 0371, 
+  0056, 0314, 0244, 0212, 0175, 0312, 0125, 0372, 0224, 0253, 0123, 0147, 0051, 0345, 0127, 0330, 
+  0371, 0063, 0051, 0275, 0242, 0320, 0073, 0067, 0305, 0005, 0313, 0302, 0317, 0155, 0371, 0143, 
+  0333, 0373, 0324, 0340, 0377, 0166, 0351, 0263, 0367, 0351, 0044, 0270, 0131, 0071, 0111, 0267, 
+  0370, 0354, 0022, 0263, 0112, 0052, 0231, 0154, 0261, 0363, 0154, 0205, 0316, 0127, 0066, 0112, 
+  0306, 0043, 0236, 0311, 0215, 0276, 0262, 0036, 0301, 0326, 0150, 0362, 0032, 0247, 0144, 0130, 
+  0352, 0322, 0025, 0066, 0344, 0042, 0213, 0375, 0314, 0165, 0215, 0360, 0327, 0052, 0227, 0117, 
+  0321, 0136, 0153, 0143, 0146, 0216, 0044, 0045, 0251, 0177, 0051, 0141, 0234, 0145, 0270, 0034, 
+  0317, 0340, 0322, 0174, 0003, 0027, 0045, 0330, 0124, 0062, 0344, 0063, 0045, 0273, 0344, 0003, 
+  0261, 0105, 0322, 0155, 0276, 0300, 0317, 0316, 0104, 0170, 0272, 0276, 0155, 0140, 0057, 0113, 
+  0237, 0212, 0371, 0043, 0345, 0071, 0026, 0343, 0153, 0037, 0026, 0343, 0212, 0113, 0113, 0254, 
+  0210, 0134, 0160, 0374, 0300, 0064, 0376, 0141, 0335, 0030, 0245, 0036, 0302, 0211, 0361, 0235, 
+  0121, 0107, 0245, 0203, 0204, 0154, 0211, 0024, 0167, 0242, 0072, 0004, 0026, 0252, 0122, 0057, 
+  0260, 0362, 0220, 0222, 0122, 0152, 0122, 0227, 0215, 0220, 0254, 0135, 0244, 0126, 0050, 0273, 
+  0366, 0307, 0003, 0354, 0212, 0150, 0026, 0315, 0214, 0230, 0221, 0122, 0175, 0351, 0310, 0245, 
+  0312, 0335, 0303, 0130, 0177, 0321, 0054, 0154, 0017, 0105, 0202, 0102, 0043, 0023, 0141, 0052, 
+  0324, 0212, 0216, 0364, 0157, 0310, 0324, 0213, 0246, 0177, 0146, 0012, 0166, 0250, 0327, 0176, 
+  0336, 0006, 0364, 0067, 0252, 0205, 0376, 0035, 0023, 0200, 0067, 0056, 0036, 0023, 0177, 0014, 
+  0022, 0260, 0114, 0014, 0064, 0366, 0102, 0002, 0116, 0111, 0151, 0127, 0105, 0340, 0164, 0172, 
+  0042, 0245, 0042, 0024, 0202, 0040, 0003, 0313, 0224, 0201, 0205, 0054, 0167, 0045, 0045, 0142, 
+  0003, 0044, 0142, 0265, 0223, 0376, 0074, 0006, 0342, 0260, 0114, 0000, 0064, 0367, 0102, 0034, 
+  0012, 0072, 0332, 0125, 0131, 0050, 0346, 0006, 0202, 0160, 0075, 0202, 0060, 0377, 0132, 0127, 
+  0122, 0012, 0066, 0053, 0055, 0005, 0225, 0223, 0314, 0336, 0244, 0333, 0130, 0261, 0062, 0161, 
+  0047, 0317, 0352, 0011, 0176, 0267, 0033, 0267, 0276, 0224, 0226, 0103, 0050, 0357, 0024, 0311, 
+  0050, 0371, 0312, 0070, 0114, 0265, 0032, 0265, 0352, 0021, 0353, 0011, 0273, 0262, 0161, 0053, 
   0010, 0077, 0101, 0370, 0011, 0302, 0117, 0020, 0176, 0202, 0360, 0023, 0230, 0333, 0340, 0200, 
-  0006, 0007, 0164, 0165, 0026, 0167, 0244, 0227, 0100, 0020, 0026, 0354, 0156, 0010, 0302, 0356, 
-  0176, 0020, 0066, 0011, 0377, 0020, 0202, 0002, 0016, 0000, 0041, 0050, 0010, 0101, 0101, 0010, 
-  0012, 0024, 0342, 0075, 0017, 0101, 0105, 0002, 0021, 0202, 0120, 0040, 0012, 0041, 0010, 0005, 
-  0101, 0250, 0175, 0010, 0102, 0105, 0034, 0017, 0302, 0120, 0153, 0010, 0103, 0265, 0066, 0035, 
-  0206, 0272, 0026, 0165, 0201, 0235, 0300, 0206, 0100, 0024, 0004, 0242, 0040, 0020, 0005, 0201, 
-  0050, 0010, 0104, 0201, 0321, 0015, 0201, 0050, 0010, 0104, 0155, 0336, 0356, 0236, 0151, 0046, 
-  0020, 0212, 0002, 0353, 0033, 0102, 0121, 0373, 0030, 0212, 0232, 0161, 0000, 0010, 0106, 0001, 
-  0017, 0200, 0140, 0024, 0004, 0243, 0040, 0030, 0005, 0112, 0361, 0236, 0007, 0243, 0146, 0042, 
-  0021, 0302, 0121, 0040, 0014, 0041, 0034, 0005, 0341, 0250, 0335, 0011, 0107, 0311, 0326, 0301, 
-  0313, 0341, 0217, 0232, 0362, 0114, 0010, 0150, 0255, 0041, 0240, 0325, 0336, 0170, 0100, 0113, 
-  0267, 0054, 0335, 0044, 0020, 0321, 0202, 0210, 0026, 0104, 0264, 0040, 0242, 0005, 0021, 0055, 
-  0260, 0334, 0041, 0242, 0005, 0021, 0255, 0132, 0030, 0357, 0063, 0325, 0004, 0102, 0132, 0140, 
-  0301, 0103, 0110, 0153, 0057, 0103, 0132, 0063, 0026, 0000, 0061, 0055, 0140, 0002, 0020, 0323, 
-  0202, 0230, 0026, 0304, 0264, 0100, 0055, 0336, 0367, 0230, 0326, 0114, 0046, 0102, 0120, 0013, 
-  0244, 0041, 0004, 0265, 0040, 0250, 0265, 0073, 0101, 0255, 0024, 0227, 0322, 0214, 0351, 0101, 
-  0124, 0152, 0015, 0121, 0251, 0243, 0112, 0243, 0122, 0011, 0041, 0230, 0126, 0114, 0010, 0106, 
-  0072, 0374, 0122, 0213, 0213, 0253, 0062, 0057, 0235, 0113, 0152, 0310, 0347, 0257, 0026, 0147, 
-  0051, 0043, 0126, 0223, 0022, 0044, 0133, 0131, 0365, 0063, 0152, 0217, 0050, 0127, 0063, 0206, 
-  0241, 0014, 0131, 0120, 0106, 0146, 0017, 0266, 0201, 0273, 0250, 0151, 0004, 0257, 0133, 0207, 
-  0127, 0142, 0142, 0011, 0375, 0060, 0276, 0241, 0046, 0310, 0066, 0273, 0055, 0141, 0330, 0116, 
-  0146, 0134, 0342, 0151, 0162, 0031, 0124, 0361, 0124, 0271, 0351, 0354, 0360, 0152, 0256, 0306, 
-  0363, 0124, 0201, 0174, 0315, 0347, 0114, 0075, 0271, 0175, 0364, 0114, 0221, 0277, 0146, 0051, 
-  0017, 0305, 0334, 0152, 0005, 0314, 0207, 0024, 0205, 0041, 0103, 0356, 0313, 0001, 0165, 0172, 
-  0015, 0364, 0042, 0104, 0373, 0237, 0117, 0207, 0127, 0153, 0306, 0147, 0336, 0346, 0122, 0327, 
-  0075, 0047, 0343, 0333, 0057, 0326, 0201, 0332, 0255, 0323, 0005, 0154, 0033, 0333, 0046, 0014, 
-  0235, 0215, 0165, 0347, 0076, 0333, 0335, 0137, 0056, 0027, 0123, 0263, 0151, 0366, 0075, 0224, 
-  0377, 0171, 0167, 0035, 0055, 0351, 0116, 0212, 0225, 0273, 0241, 0151, 0221, 0113, 0306, 0053, 
-  0346, 0327, 0355, 0355, 0341, 0327, 0311, 0227, 0275, 0157, 0201, 0125, 0360, 0256, 0014, 0253, 
-  0040, 0156, 0062, 0361, 0023, 0171, 0075, 0224, 0331, 0255, 0272, 0112, 0327, 0005, 0337, 0021, 
-  0313, 0122, 0273, 0210, 0167, 0176, 0273, 0162, 0302, 0102, 0305, 0314, 0365, 0325, 0074, 0023, 
-  0257, 0103, 0177, 0145, 0303, 0063, 0302, 0054, 0074, 0322, 0275, 0106, 0362, 0165, 0335, 0227, 
-  0130, 0347, 0264, 0162, 0272, 0360, 0316, 0206, 0056, 0355, 0366, 0307, 0334, 0106, 0061, 0304, 
-  0035, 0364, 0332, 0050, 0322, 0061, 0222, 0077, 0267, 0062, 0307, 0106, 0372, 0035, 0323, 0161, 
-  0142, 0143, 0243, 0227, 0114, 0047, 0213, 0204, 0251, 0116, 0225, 0330, 0121, 0062, 0133, 0056, 
-  0314, 0377, 0223, 0170, 0376, 0052, 0242, 0126, 0140, 0027, 0163, 0041, 0370, 0312, 0046, 0174, 
-  0305, 0116, 0060, 0325, 0036, 0253, 0335, 0011, 0225, 0146, 0141, 0023, 0215, 0072, 0132, 0050, 
-  0164, 0024, 0167, 0121, 0115, 0235, 0133, 0155, 0155, 0021, 0174, 0227, 0236, 0153, 0272, 0312, 
-  0073, 0334, 0300, 0175, 0041, 0022, 0261, 0242, 0262, 0055, 0003, 0137, 0334, 0353, 0356, 0122, 
-  0156, 0213, 0145, 0315, 0062, 0136, 0106, 0044, 0113, 0226, 0170, 0327, 0314, 0212, 0204, 0277, 
-  0053, 0042, 0341, 0063, 0151, 0060, 0221, 0045, 0056, 0076, 0130, 0045, 0312, 0216, 0051, 0042, 
-  0137, 0066, 0127, 0126, 0043, 0223, 0346, 0114, 0367, 0307, 0013, 0277, 0115, 0173, 0173, 0275, 
-  0226, 0256, 0053, 0126, 0261, 0325, 0134, 0370, 0337, 0353, 0325, 0134, 0141, 0157, 0014, 0273, 
-  0032, 0161, 0014, 0017, 0107, 0035, 0267, 0262, 0233, 0270, 0372, 0075, 0136, 0156, 0262, 0334, 
-  0042, 0175, 0146, 0202, 0070, 0346, 0163, 0012, 0377, 0212, 0377, 0114, 0052, 0334, 0124, 0031, 
-  0336, 0062, 0361, 0304, 0217, 0252, 0307, 0315, 0355, 0345, 0221, 0235, 0131, 0241, 0133, 0177, 
-  0263, 0002, 0050, 0231, 0047, 0377, 0014, 0307, 0047, 0323, 0207, 0100, 0131, 0340, 0160, 0210, 
-  0130, 0304, 0111, 0033, 0356, 0012, 0070, 0214, 0071, 0070, 0102, 0167, 0216, 0316, 0260, 0044, 
-  0072, 0162, 0022, 0376, 0167, 0342, 0230, 0364, 0151, 0276, 0015, 0323, 0277, 0163, 0356, 0272, 
-  0252, 0245, 0275, 0312, 0013, 0175, 0362, 0247, 0036, 0156, 0261, 0324, 0007, 0270, 0124, 0143, 
-  0036, 0235, 0150, 0117, 0204, 0215, 0065, 0127, 0367, 0102, 0174, 0310, 0174, 0210, 0030, 0102, 
-  0374, 0014, 0030, 0065, 0036, 0174, 0115, 0374, 0161, 0350, 0072, 0367, 0231, 0330, 0175, 0340, 
-  0326, 0266, 0100, 0243, 0247, 0215, 0111, 0342, 0227, 0062, 0050, 0177, 0331, 0207, 0271, 0021, 
-  0012, 0227, 0071, 0322, 0223, 0320, 0006, 0013, 0305, 0130, 0251, 0305, 0210, 0162, 0121, 0157, 
-  0047, 0370, 0251, 0137, 0267, 0241, 0036, 0341, 0133, 0250, 0107, 0152, 0061, 0027, 0121, 0214, 
-  0030, 0272, 0045, 0323, 0160, 0244, 0373, 0130, 0140, 0115, 0233, 0153, 0325, 0334, 0242, 0110, 
-  0126, 0032, 0227, 0144, 0312, 0162, 0234, 0240, 0225, 0024, 0047, 0220, 0212, 0021, 0154, 0124, 
-  0235, 0224, 0212, 0013, 0344, 0331, 0247, 0130, 0377, 0320, 0314, 0116, 0122, 0122, 0166, 0124, 
-  0002, 0020, 0105, 0203, 0017, 0262, 0207, 0225, 0006, 0056, 0161, 0026, 0375, 0231, 0202, 0017, 
-  0206, 0277, 0305, 0272, 0063, 0253, 0210, 0000, 0251, 0066, 0315, 0164, 0375, 0015, 0307, 0030, 
-  0271, 0324, 0143, 0167, 0224, 0053, 0210, 0310, 0340, 0023, 0212, 0164, 0377, 0103, 0225, 0257, 
-  0310, 0173, 0000, 0363, 0173, 0377, 0322, 0110, 0270, 0165, 0234, 0243, 0345, 0214, 0216, 0125, 
-  0033, 0057, 0044, 0120, 0274, 0127, 0151, 0371, 0104, 0114, 0056, 0173, 0214, 0261, 0356, 0371, 
-  0252, 0115, 0023, 0167, 0257, 0171, 0330, 0124, 0162, 0236, 0110, 0046, 0157, 0344, 0112, 0332, 
-  0370, 0137, 0374, 0177, 0052, 0235, 0276, 0112, 0321, 0060, 0311, 0075, 0141, 0276, 0172, 0007, 
-  0102, 0300, 0212, 0200, 0323, 0360, 0363, 0317, 0336, 0325, 0365, 0355, 0360, 0347, 0145, 0357, 
-  0152, 0370, 0363, 0252, 0377, 0263, 0373, 0265, 0377, 0277, 0173, 0350, 0377, 0240, 0225, 0047, 
-  0127, 0135, 0225, 0257, 0350, 0013, 0312, 0375, 0262, 0262, 0257, 0004, 0141, 0213, 0330, 0043, 
-  0315, 0023, 0132, 0132, 0150, 0006, 0250, 0264, 0215, 0126, 0046, 0303, 0253, 0370, 0272, 0221, 
-  0023, 0330, 0330, 0043, 0106, 0026, 0307, 0330, 0251, 0333, 0374, 0066, 0342, 0311, 0123, 0152, 
-  0122, 0202, 0053, 0117, 0102, 0061, 0071, 0332, 0136, 0305, 0244, 0052, 0311, 0375, 0132, 0152, 
-  0047, 0205, 0040, 0353, 0040, 0263, 0225, 0302, 0216, 0205, 0102, 0216, 0305, 0303, 0215, 0025, 
-  0206, 0032, 0067, 0242, 0144, 0050, 0004, 0266, 0167, 0040, 0207, 0055, 0073, 0234, 0270, 0325, 
-  0311, 0153, 0225, 0204, 0015, 0113, 0226, 0230, 0255, 0172, 0336, 0177, 0253, 0352, 0274, 0055, 
-  0241, 0227, 0155, 0222, 0336, 0055, 0010, 0304, 0101, 0040, 0356, 0265, 0144, 0343, 0152, 0005, 
-  0104, 0341, 0040, 0012, 0227, 0034, 0205, 0233, 0105, 0057, 0040, 0004, 0127, 0050, 0022, 0061, 
-  0017, 0124, 0135, 0022, 0237, 0017, 0165, 0122, 0317, 0130, 0325, 0302, 0340, 0302, 0160, 0320, 
-  0262, 0301, 0001, 0021, 0253, 0265, 0106, 0254, 0246, 0233, 0121, 0152, 0320, 0152, 0312, 0076, 
-  0264, 0320, 0261, 0327, 0070, 0371, 0173, 0373, 0130, 0266, 0305, 0030, 0223, 0373, 0061, 0347, 
-  0073, 0037, 0262, 0143, 0272, 0162, 0361, 0247, 0014, 0302, 0034, 0030, 0036, 0265, 0054, 0154, 
-  0306, 0254, 0310, 0253, 0107, 0325, 0020, 0250, 0154, 0223, 0245, 0222, 0132, 0304, 0221, 0012, 
-  0004, 0161, 0346, 0150, 0351, 0023, 0315, 0017, 0347, 0021, 0326, 0225, 0112, 0206, 0203, 0204, 
-  0270, 0373, 0106, 0360, 0223, 0360, 0207, 0157, 0124, 0347, 0220, 0071, 0245, 0362, 0022, 0175, 
-  0072, 0332, 0357, 0123, 0052, 0162, 0345, 0304, 0324, 0353, 0257, 0035, 0355, 0152, 0375, 0265, 
-  0065, 0225, 0117, 0133, 0142, 0062, 0202, 0175, 0015, 0046, 0366, 0210, 0132, 0133, 0220, 0220, 
-  0015, 0005, 0021, 0322, 0266, 0073, 0075, 0141, 0030, 0172, 0207, 0336, 0267, 0252, 0167, 0070, 
-  0261, 0225, 0245, 0055, 0326, 0377, 0234, 0226, 0124, 0202, 0111, 0342, 0300, 0213, 0064, 0266, 
-  0211, 0320, 0034, 0034, 0206, 0235, 0271, 0122, 0257, 0136, 0371, 0130, 0374, 0251, 0337, 0163, 
-  0173, 0110, 0163, 0164, 0026, 0170, 0272, 0365, 0322, 0127, 0025, 0342, 0171, 0350, 0141, 0054, 
-  0264, 0334, 0045, 0011, 0375, 0362, 0343, 0166, 0125, 0355, 0360, 0060, 0365, 0070, 0354, 0365, 
-  0102, 0343, 0030, 0013, 0033, 0102, 0363, 0271, 0265, 0152, 0104, 0336, 0335, 0274, 0035, 0141, 
-  0107, 0014, 0104, 0273, 0347, 0372, 0240, 0046, 0254, 0143, 0076, 0261, 0021, 0145, 0343, 0002, 
-  0135, 0061, 0276, 0055, 0263, 0256, 0362, 0216, 0152, 0146, 0154, 0013, 0167, 0231, 0317, 0271, 
-  0006, 0357, 0166, 0352, 0065, 0223, 0356, 0061, 0362, 0332, 0022, 0021, 0075, 0343, 0366, 0273, 
-  0026, 0376, 0311, 0255, 0265, 0371, 0212, 0245, 0235, 0062, 0213, 0045, 0300, 0301, 0113, 0333, 
-  0324, 0063, 0145, 0351, 0244, 0235, 0367, 0070, 0131, 0035, 0171, 0176, 0153, 0255, 0074, 0177, 
-  0157, 0152, 0116, 0053, 0327, 0061, 0330, 0244, 0341, 0264, 0120, 0131, 0151, 0146, 0070, 0205, 
-  0066, 0323, 0256, 0226, 0124, 0352, 0040, 0137, 0030, 0206, 0310, 0017, 0147, 0171, 0270, 0013, 
-  0065, 0225, 0216, 0152, 0133, 0123, 0051, 0042, 0045, 0050, 0053, 0130, 0323, 0252, 0152, 0213, 
-  0011, 0112, 0123, 0360, 0137, 0140, 0146, 0214, 0317, 0371, 0046, 0046, 0127, 0113, 0250, 0053, 
-  0364, 0225, 0053, 0047, 0024, 0116, 0145, 0052, 0057, 0245, 0051, 0067, 0073, 0073, 0247, 0117, 
-  0216, 0105, 0165, 0023, 0231, 0374, 0147, 0164, 0347, 0121, 0033, 0375, 0320, 0307, 0224, 0376, 
-  0005, 0135, 0020, 0107, 0337, 0170, 0321, 0070, 0354, 0230, 0371, 0270, 0233, 0244, 0163, 0266, 
-  0350, 0261, 0001, 0171, 0364, 0310, 0272, 0035, 0347, 0000, 0142, 0116, 0226, 0337, 0261, 0024, 
-  0044, 0225, 0343, 0177, 0124, 0215, 0335, 0175, 0302, 0014, 0211, 0131, 0346, 0355, 0071, 0107, 
-  0051, 0117, 0311, 0324, 0260, 0322, 0123, 0304, 0122, 0272, 0364, 0331, 0204, 0157, 0325, 0254, 
-  0073, 0207, 0172, 0266, 0156, 0345, 0350, 0346, 0051, 0262, 0274, 0013, 0367, 0363, 0250, 0173, 
-  0104, 0167, 0124, 0073, 0222, 0251, 0242, 0041, 0043, 0134, 0063, 0155, 0247, 0270, 0000, 0255, 
-  0131, 0106, 0105, 0015, 0160, 0240, 0203, 0253, 0025, 0034, 0271, 0162, 0165, 0140, 0324, 0215, 
-  0372, 0370, 0111, 0112, 0045, 0123, 0356, 0101, 0042, 0142, 0224, 0120, 0030, 0047, 0042, 0043, 
-  0205, 0100, 0234, 0021, 0115, 0224, 0224, 0053, 0271, 0010, 0301, 0050, 0271, 0077, 0321, 0011, 
-  0272, 0366, 0350, 0043, 0061, 0261, 0211, 0106, 0023, 0011, 0105, 0257, 0160, 0326, 0044, 0244, 
-  0351, 0255, 0051, 0115, 0157, 0041, 0161, 0013, 0362, 0355, 0226, 0363, 0355, 0050, 0343, 0303, 
-  0364, 0153, 0232, 0157, 0067, 0037, 0034, 0224, 0207, 0330, 0154, 0262, 0135, 0264, 0023, 0233, 
-  0255, 0020, 0061, 0063, 0173, 0303, 0342, 0005, 0131, 0057, 0247, 0106, 0020, 0213, 0327, 0236, 
-  0130, 0312, 0023, 0324, 0132, 0252, 0151, 0202, 0062, 0055, 0352, 0136, 0336, 0042, 0041, 0342, 
-  0360, 0156, 0041, 0342, 0220, 0031, 0145, 0330, 0375, 0032, 0030, 0321, 0151, 0366, 0074, 0125, 
-  0063, 0344, 0032, 0055, 0045, 0314, 0265, 0244, 0052, 0155, 0274, 0276, 0265, 0123, 0251, 0225, 
-  0124, 0310, 0044, 0363, 0074, 0353, 0273, 0070, 0152, 0221, 0216, 0113, 0155, 0364, 0270, 0310, 
-  0362, 0202, 0067, 0025, 0217, 0301, 0146, 0347, 0066, 0312, 0236, 0177, 0355, 0370, 0056, 0377, 
-  0101, 0366, 0106, 0335, 0215, 0144, 0201, 0226, 0165, 0025, 0057, 0015, 0330, 0336, 0035, 0361, 
-  0344, 0322, 0313, 0314, 0223, 0171, 0062, 0011, 0333, 0035, 0227, 0167, 0242, 0364, 0214, 0171, 
-  0226, 0152, 0157, 0112, 0376, 0307, 0255, 0275, 0301, 0240, 0271, 0336, 0173, 0265, 0001, 0360, 
-  0000, 0170, 0000, 0374, 0046, 0001, 0337, 0002, 0300, 0003, 0340, 0001, 0360, 0373, 0003, 0370, 
-  0366, 0172, 0001, 0237, 0104, 0272, 0265, 0200, 0372, 0163, 0066, 0331, 0311, 0223, 0334, 0177, 
-  0252, 0164, 0043, 0115, 0153, 0373, 0121, 0310, 0003, 0344, 0004, 0310, 0211, 0215, 0310, 0211, 
-  0213, 0235, 0026, 0022, 0155, 0100, 0073, 0240, 0035, 0320, 0376, 0202, 0366, 0033, 0100, 0173, 
-  0015, 0154, 0300, 0132, 0253, 0204, 0343, 0264, 0200, 0134, 0116, 0031, 0103, 0254, 0365, 0325, 
-  0066, 0075, 0332, 0022, 0226, 0277, 0157, 0104, 0060, 0115, 0327, 0250, 0077, 0035, 0000, 0063, 
-  0250, 0224, 0016, 0376, 0025, 0020, 0126, 0177, 0042, 0000, 0047, 0101, 0245, 0104, 0220, 0235, 
-  0013, 0137, 0027, 0102, 0070, 0002, 0103, 0000, 0014, 0201, 0335, 0063, 0004, 0316, 0301, 0020, 
-  0000, 0264, 0003, 0332, 0041, 0030, 0264, 0347, 0301, 0040, 0000, 0074, 0000, 0176, 0007, 0001, 
-  0377, 0057, 0020, 0357, 0140, 0325, 0101, 0350, 0267, 0244, 0320, 0057, 0170, 0204, 0200, 0154, 
-  0200, 0333, 0000, 0331, 0254, 0207, 0154, 0216, 0066, 0173, 0307, 0232, 0234, 0136, 0235, 0203, 
-  0135, 0346, 0274, 0063, 0255, 0376, 0167, 0215, 0110, 0371, 0107, 0125, 0174, 0243, 0016, 0366, 
-  0164, 0253, 0214, 0073, 0112, 0136, 0125, 0311, 0030, 0121, 0313, 0314, 0177, 0055, 0311, 0372, 
-  0010, 0250, 0312, 0113, 0367, 0136, 0016, 0051, 0275, 0207, 0103, 0112, 0160, 0110, 0011, 0214, 
-  0130, 0360, 0132, 0301, 0041, 0045, 0000, 0074, 0000, 0036, 0000, 0017, 0207, 0224, 0000, 0360, 
-  0000, 0170, 0000, 0374, 0076, 0036, 0122, 0002, 0300, 0003, 0340, 0001, 0360, 0020, 0210, 0006, 
-  0300, 0003, 0340, 0001, 0360, 0153, 0001, 0374, 0073, 0000, 0074, 0000, 0036, 0000, 0277, 0077, 
-  0200, 0077, 0006, 0300, 0003, 0340, 0167, 0017, 0360, 0135, 0110, 0065, 0003, 0027, 0075, 0240, 
-  0175, 0117, 0320, 0076, 0000, 0264, 0203, 0177, 0036, 0320, 0276, 0047, 0150, 0077, 0005, 0264, 
-  0203, 0163, 0036, 0320, 0276, 0057, 0246, 0073, 0240, 0035, 0074, 0363, 0200, 0366, 0075, 0101, 
-  0173, 0017, 0320, 0016, 0156, 0171, 0100, 0373, 0236, 0240, 0375, 0032, 0320, 0136, 0003, 0237, 
-  0374, 0276, 0225, 0371, 0351, 0232, 0204, 0155, 0303, 0131, 0055, 0250, 0031, 0127, 0117, 0372, 
-  0031, 0140, 0043, 0360, 0010, 0043, 0330, 0337, 0151, 0052, 0202, 0363, 0305, 0225, 0122, 0321, 
-  0151, 0140, 0131, 0204, 0072, 0073, 0115, 0102, 0160, 0326, 0270, 0122, 0022, 0072, 0323, 0375, 
-  0361, 0116, 0323, 0317, 0021, 0320, 0117, 0225, 0364, 0323, 0271, 0356, 0355, 0064, 0371, 0274, 
-  0003, 0362, 0251, 0222, 0174, 0256, 0075, 0174, 0207, 0075, 0354, 0030, 0073, 0256, 0010, 0201, 
-  0071, 0006, 0025, 0063, 0300, 0012, 0003, 0262, 0131, 0017, 0331, 0200, 0331, 0005, 0144, 0003, 
-  0246, 0026, 0220, 0315, 0172, 0310, 0006, 0054, 0054, 0040, 0033, 0260, 0254, 0200, 0154, 0326, 
-  0103, 0066, 0307, 0065, 0052, 0042, 0327, 0332, 0174, 0021, 0271, 0204, 0032, 0140, 0107, 0120, 
-  0003, 0154, 0002, 0036, 0030, 0251, 0333, 0213, 0260, 0345, 0102, 0044, 0023, 0362, 0136, 0040, 
-  0357, 0145, 0273, 0362, 0136, 0056, 0041, 0357, 0005, 0320, 0016, 0150, 0337, 0023, 0264, 0177, 
-  0006, 0264, 0303, 0351, 0064, 0100, 0373, 0236, 0240, 0275, 0003, 0150, 0207, 0323, 0151, 0200, 
-  0366, 0075, 0101, 0073, 0024, 0226, 0001, 0145, 0036, 0000, 0017, 0200, 0007, 0300, 0203, 0076, 
-  0017, 0200, 0007, 0300, 0103, 0065, 0150, 0110, 0257, 0055, 0053, 0270, 0103, 0331, 0003, 0236, 
-  0300, 0031, 0043, 0040, 0241, 0374, 0276, 0210, 0121, 0226, 0350, 0200, 0023, 0106, 0220, 0210, 
-  0002, 0271, 0331, 0100, 0066, 0100, 0066, 0040, 0256, 0200, 0154, 0352, 0234, 0233, 0135, 0122, 
-  0332, 0133, 0033, 0356, 0116, 0135, 0373, 0335, 0251, 0227, 0304, 0147, 0324, 0233, 0240, 0357, 
-  0304, 0341, 0106, 0375, 0036, 0137, 0241, 0332, 0136, 0107, 0372, 0144, 0033, 0322, 0047, 0041, 
-  0175, 0122, 0362, 0116, 0143, 0206, 0316, 0371, 0057, 0220, 0102, 0011, 0046, 0166, 0156, 0367, 
-  0240, 0105, 0325, 0306, 0000, 0076, 0032, 0360, 0353, 0203, 0137, 0177, 0363, 0176, 0375, 0163, 
-  0310, 0323, 0201, 0260, 0075, 0240, 0175, 0137, 0242, 0170, 0200, 0166, 0220, 0355, 0200, 0166, 
-  0210, 0331, 0103, 0126, 0036, 0000, 0036, 0000, 0017, 0200, 0207, 0254, 0074, 0010, 0131, 0101, 
-  0310, 0012, 0274, 0206, 0100, 0066, 0265, 0013, 0220, 0157, 0062, 0102, 0165, 0004, 0221, 0316, 
-  0042, 0221, 0316, 0205, 0222, 0240, 0073, 0025, 0355, 0154, 0325, 0066, 0332, 0371, 0016, 0242, 
-  0235, 0020, 0355, 0224, 0273, 0266, 0140, 0114, 0237, 0320, 0231, 0105, 0215, 0007, 0037, 0002, 
-  0236, 0020, 0360, 0054, 0104, 0106, 0075, 0307, 0044, 0006, 0334, 0177, 0001, 0164, 0124, 0054, 
-  0371, 0142, 0060, 0261, 0271, 0060, 0367, 0041, 0103, 0035, 0310, 0010, 0362, 0057, 0340, 0246, 
-  0117, 0160, 0331, 0356, 0221, 0313, 0366, 0277, 0040, 0042, 0013, 0001, 0032, 0100, 0373, 0236, 
-  0240, 0375, 0337, 0200, 0166, 0310, 0277, 0000, 0264, 0357, 0011, 0332, 0007, 0200, 0166, 0250, 
-  0201, 0006, 0150, 0207, 0334, 0312, 0175, 0106, 0073, 0330, 0355, 0200, 0166, 0110, 0265, 0202, 
-  0334, 0112, 0000, 0074, 0000, 0036, 0000, 0017, 0271, 0225, 0000, 0170, 0000, 0074, 0000, 0176, 
-  0253, 0001, 0017, 0006, 0074, 0000, 0036, 0000, 0277, 0107, 0200, 0207, 0353, 0121, 0041, 0015, 
-  0036, 0122, 0020, 0201, 0154, 0266, 0350, 0364, 0004, 0220, 0015, 0224, 0027, 0004, 0262, 0001, 
-  0262, 0131, 0217, 0156, 0263, 0311, 0363, 0065, 0160, 0126, 0253, 0320, 0131, 0255, 0076, 0033, 
-  0143, 0157, 0172, 0112, 0313, 0337, 0215, 0143, 0132, 0355, 0332, 0036, 0323, 0202, 0073, 0275, 
-  0341, 0230, 0226, 0034, 0054, 0057, 0210, 0205, 0341, 0174, 0026, 0034, 0210, 0310, 0113, 0077, 
-  0375, 0317, 0160, 0052, 0013, 0250, 0007, 0216, 0323, 0200, 0017, 0037, 0174, 0370, 0220, 0204, 
-  0007, 0051, 0267, 0200, 0166, 0100, 0373, 0316, 0241, 0275, 0017, 0150, 0207, 0204, 0034, 0100, 
-  0373, 0236, 0240, 0375, 0002, 0320, 0016, 0371, 0266, 0200, 0166, 0310, 0306, 0201, 0004, 0173, 
-  0000, 0074, 0000, 0036, 0000, 0017, 0011, 0366, 0000, 0170, 0000, 0074, 0000, 0036, 0022, 0354, 
-  0041, 0225, 0011, 0122, 0231, 0040, 0244, 0014, 0144, 0003, 0261, 0144, 0040, 0033, 0270, 0316, 
-  0173, 0043, 0211, 0223, 0256, 0245, 0033, 0170, 0114, 0055, 0023, 0173, 0157, 0053, 0150, 0271, 
-  0274, 0120, 0113, 0017, 0243, 0056, 0221, 0320, 0150, 0371, 0004, 0011, 0263, 0360, 0110, 0367, 
-  0136, 0000, 0266, 0012, 0300, 0113, 0254, 0363, 0117, 0235, 0056, 0274, 0223, 0003, 0174, 0171, 
-  0100, 0267, 0252, 0212, 0163, 0105, 0334, 0020, 0251, 0026, 0332, 0050, 0140, 0214, 0072, 0051, 
-  0237, 0133, 0231, 0143, 0143, 0313, 0322, 0126, 0123, 0356, 0105, 0247, 0354, 0001, 0117, 0112, 
-  0311, 0075, 0275, 0243, 0016, 0323, 0114, 0354, 0033, 0057, 0351, 0247, 0375, 0347, 0311, 0075, 
-  0166, 0264, 0001, 0377, 0052, 0152, 0065, 0363, 0047, 0242, 0346, 0312, 0035, 0376, 0212, 0235, 
-  0340, 0164, 0272, 0263, 0225, 0356, 0204, 0112, 0263, 0260, 0211, 0106, 0035, 0116, 0171, 0304, 
-  0170, 0120, 0115, 0007, 0305, 0006, 0046, 0217, 0330, 0347, 0213, 0174, 0247, 0007, 0026, 0123, 
-  0373, 0264, 0207, 0055, 0202, 0357, 0032, 0047, 0016, 0165, 0244, 0333, 0270, 0324, 0015, 0334, 
-  0027, 0042, 0021, 0053, 0052, 0333, 0062, 0340, 0270, 0342, 0255, 0351, 0043, 0366, 0262, 0146, 
-  0031, 0057, 0272, 0343, 0031, 0123, 0262, 0002, 0240, 0033, 0006, 0266, 0260, 0247, 0063, 0352, 
-  0041, 0076, 0130, 0276, 0324, 0015, 0344, 0163, 0013, 0135, 0267, 0370, 0146, 0211, 0305, 0306, 
-  0146, 0003, 0331, 0324, 0044, 0167, 0004, 0173, 0202, 0102, 0316, 0077, 0377, 0074, 0353, 0137, 
-  0015, 0157, 0372, 0137, 0176, 0176, 0355, 0014, 0076, 0057, 0123, 0147, 0046, 0015, 0046, 0262, 
-  0304, 0305, 0007, 0361, 0104, 0331, 0100, 0304, 0374, 0330, 0370, 0252, 0023, 0247, 0153, 0022, 
-  0026, 0376, 0062, 0355, 0105, 0205, 0060, 0125, 0131, 0303, 0362, 0062, 0307, 0217, 0254, 0307, 
-  0260, 0275, 0072, 0272, 0001, 0066, 0002, 0217, 0260, 0311, 0246, 0071, 0166, 0062, 0023, 0373, 
-  0071, 0035, 0042, 0211, 0057, 0207, 0037, 0107, 0233, 0201, 0303, 0011, 0313, 0042, 0116, 0332, 
-  0230, 0127, 0110, 0312, 0237, 0223, 0224, 0156, 0060, 0362, 0250, 0063, 0054, 0111, 0123, 0231, 
-  0022, 0064, 0317, 0306, 0234, 0006, 0226, 0105, 0226, 0330, 0133, 0335, 0366, 0145, 0072, 0302, 
-  0112, 0067, 0145, 0124, 0257, 0115, 0071, 0323, 0375, 0161, 0215, 0167, 0104, 0014, 0257, 0322, 
-  0355, 0060, 0066, 0261, 0035, 0003, 0354, 0352, 0341, 0030, 0136, 0366, 0145, 0255, 0073, 0120, 
-  0011, 0041, 0165, 0256, 0173, 0365, 0245, 0243, 0316, 0365, 0317, 0136, 0245, 0144, 0104, 0352, 
-  0205, 0152, 0161, 0251, 0126, 0215, 0121, 0275, 0160, 0347, 0127, 0245, 0273, 0342, 0226, 0277, 
-  0053, 0052, 0372, 0222, 0070, 0227, 0123, 0137, 0175, 0151, 0066, 0272, 0113, 0342, 0363, 0005, 
-  0253, 0261, 0272, 0024, 0016, 0360, 0247, 0067, 0251, 0224, 0124, 0074, 0220, 0003, 0305, 0130, 
-  0317, 0214, 0234, 0376, 0025, 0020, 0126, 0143, 0326, 0043, 0206, 0127, 0051, 0041, 0375, 0261, 
-  0131, 0236, 0163, 0211, 0055, 0267, 0276, 0074, 0147, 0066, 0272, 0251, 0205, 0136, 0143, 0236, 
-  0103, 0331, 0317, 0044, 0107, 0123, 0151, 0244, 0362, 0120, 0017, 0245, 0141, 0266, 0051, 0235, 
-  0021, 0015, 0352, 0014, 0335, 0160, 0174, 0225, 0156, 0210, 0276, 0156, 0354, 0166, 0134, 0327, 
-  0042, 0206, 0316, 0270, 0321, 0031, 0235, 0252, 0237, 0357, 0312, 0364, 0357, 0162, 0141, 0054, 
-  0363, 0372, 0324, 0133, 0247, 0075, 0021, 0223, 0161, 0323, 0360, 0327, 0017, 0307, 0262, 0055, 
-  0306, 0321, 0151, 0376, 0223, 0137, 0333, 0231, 0115, 0210, 0041, 0034, 0001, 0003, 0046, 0256, 
-  0226, 0324, 0304, 0037, 0207, 0256, 0163, 0237, 0325, 0050, 0364, 0201, 0333, 0234, 0122, 0103, 
-  0237, 0175, 0056, 0226, 0064, 0060, 0074, 0152, 0131, 0330, 0134, 0132, 0335, 0262, 0211, 0135, 
-  0266, 0311, 0122, 0172, 0015, 0161, 0222, 0175, 0371, 0351, 0236, 0343, 0157, 0004, 0077, 0271, 
-  0324, 0143, 0033, 0365, 0340, 0307, 0173, 0105, 0227, 0113, 0033, 0264, 0222, 0112, 0033, 0110, 
-  0227, 0067, 0330, 0134, 0354, 0123, 0041, 0273, 0351, 0224, 0076, 0157, 0103, 0156, 0023, 0365, 
-  0010, 0166, 0130, 0310, 0173, 0032, 0047, 0217, 0374, 0001, 0147, 0104, 0331, 0071, 0106, 0211, 
-  0353, 0020, 0277, 0026, 0067, 0370, 0021, 0353, 0234, 0307, 0316, 0371, 0132, 0170, 0235, 0354, 
-  0313, 0317, 0111, 0075, 0025, 0134, 0253, 0062, 0326, 0053, 0066, 0044, 0052, 0304, 0022, 0021, 
-  0113, 0066, 0105, 0255, 0157, 0021, 0223, 0013, 0033, 0267, 0140, 0147, 0146, 0340, 0115, 0067, 
-  0342, 0250, 0331, 0314, 0323, 0227, 0027, 0056, 0250, 0026, 0356, 0216, 0302, 0022, 0245, 0356, 
-  0146, 0014, 0202, 0217, 0146, 0010, 0156, 0305, 0040, 0130, 0002, 0315, 0313, 0124, 0220, 0000, 
-  0360, 0122, 0251, 0240, 0054, 0112, 0210, 0035, 0314, 0064, 0247, 0122, 0046, 0277, 0056, 0345, 
-  0110, 0076, 0176, 0166, 0165, 0307, 0124, 0234, 0122, 0346, 0316, 0345, 0311, 0127, 0255, 0144, 
-  0365, 0313, 0334, 0201, 0102, 0045, 0015, 0052, 0331, 0210, 0202, 0031, 0267, 0112, 0031, 0270, 
-  0151, 0241, 0320, 0374, 0104, 0242, 0052, 0304, 0052, 0043, 0222, 0262, 0011, 0245, 0064, 0241, 
-  0227, 0177, 0135, 0323, 0362, 0055, 0102, 0136, 0170, 0205, 0237, 0176, 0120, 0357, 0141, 0110, 
-  0154, 0234, 0226, 0024, 0135, 0371, 0272, 0127, 0261, 0366, 0151, 0140, 0125, 0143, 0231, 0151, 
-  0075, 0332, 0272, 0167, 0117, 0034, 0055, 0104, 0177, 0106, 0215, 0017, 0305, 0056, 0261, 0340, 
-  0005, 0245, 0164, 0230, 0154, 0324, 0362, 0375, 0107, 0202, 0000, 0220, 0240, 0000, 0365, 0117, 
-  0045, 0147, 0155, 0047, 0015, 0054, 0051, 0357, 0115, 0166, 0052, 0063, 0036, 0131, 0032, 0105, 
-  0334, 0021, 0313, 0052, 0217, 0146, 0135, 0032, 0151, 0124, 0212, 0154, 0067, 0065, 0025, 0057, 
-  0371, 0165, 0005, 0076, 0120, 0046, 0317, 0370, 0001, 0354, 0242, 0002, 0050, 0066, 0233, 0377, 
-  0150, 0066, 0313, 0370, 0204, 0322, 0271, 0013, 0100, 0265, 0022, 0252, 0133, 0165, 0102, 0265, 
-  0374, 0076, 0111, 0166, 0052, 0333, 0241, 0374, 0206, 0347, 0077, 0163, 0123, 0322, 0141, 0212, 
-  0234, 0273, 0041, 0265, 0140, 0140, 0004, 0255, 0060, 0112, 0256, 0263, 0200, 0011, 0004, 0046, 
-  0320, 0066, 0231, 0100, 0137, 0165, 0357, 0001, 0263, 0260, 0212, 0040, 0350, 0064, 0173, 0150, 
-  0002, 0105, 0373, 0217, 0102, 0002, 0360, 0121, 0317, 0001, 0175, 0011, 0254, 0040, 0011, 0266, 
-  0021, 0332, 0100, 0134, 0233, 0001, 0236, 0121, 0205, 0035, 0004, 0246, 0020, 0230, 0102, 0373, 
-  0144, 0012, 0265, 0367, 0303, 0024, 0112, 0076, 0245, 0224, 0343, 0253, 0331, 0133, 0224, 0321, 
-  0111, 0126, 0007, 0331, 0173, 0133, 0030, 0274, 0305, 0300, 0132, 0110, 0356, 0146, 0154, 0177, 
-  0352, 0332, 0025, 0017, 0303, 0367, 0034, 0223, 0030, 0330, 0207, 0100, 0174, 0321, 0100, 0174, 
-  0066, 0114, 0344, 0223, 0220, 0066, 0021, 0001, 0057, 0322, 0115, 0071, 0001, 0360, 0107, 0077, 
-  0134, 0217, 0221, 0356, 0151, 0056, 0265, 0210, 0301, 0325, 0005, 0207, 0223, 0245, 0127, 0165, 
-  0054, 0074, 0041, 0157, 0152, 0153, 0175, 0100, 0217, 0271, 0225, 0104, 0160, 0271, 0124, 0353, 
-  0162, 0171, 0054, 0244, 0276, 0327, 0322, 0201, 0363, 0162, 0164, 0141, 0267, 0114, 0057, 0260, 
-  0067, 0166, 0324, 0225, 0260, 0234, 0307, 0366, 0101, 0066, 0217, 0055, 0035, 0004, 0313, 0071, 
-  0155, 0123, 0225, 0052, 0052, 0031, 0042, 0221, 0333, 0266, 0365, 0136, 0211, 0351, 0305, 0135, 
-  0143, 0152, 0323, 0173, 0354, 0140, 0252, 0252, 0116, 0344, 0337, 0316, 0114, 0357, 0320, 0071, 
-  0175, 0122, 0165, 0014, 0125, 0262, 0015, 0125, 0155, 0105, 0065, 0116, 0042, 0065, 0107, 0021, 
-  0137, 0343, 0262, 0076, 0122, 0330, 0117, 0224, 0207, 0167, 0347, 0343, 0337, 0345, 0106, 0125, 
-  0053, 0160, 0053, 0024, 0140, 0300, 0312, 0114, 0270, 0002, 0344, 0136, 0351, 0276, 0251, 0377, 
-  0001, 0340, 0255, 0030, 0274, 0321, 0062, 0003, 0176, 0025, 0213, 0274, 0001, 0176, 0263, 0360, 
-  0073, 0270, 0006, 0354, 0126, 0214, 0335, 0301, 0137, 0165, 0333, 0375, 0355, 0032, 0035, 0067, 
-  0233, 0133, 0215, 0264, 0066, 0040, 0255, 0010, 0322, 0116, 0011, 0063, 0050, 0161, 0000, 0156, 
-  0025, 0303, 0155, 0272, 0316, 0133, 0015, 0265, 0043, 0200, 0132, 0021, 0250, 0175, 0032, 0000, 
-  0312, 0052, 0106, 0331, 0047, 0152, 0231, 0157, 0007, 0304, 0172, 0334, 0162, 0365, 0361, 0075, 
-  0040, 0255, 0020, 0322, 0070, 0031, 0000, 0326, 0326, 0200, 0265, 0255, 0006, 0331, 0073, 0000, 
-  0131, 0041, 0033, 0055, 0144, 0263, 0000, 0263, 0252, 0355, 0264, 0355, 0227, 0146, 0307, 0173, 
-  0005, 0064, 0210, 0376, 0155, 0107, 0266, 0041, 0204, 0257, 0201, 0200, 0125, 0011, 0270, 0015, 
-  0341, 0153, 0251, 0360, 0365, 0067, 0161, 0027, 0002, 0104, 0257, 0067, 0035, 0275, 0346, 0273, 
-  0201, 0237, 0303, 0275, 0000, 0015, 0255, 0072, 0015, 0355, 0350, 0350, 0315, 0361, 0321, 0373, 
-  0303, 0017, 0315, 0203, 0243, 0366, 0273, 0343, 0243, 0167, 0307, 0020, 0020, 0203, 0200, 0166, 
-  0045, 0001, 0155, 0300, 0363, 0072, 0360, 0334, 0152, 0275, 0151, 0375, 0375, 0375, 0141, 0273, 
-  0015, 0070, 0206, 0300, 0166, 0351, 0201, 0155, 0300, 0360, 0132, 0144, 0362, 0233, 0277, 0037, 
-  0177, 0070, 0154, 0203, 0050, 0206, 0210, 0171, 0105, 0021, 0163, 0200, 0160, 0305, 0020, 0376, 
-  0265, 0011, 0340, 0205, 0030, 0174, 0351, 0061, 0170, 0300, 0055, 0340, 0166, 0003, 0270, 0205, 
-  0210, 0176, 0061, 0334, 0122, 0313, 0004, 0344, 0002, 0162, 0067, 0200, 0134, 0110, 0023, 0050, 
-  0146, 0361, 0206, 0361, 0153, 0300, 0056, 0140, 0167, 0003, 0330, 0205, 0314, 0203, 0162, 0027, 
-  0174, 0153, 0003, 0267, 0107, 0120, 0347, 0010, 0252, 0361, 0024, 0253, 0306, 0323, 0252, 0262, 
-  0032, 0117, 0332, 0272, 0245, 0257, 0131, 0261, 0250, 0133, 0001, 0076, 0227, 0062, 0331, 0304, 
-  0211, 0252, 0334, 0200, 0044, 0125, 0340, 0246, 0252, 0313, 0220, 0362, 0064, 0127, 0252, 0173, 
-  0273, 0062, 0360, 0042, 0215, 0155, 0042, 0322, 0072, 0270, 0264, 0166, 0346, 0367, 0247, 0265, 
-  0224, 0367, 0136, 0374, 0251, 0337, 0353, 0014, 0153, 0216, 0316, 0002, 0117, 0267, 0136, 0372, 
-  0222, 0032, 0223, 0142, 0065, 0251, 0241, 0207, 0261, 0050, 0236, 0063, 0317, 0035, 0171, 0371, 
-  0145, 0063, 0145, 0244, 0362, 0166, 0341, 0141, 0352, 0231, 0330, 0323, 0013, 0215, 0143, 0114, 
-  0271, 0222, 0254, 0371, 0330, 0342, 0213, 0024, 0162, 0233, 0274, 0035, 0141, 0107, 0014, 0104, 
-  0273, 0367, 0210, 0251, 0211, 0233, 0013, 0371, 0304, 0106, 0224, 0215, 0013, 0164, 0305, 0370, 
-  0266, 0314, 0272, 0312, 0073, 0252, 0331, 0105, 0210, 0032, 0165, 0064, 0237, 0263, 0014, 0336, 
-  0255, 0141, 0021, 0343, 0101, 0365, 0226, 0051, 0104, 0204, 0112, 0352, 0314, 0056, 0251, 0372, 
-  0330, 0130, 0130, 0061, 0245, 0352, 0131, 0202, 0326, 0006, 0057, 0155, 0337, 0126, 0044, 0357, 
-  0266, 0214, 0341, 0267, 0326, 0312, 0360, 0023, 0056, 0005, 0153, 0047, 0144, 0243, 0111, 0137, 
-  0355, 0127, 0245, 0130, 0310, 0165, 0107, 0336, 0264, 0014, 0062, 0207, 0041, 0243, 0266, 0204, 
-  0115, 0262, 0302, 0140, 0350, 0223, 0172, 0202, 0131, 0131, 0211, 0152, 0252, 0154, 0375, 0332, 
-  0243, 0367, 0036, 0366, 0375, 0123, 0175, 0132, 0047, 0160, 0361, 0207, 0055, 0253, 0017, 0250, 
-  0156, 0303, 0257, 0210, 0324, 0200, 0177, 0132, 0363, 0031, 0166, 0071, 0064, 0017, 0333, 0271, 
-  0156, 0345, 0143, 0370, 0231, 0305, 0232, 0374, 0027, 0304, 0321, 0035, 0203, 0350, 0026, 0072, 
-  0263, 0104, 0061, 0257, 0074, 0235, 0207, 0267, 0241, 0206, 0137, 0220, 0134, 0351, 0362, 0025, 
-  0174, 0365, 0364, 0222, 0202, 0306, 0371, 0072, 0153, 0146, 0236, 0006, 0034, 0364, 0116, 0204, 
-  0204, 0013, 0314, 0214, 0361, 0071, 0337, 0302, 0323, 0341, 0325, 0326, 0351, 0070, 0006, 0046, 
-  0217, 0330, 0327, 0246, 0267, 0364, 0346, 0357, 0211, 0121, 0152, 0061, 0342, 0152, 0211, 0124, 
-  0175, 0116, 0237, 0034, 0213, 0352, 0046, 0062, 0371, 0317, 0350, 0316, 0243, 0066, 0342, 0204, 
-  0356, 0214, 0203, 0321, 0041, 0241, 0210, 0253, 0310, 0350, 0207, 0076, 0246, 0364, 0057, 0050, 
-  0042, 0377, 0015, 0001, 0373, 0121, 0355, 0252, 0214, 0074, 0005, 0076, 0027, 0174, 0250, 0163, 
-  0312, 0141, 0122, 0047, 0365, 0153, 0175, 0341, 0145, 0312, 0211, 0102, 0314, 0220, 0230, 0145, 
-  0336, 0236, 0163, 0172, 0056, 0177, 0347, 0274, 0303, 0043, 0243, 0200, 0141, 0077, 0323, 0321, 
-  0362, 0362, 0352, 0314, 0271, 0300, 0255, 0056, 0016, 0012, 0337, 0150, 0240, 0107, 0341, 0342, 
-  0376, 0330, 0350, 0077, 0117, 0270, 0200, 0325, 0006, 0174, 0166, 0250, 0325, 0154, 0144, 0126, 
-  0110, 0226, 0373, 0170, 0141, 0307, 0114, 0334, 0115, 0345, 0346, 0374, 0246, 0362, 0120, 0033, 
-  0307, 0246, 0344, 0105, 0345, 0333, 0046, 0024, 0132, 0033, 0025, 0012, 0331, 0365, 0262, 0241, 
-  0367, 0034, 0275, 0327, 0321, 0202, 0152, 0227, 0155, 0101, 0305, 0117, 0062, 0346, 0345, 0325, 
-  0027, 0137, 0275, 0264, 0374, 0302, 0322, 0303, 0251, 0155, 0055, 0052, 0365, 0362, 0351, 0020, 
-  0146, 0341, 0321, 0202, 0262, 0276, 0052, 0231, 0242, 0342, 0224, 0057, 0032, 0276, 0360, 0335, 
-  0314, 0177, 0112, 0276, 0251, 0076, 0123, 0012, 0345, 0221, 0070, 0261, 0012, 0255, 0041, 0256, 
-  0201, 0321, 0106, 0221, 0356, 0225, 0374, 0271, 0225, 0151, 0057, 0211, 0325, 0044, 0211, 0234, 
-  0176, 0327, 0275, 0224, 0250, 0315, 0053, 0132, 0345, 0105, 0351, 0213, 0155, 0340, 0047, 0366, 
-  0225, 0054, 0170, 0012, 0113, 0271, 0044, 0251, 0226, 0111, 0244, 0161, 0034, 0143, 0165, 0037, 
-  0276, 0142, 0047, 0130, 0124, 0254, 0005, 0001, 0136, 0020, 0013, 0207, 0277, 0257, 0350, 0326, 
-  0145, 0357, 0220, 0112, 0263, 0260, 0211, 0160, 0172, 0115, 0275, 0135, 0112, 0273, 0253, 0246, 
-  0164, 0257, 0266, 0346, 0106, 0341, 0135, 0172, 0345, 0355, 0325, 0140, 0207, 0033, 0270, 0342, 
-  0062, 0245, 0371, 0172, 0312, 0066, 0015, 0070, 0340, 0170, 0163, 0341, 0306, 0314, 0232, 0146, 
-  0074, 0243, 0113, 0226, 0005, 0261, 0254, 0161, 0125, 0233, 0271, 0053, 0242, 0315, 0124, 0110, 
-  0231, 0135, 0223, 0060, 0240, 0314, 0362, 0050, 0163, 0266, 0236, 0153, 0243, 0314, 0225, 0135, 
-  0356, 0331, 0372, 0175, 0134, 0062, 0113, 0156, 0263, 0253, 0210, 0251, 0365, 0272, 0055, 0061, 
-  0370, 0246, 0072, 0341, 0255, 0224, 0026, 0361, 0271, 0136, 0143, 0232, 0252, 0315, 0177, 0372, 
-  0344, 0117, 0234, 0252, 0065, 0113, 0253, 0045, 0161, 0100, 0305, 0345, 0002, 0065, 0111, 0333, 
-  0123, 0216, 0344, 0306, 0150, 0147, 0245, 0061, 0201, 0113, 0154, 0271, 0300, 0004, 0312, 0143, 
-  0002, 0263, 0365, 0004, 0046, 0220, 0305, 0004, 0306, 0174, 0245, 0146, 0301, 0141, 0277, 0146, 
-  0234, 0140, 0274, 0151, 0116, 0320, 0316, 0313, 0011, 0022, 0255, 0251, 0305, 0007, 0061, 0227, 
-  0006, 0233, 0302, 0107, 0145, 0363, 0255, 0230, 0005, 0107, 0360, 0335, 0045, 0015, 0074, 0177, 
-  0341, 0301, 0264, 0313, 0327, 0004, 0354, 0272, 0202, 0164, 0077, 0274, 0036, 0360, 0212, 0375, 
-  0303, 0260, 0253, 0021, 0307, 0360, 0160, 0324, 0131, 0053, 0253, 0201, 0313, 0311, 0170, 0261, 
-  0301, 0373, 0127, 0006, 0160, 0372, 0204, 0004, 0006, 0347, 0123, 0011, 0377, 0212, 0377, 0114, 
-  0052, 0014, 0124, 0111, 0177, 0031, 0243, 0361, 0243, 0352, 0061, 0154, 0057, 0217, 0054, 0274, 
-  0034, 0164, 0323, 0366, 0151, 0262, 0311, 0366, 0063, 0034, 0237, 0114, 0037, 0202, 0231, 0005, 
-  0016, 0127, 0224, 0105, 0124, 0076, 0145, 0270, 0053, 0170, 0063, 0346, 0170, 0233, 0105, 0344, 
-  0045, 0001, 0227, 0223, 0336, 0247, 0271, 0073, 0057, 0333, 0260, 0224, 0313, 0243, 0274, 0353, 
-  0061, 0357, 0247, 0312, 0236, 0125, 0231, 0303, 0331, 0131, 0224, 0247, 0041, 0365, 0001, 0156, 
-  0361, 0062, 0217, 0116, 0264, 0047, 0302, 0306, 0232, 0253, 0173, 0041, 0076, 0144, 0076, 0044, 
-  0130, 0147, 0343, 0144, 0300, 0250, 0361, 0340, 0153, 0342, 0217, 0103, 0327, 0271, 0317, 0104, 
-  0356, 0003, 0161, 0065, 0201, 0106, 0117, 0033, 0223, 0304, 0057, 0055, 0123, 0376, 0162, 0014, 
-  0275, 0075, 0213, 0241, 0177, 0130, 0210, 0241, 0147, 0306, 0315, 0067, 0002, 0203, 0345, 0333, 
-  0206, 0217, 0025, 0232, 0204, 0267, 0011, 0253, 0064, 0140, 0324, 0125, 0153, 0220, 0032, 0250, 
-  0217, 0013, 0316, 0373, 0134, 0132, 0160, 0141, 0301, 0305, 0111, 0123, 0152, 0275, 0024, 0102, 
-  0361, 0062, 0372, 0346, 0242, 0256, 0051, 0100, 0026, 0322, 0335, 0140, 0142, 0217, 0250, 0165, 
-  0353, 0232, 0034, 0343, 0365, 0122, 0072, 0127, 0365, 0106, 0045, 0265, 0123, 0076, 0200, 0350, 
-  0207, 0113, 0200, 0204, 0025, 0024, 0305, 0021, 0243, 0042, 0032, 0103, 0117, 0270, 0052, 0017, 
-  0015, 0152, 0313, 0176, 0122, 0056, 0134, 0230, 0053, 0035, 0060, 0127, 0032, 0240, 0254, 0212, 
-  0232, 0024, 0052, 0254, 0205, 0212, 0232, 0036, 0006, 0214, 0310, 0067, 0135, 0137, 0115, 0217, 
-  0234, 0225, 0022, 0252, 0113, 0013, 0317, 0025, 0322, 0174, 0375, 0315, 0150, 0276, 0162, 0141, 
-  0265, 0264, 0010, 0307, 0161, 0265, 0266, 0363, 0026, 0271, 0330, 0103, 0066, 0073, 0045, 0124, 
-  0364, 0205, 0063, 0231, 0172, 0173, 0332, 0163, 0221, 0110, 0023, 0110, 0244, 0020, 0211, 0214, 
-  0351, 0023, 0232, 0226, 0304, 0003, 0352, 0110, 0075, 0116, 0131, 0026, 0165, 0014, 0270, 0262, 
-  0316, 0077, 0063, 0127, 0206, 0306, 0141, 0031, 0074, 0261, 0003, 0323, 0107, 0365, 0321, 0204, 
-  0062, 0125, 0031, 0051, 0372, 0051, 0105, 0131, 0011, 0315, 0301, 0254, 0131, 0257, 0110, 0261, 
-  0347, 0334, 0366, 0344, 0246, 0305, 0330, 0006, 0250, 0220, 0233, 0367, 0334, 0034, 0334, 0122, 
-  0042, 0214, 0006, 0137, 0107, 0032, 0374, 0163, 0153, 0151, 0360, 0010, 0344, 0244, 0002, 0211, 
-  0355, 0231, 0230, 0004, 0342, 0230, 0021, 0107, 0350, 0037, 0107, 0364, 0016, 0105, 0316, 0014, 
-  0240, 0220, 0364, 0134, 0263, 0322, 0104, 0230, 0113, 0234, 0327, 0236, 0245, 0160, 0053, 0302, 
-  0007, 0053, 0127, 0254, 0327, 0132, 0204, 0111, 0223, 0120, 0051, 0162, 0354, 0061, 0127, 0053, 
-  0133, 0177, 0326, 0054, 0354, 0334, 0063, 0045, 0161, 0222, 0064, 0143, 0351, 0036, 0236, 0247, 
-  0203, 0155, 0036, 0036, 0313, 0357, 0222, 0353, 0153, 0202, 0131, 0153, 0117, 0272, 0347, 0204, 
-  0216, 0117, 0045, 0250, 0023, 0307, 0015, 0230, 0346, 0006, 0236, 0033, 0306, 0143, 0234, 0300, 
-  0036, 0051, 0050, 0011, 0013, 0201, 0262, 0230, 0350, 0231, 0364, 0034, 0054, 0142, 0217, 0064, 
-  0117, 0050, 0013, 0362, 0153, 0345, 0073, 0072, 0047, 0062, 0252, 0061, 0302, 0005, 0225, 0032, 
-  0211, 0362, 0111, 0142, 0217, 0030, 0152, 0215, 0236, 0074, 0335, 0125, 0153, 0021, 0204, 0364, 
-  0255, 0271, 0324, 0042, 0306, 0244, 0161, 0102, 0356, 0064, 0101, 0214, 0246, 0002, 0345, 0006, 
-  0070, 0045, 0077, 0142, 0163, 0272, 0122, 0305, 0314, 0356, 0214, 0332, 0043, 0312, 0231, 0332, 
-  0060, 0304, 0323, 0214, 0335, 0335, 0272, 0327, 0330, 0373, 0112, 0234, 0331, 0323, 0072, 0311, 
-  0313, 0114, 0236, 0067, 0145, 0165, 0210, 0117, 0001, 0361, 0071, 0160, 0311, 0125, 0107, 0256, 
-  0027, 0206, 0344, 0260, 0306, 0365, 0165, 0276, 0156, 0304, 0266, 0261, 0111, 0164, 0371, 0221, 
-  0316, 0054, 0206, 0246, 0122, 0006, 0211, 0166, 0107, 0236, 0261, 0251, 0075, 0021, 0123, 0360, 
-  0332, 0364, 0125, 0047, 0014, 0333, 0253, 0352, 0204, 0370, 0065, 0156, 0315, 0371, 0070, 0304, 
-  0043, 0351, 0367, 0133, 0212, 0357, 0267, 0025, 0337, 0077, 0122, 0174, 0377, 0235, 0342, 0373, 
-  0307, 0212, 0357, 0277, 0217, 0173, 0077, 0372, 0315, 0257, 0013, 0247, 0151, 0201, 0342, 0255, 
-  0316, 0101, 0366, 0114, 0365, 0006, 0032, 0171, 0011, 0266, 0142, 0203, 0330, 0272, 0205, 0256, 
-  0105, 0366, 0066, 0230, 0146, 0351, 0215, 0252, 0325, 0126, 0370, 0126, 0104, 0273, 0260, 0225, 
-  0352, 0212, 0044, 0041, 0201, 0252, 0122, 0222, 0252, 0122, 0212, 0052, 0121, 0063, 0321, 0135, 
-  0061, 0354, 0056, 0070, 0147, 0172, 0355, 0021, 0021, 0277, 0235, 0215, 0051, 0067, 0144, 0275, 
-  0272, 0147, 0331, 0224, 0352, 0121, 0071, 0033, 0353, 0316, 0075, 0106, 0154, 0214, 0221, 0140, 
-  0330, 0310, 0307, 0214, 0221, 0325, 0034, 0267, 0344, 0304, 0163, 0141, 0277, 0107, 0034, 0275, 
-  0055, 0057, 0205, 0234, 0373, 0040, 0114, 0272, 0346, 0322, 0040, 0220, 0346, 0021, 0256, 0207, 
-  0037, 0011, 0236, 0126, 0271, 0170, 0233, 0141, 0341, 0213, 0323, 0203, 0263, 0006, 0234, 0073, 
-  0170, 0023, 0125, 0076, 0027, 0036, 0043, 0214, 0131, 0261, 0332, 0104, 0035, 0336, 0203, 0356, 
-  0062, 0073, 0043, 0111, 0035, 0310, 0331, 0050, 0112, 0025, 0225, 0034, 0053, 0206, 0063, 0304, 
-  0165, 0300, 0207, 0220, 0157, 0330, 0303, 0116, 0355, 0025, 0373, 0242, 0247, 0264, 0340, 0100, 
-  0126, 0261, 0003, 0131, 0263, 0003, 0026, 0160, 0126, 0270, 0320, 0141, 0211, 0371, 0131, 0232, 
-  0001, 0066, 0002, 0217, 0060, 0202, 0375, 0172, 0236, 0250, 0231, 0216, 0157, 0002, 0247, 0152, 
-  0066, 0176, 0252, 0146, 0266, 0025, 0245, 0236, 0254, 0121, 0077, 0050, 0023, 0062, 0234, 0231, 
-  0235, 0172, 0164, 0334, 0224, 0155, 0061, 0253, 0060, 0333, 0156, 0066, 0267, 0377, 0064, 0316, 
-  0352, 0311, 0214, 0045, 0047, 0314, 0046, 0017, 0332, 0050, 0235, 0151, 0241, 0236, 0050, 0047, 
-  0250, 0107, 0107, 0044, 0071, 0223, 0146, 0304, 0320, 0055, 0051, 0305, 0151, 0166, 0020, 0346, 
-  0070, 0357, 0131, 0226, 0001, 0127, 0107, 0037, 0226, 0051, 0073, 0372, 0251, 0106, 0032, 0223, 
-  0154, 0075, 0317, 0025, 0175, 0133, 0160, 0247, 0360, 0340, 0251, 0146, 0006, 0336, 0164, 0171, 
-  0217, 0233, 0315, 0034, 0355, 0205, 0276, 0331, 0070, 0361, 0055, 0142, 0142, 0055, 0124, 0376, 
-  0075, 0001, 0043, 0371, 0000, 0074, 0303, 0236, 0113, 0055, 0021, 0052, 0216, 0016, 0370, 0346, 
-  0070, 0155, 0262, 0174, 0364, 0254, 0065, 0073, 0172, 0366, 0076, 0246, 0174, 0253, 0164, 0351, 
-  0326, 0132, 0034, 0114, 0131, 0072, 0321, 0165, 0254, 0332, 0122, 0251, 0300, 0152, 0031, 0105, 
-  0132, 0125, 0112, 0252, 0247, 0325, 0016, 0254, 0125, 0311, 0334, 0224, 0124, 0301, 0360, 0274, 
-  0105, 0146, 0177, 0331, 0125, 0365, 0112, 0053, 0345, 0227, 0125, 0302, 0017, 0112, 0373, 0257, 
-  0320, 0141, 0067, 0364, 0254, 0055, 0163, 0371, 0160, 0137, 0303, 0007, 0253, 0241, 0213, 0252, 
-  0151, 0064, 0117, 0363, 0354, 0274, 0351, 0360, 0174, 0220, 0057, 0107, 0257, 0205, 0012, 0224, 
-  0346, 0213, 0157, 0110, 0045, 0242, 0051, 0123, 0231, 0104, 0076, 0131, 0242, 0065, 0071, 0267, 
-  0352, 0222, 0127, 0365, 0373, 0277, 0177, 0374, 0227, 0152, 0307, 0257, 0022, 0316, 0164, 0313, 
-  0035, 0353, 0131, 0000, 0330, 0367, 0352, 0354, 0073, 0051, 0073, 0306, 0334, 0152, 0360, 0101, 
-  0166, 0324, 0254, 0306, 0145, 0161, 0331, 0021, 0356, 0353, 0056, 0311, 0216, 0253, 0060, 0047, 
-  0126, 0144, 0054, 0373, 0162, 0064, 0013, 0362, 0103, 0122, 0176, 0024, 0135, 0331, 0127, 0262, 
-  0304, 0044, 0367, 0204, 0371, 0333, 0047, 0114, 0216, 0100, 0230, 0024, 0024, 0046, 0147, 0324, 
-  0147, 0040, 0112, 0212, 0121, 0341, 0273, 0332, 0211, 0022, 0261, 0253, 0273, 0044, 0110, 0304, 
-  0174, 0020, 0157, 0021, 0161, 0073, 0020, 0043, 0145, 0211, 0221, 0142, 0353, 0272, 0043, 0102, 
-  0344, 0170, 0075, 0325, 0316, 0323, 0046, 0270, 0162, 0316, 0046, 0254, 0171, 0250, 0130, 0363, 
-  0064, 0061, 0151, 0347, 0244, 0223, 0326, 0121, 0302, 0374, 0342, 0103, 0220, 0222, 0045, 0173, 
-  0342, 0331, 0116, 0055, 0374, 0242, 0322, 0121, 0201, 0104, 0156, 0122, 0255, 0133, 0063, 0046, 
-  0034, 0126, 0123, 0065, 0243, 0074, 0054, 0053, 0135, 0216, 0232, 0377, 0142, 0324, 0344, 0002, 
-  0232, 0033, 0166, 0044, 0256, 0146, 0102, 0317, 0005, 0171, 0154, 0022, 0164, 0055, 0225, 0314, 
-  0154, 0127, 0142, 0170, 0123, 0041, 0322, 0221, 0077, 0235, 0335, 0066, 0011, 0362, 0314, 0314, 
-  0347, 0244, 0206, 0121, 0356, 0225, 0346, 0343, 0060, 0352, 0365, 0310, 0247, 0335, 0070, 0241, 
-  0216, 0072, 0255, 0252, 0345, 0121, 0247, 0347, 0123, 0147, 0346, 0111, 0307, 0154, 0125, 0134, 
-  0236, 0165, 0142, 0376, 0364, 0016, 0362, 0210, 0126, 0135, 0325, 0004, 0017, 0333, 0364, 0021, 
-  0227, 0243, 0051, 0334, 0050, 0367, 0045, 0265, 0100, 0362, 0072, 0106, 0376, 0354, 0121, 0051, 
-  0002, 0121, 0047, 0014, 0145, 0241, 0121, 0126, 0012, 0362, 0142, 0216, 0376, 0114, 0034, 0364, 
-  0037, 0352, 0225, 0236, 0237, 0131, 0273, 0066, 0231, 0223, 0347, 0316, 0357, 0253, 0366, 0100, 
-  0000, 0265, 0155, 0302, 0120, 0164, 0056, 0240, 0226, 0347, 0167, 0240, 0264, 0146, 0343, 0244, 
-  0377, 0171, 0147, 0053, 0152, 0322, 0142, 0227, 0331, 0245, 0166, 0270, 0326, 0302, 0122, 0153, 
-  0147, 0307, 0055, 0310, 0375, 0137, 0117, 0356, 0177, 0230, 0311, 0026, 0025, 0200, 0303, 0136, 
-  0235, 0062, 0332, 0244, 0055, 0363, 0325, 0333, 0006, 0302, 0334, 0274, 0245, 0124, 0075, 0331, 
-  0342, 0041, 0220, 0265, 0277, 0331, 0254, 0375, 0345, 0044, 0163, 0310, 0335, 0227, 0116, 0311, 
-  0346, 0126, 0233, 0320, 0073, 0356, 0370, 0074, 0116, 0016, 0376, 0077, 0032, 0274, 0246, 0061, 
-  0000, 0050, 0165, 0165, 0141, 0171, 0051
+  0006, 0007, 0164, 0171, 0026, 0167, 0250, 0227, 0100, 0020, 0026, 0354, 0156, 0010, 0302, 0356, 
+  0176, 0020, 0066, 0016, 0377, 0020, 0202, 0002, 0016, 0000, 0041, 0050, 0010, 0101, 0101, 0010, 
+  0012, 0024, 0342, 0075, 0017, 0101, 0205, 0002, 0021, 0202, 0120, 0040, 0012, 0041, 0010, 0005, 
+  0101, 0250, 0175, 0010, 0102, 0205, 0034, 0017, 0302, 0120, 0153, 0010, 0103, 0065, 0066, 0035, 
+  0206, 0272, 0021, 0165, 0201, 0155, 0177, 0014, 0201, 0050, 0010, 0104, 0101, 0040, 0012, 0002, 
+  0121, 0020, 0210, 0002, 0243, 0033, 0002, 0121, 0020, 0210, 0332, 0274, 0335, 0075, 0323, 0114, 
+  0040, 0024, 0005, 0326, 0067, 0204, 0242, 0366, 0061, 0024, 0065, 0343, 0000, 0020, 0214, 0002, 
+  0036, 0000, 0301, 0050, 0010, 0106, 0101, 0060, 0012, 0224, 0342, 0075, 0017, 0106, 0315, 0104, 
+  0042, 0204, 0243, 0100, 0030, 0102, 0070, 0012, 0302, 0121, 0273, 0023, 0216, 0222, 0255, 0203, 
+  0227, 0301, 0037, 0065, 0345, 0231, 0020, 0320, 0132, 0103, 0100, 0253, 0271, 0361, 0200, 0226, 
+  0156, 0131, 0272, 0111, 0040, 0242, 0005, 0021, 0055, 0210, 0150, 0101, 0104, 0013, 0042, 0132, 
+  0140, 0271, 0103, 0104, 0013, 0042, 0132, 0225, 0060, 0336, 0147, 0252, 0011, 0204, 0264, 0300, 
+  0202, 0207, 0220, 0326, 0136, 0206, 0264, 0146, 0054, 0000, 0142, 0132, 0300, 0004, 0040, 0246, 
+  0005, 0061, 0055, 0210, 0151, 0201, 0132, 0274, 0357, 0061, 0255, 0231, 0114, 0204, 0240, 0026, 
+  0110, 0103, 0010, 0152, 0101, 0120, 0153, 0167, 0202, 0132, 0011, 0056, 0245, 0031, 0323, 0203, 
+  0250, 0324, 0032, 0242, 0122, 0307, 0245, 0106, 0245, 0142, 0102, 0060, 0215, 0210, 0020, 0214, 
+  0164, 0370, 0245, 0022, 0027, 0127, 0245, 0136, 0072, 0027, 0327, 0220, 0317, 0137, 0055, 0316, 
+  0122, 0104, 0254, 0046, 0041, 0110, 0266, 0262, 0352, 0347, 0164, 0074, 0240, 0134, 0315, 0350, 
+  0007, 0062, 0144, 0101, 0031, 0231, 0075, 0330, 0006, 0356, 0242, 0246, 0021, 0274, 0155, 0035, 
+  0134, 0211, 0211, 0045, 0364, 0303, 0350, 0206, 0232, 0040, 0333, 0364, 0266, 0204, 0341, 0161, 
+  0074, 0343, 0022, 0117, 0343, 0313, 0240, 0212, 0247, 0312, 0115, 0147, 0207, 0127, 0063, 0065, 
+  0236, 0247, 0012, 0144, 0153, 0076, 0147, 0352, 0361, 0355, 0303, 0147, 0212, 0374, 0065, 0115, 
+  0171, 0310, 0347, 0126, 0313, 0141, 0076, 0044, 0050, 0014, 0051, 0162, 0137, 0016, 0250, 0323, 
+  0153, 0240, 0027, 0041, 0332, 0375, 0162, 0326, 0277, 0136, 0063, 0076, 0263, 0066, 0227, 0272, 
+  0356, 0071, 0036, 0337, 0136, 0276, 0016, 0324, 0156, 0235, 0316, 0141, 0333, 0214, 0307, 0204, 
+  0241, 0363, 0221, 0156, 0017, 0323, 0335, 0375, 0305, 0162, 0061, 0065, 0233, 0146, 0337, 0103, 
+  0371, 0137, 0166, 0327, 0321, 0222, 0354, 0244, 0130, 0271, 0033, 0232, 0346, 0271, 0144, 0274, 
+  0144, 0176, 0335, 0334, 0036, 0176, 0035, 0177, 0331, 0373, 0026, 0130, 0005, 0357, 0213, 0260, 
+  0012, 0242, 0046, 0023, 0075, 0221, 0267, 0103, 0231, 0335, 0252, 0253, 0164, 0135, 0360, 0003, 
+  0261, 0054, 0265, 0213, 0170, 0347, 0267, 0053, 0307, 0054, 0124, 0304, 0134, 0337, 0314, 0063, 
+  0366, 0072, 0364, 0067, 0066, 0074, 0043, 0314, 0302, 0003, 0335, 0255, 0305, 0137, 0327, 0175, 
+  0205, 0165, 0116, 0053, 0147, 0013, 0357, 0154, 0350, 0322, 0156, 0157, 0304, 0155, 0024, 0103, 
+  0334, 0101, 0257, 0015, 0102, 0035, 0043, 0376, 0163, 0053, 0163, 0254, 0045, 0337, 0061, 0035, 
+  0045, 0066, 0066, 0172, 0311, 0164, 0274, 0110, 0230, 0352, 0124, 0261, 0035, 0305, 0263, 0345, 
+  0334, 0374, 0077, 0216, 0347, 0257, 0042, 0152, 0005, 0166, 0021, 0027, 0202, 0257, 0154, 0302, 
+  0067, 0154, 0373, 0123, 0355, 0261, 0334, 0235, 0120, 0151, 0026, 0064, 0321, 0250, 0255, 0005, 
+  0102, 0107, 0161, 0027, 0325, 0324, 0271, 0325, 0326, 0026, 0301, 0017, 0311, 0271, 0246, 0253, 
+  0274, 0303, 0361, 0235, 0127, 0042, 0021, 0053, 0052, 0333, 0322, 0367, 0304, 0275, 0356, 0016, 
+  0345, 0266, 0130, 0332, 0054, 0243, 0145, 0104, 0274, 0144, 0211, 0166, 0315, 0254, 0110, 0370, 
+  0207, 0074, 0022, 0076, 0225, 0006, 0143, 0131, 0342, 0342, 0203, 0125, 0242, 0154, 0231, 0042, 
+  0362, 0065, 0346, 0312, 0152, 0150, 0322, 0234, 0353, 0336, 0150, 0341, 0267, 0151, 0157, 0157, 
+  0327, 0322, 0161, 0304, 0052, 0066, 0352, 0013, 0377, 0173, 0273, 0232, 0053, 0354, 0215, 0141, 
+  0107, 0043, 0266, 0341, 0342, 0260, 0343, 0106, 0172, 0023, 0107, 0037, 0342, 0345, 0046, 0313, 
+  0055, 0222, 0147, 0046, 0210, 0143, 0076, 0247, 0340, 0257, 0350, 0317, 0044, 0302, 0115, 0225, 
+  0341, 0055, 0023, 0117, 0364, 0250, 0072, 0334, 0334, 0136, 0036, 0331, 0271, 0025, 0270, 0365, 
+  0067, 0053, 0200, 0342, 0171, 0362, 0175, 0060, 0076, 0231, 0076, 0004, 0312, 0174, 0233, 0103, 
+  0304, 0042, 0166, 0322, 0160, 0127, 0300, 0141, 0314, 0301, 0021, 0270, 0163, 0164, 0206, 0045, 
+  0321, 0221, 0221, 0360, 0177, 0020, 0333, 0244, 0317, 0363, 0155, 0230, 0376, 0235, 0161, 0327, 
+  0125, 0055, 0355, 0125, 0136, 0350, 0221, 0077, 0365, 0140, 0213, 0245, 0076, 0300, 0245, 0032, 
+  0163, 0351, 0104, 0173, 0046, 0154, 0244, 0071, 0272, 0033, 0340, 0103, 0346, 0103, 0304, 0020, 
+  0342, 0247, 0307, 0250, 0361, 0350, 0151, 0342, 0217, 0103, 0307, 0036, 0246, 0142, 0367, 0221, 
+  0133, 0333, 0002, 0215, 0256, 0066, 0042, 0261, 0137, 0112, 0241, 0374, 0145, 0037, 0346, 0106, 
+  0050, 0134, 0346, 0110, 0117, 0114, 0033, 0054, 0024, 0143, 0245, 0026, 0003, 0312, 0105, 0375, 
+  0070, 0306, 0117, 0375, 0266, 0015, 0165, 0011, 0337, 0102, 0075, 0124, 0213, 0271, 0210, 0142, 
+  0304, 0320, 0055, 0231, 0206, 0003, 0335, 0303, 0002, 0153, 0332, 0134, 0253, 0346, 0026, 0105, 
+  0274, 0322, 0270, 0044, 0123, 0226, 0343, 0004, 0215, 0270, 0070, 0201, 0124, 0214, 0140, 0243, 
+  0352, 0244, 0124, 0134, 0040, 0313, 0076, 0105, 0372, 0207, 0146, 0166, 0222, 0222, 0262, 0243, 
+  0022, 0200, 0310, 0033, 0174, 0220, 0075, 0254, 0324, 0163, 0210, 0275, 0350, 0317, 0024, 0174, 
+  0060, 0370, 0055, 0322, 0235, 0131, 0106, 0004, 0110, 0265, 0151, 0252, 0353, 0257, 0077, 0302, 
+  0310, 0241, 0056, 0173, 0240, 0134, 0101, 0104, 0006, 0237, 0120, 0250, 0373, 0037, 0252, 0174, 
+  0105, 0336, 0003, 0230, 0335, 0373, 0227, 0104, 0302, 0215, 0223, 0014, 0055, 0147, 0164, 0254, 
+  0332, 0170, 0041, 0201, 0342, 0203, 0112, 0313, 0147, 0142, 0162, 0331, 0143, 0214, 0164, 0327, 
+  0123, 0155, 0032, 0273, 0173, 0365, 0303, 0272, 0222, 0363, 0104, 0062, 0171, 0043, 0123, 0322, 
+  0306, 0377, 0342, 0377, 0123, 0351, 0364, 0115, 0212, 0206, 0111, 0206, 0204, 0171, 0352, 0035, 
+  0010, 0001, 0053, 0002, 0116, 0375, 0057, 0367, 0235, 0353, 0233, 0273, 0376, 0375, 0125, 0347, 
+  0272, 0177, 0177, 0335, 0275, 0157, 0177, 0353, 0376, 0357, 0016, 0372, 0077, 0150, 0345, 0311, 
+  0165, 0133, 0345, 0053, 0372, 0202, 0162, 0277, 0254, 0354, 0053, 0101, 0330, 0042, 0343, 0201, 
+  0346, 0012, 0055, 0055, 0060, 0003, 0124, 0332, 0206, 0053, 0223, 0342, 0125, 0174, 0333, 0310, 
+  0366, 0307, 0330, 0045, 0106, 0032, 0307, 0330, 0251, 0333, 0374, 0066, 0342, 0311, 0123, 0152, 
+  0122, 0200, 0053, 0117, 0102, 0061, 0071, 0336, 0136, 0305, 0244, 0054, 0311, 0375, 0126, 0152, 
+  0307, 0205, 0040, 0253, 0040, 0263, 0225, 0302, 0216, 0271, 0102, 0216, 0371, 0303, 0215, 0045, 
+  0206, 0032, 0067, 0242, 0144, 0050, 0004, 0266, 0167, 0040, 0207, 0055, 0075, 0234, 0270, 0325, 
+  0311, 0153, 0245, 0204, 0015, 0013, 0226, 0230, 0215, 0152, 0336, 0177, 0253, 0352, 0274, 0055, 
+  0240, 0227, 0155, 0222, 0336, 0015, 0010, 0304, 0101, 0040, 0356, 0255, 0144, 0343, 0152, 0005, 
+  0104, 0341, 0040, 0012, 0027, 0037, 0205, 0233, 0105, 0057, 0040, 0004, 0227, 0053, 0022, 0061, 
+  0017, 0124, 0135, 0020, 0175, 0150, 0123, 0217, 0021, 0303, 0253, 0146, 0274, 0352, 0315, 0000, 
+  0157, 0361, 0203, 0213, 0275, 0121, 0205, 0003, 0127, 0323, 0021, 0226, 0032, 0272, 0162, 0213, 
+  0017, 0135, 0345, 0334, 0227, 0366, 0213, 0160, 0201, 0126, 0170, 0133, 0302, 0001, 0242, 0363, 
+  0336, 0367, 0122, 0167, 0006, 0157, 0142, 0147, 0172, 0330, 0321, 0203, 0061, 0274, 0156, 0321, 
+  0132, 0367, 0241, 0054, 0232, 0202, 0020, 0365, 0106, 0103, 0324, 0013, 0273, 0121, 0150, 0244, 
+  0172, 0252, 0063, 0150, 0201, 0067, 0277, 0166, 0372, 0367, 0346, 0211, 0154, 0213, 0021, 0046, 
+  0303, 0021, 0147, 0062, 0047, 0351, 0211, 0034, 0162, 0101, 0347, 0064, 0134, 0031, 0056, 0265, 
+  0054, 0154, 0056, 0115, 0277, 0150, 0112, 0224, 0155, 0262, 0124, 0054, 0217, 0330, 0122, 0041, 
+  0136, 0256, 0366, 0130, 0372, 0104, 0363, 0202, 0171, 0004, 0025, 0343, 0342, 0351, 0136, 0102, 
+  0221, 0355, 0273, 0030, 0177, 0047, 0170, 0225, 0076, 0136, 0037, 0124, 0107, 0277, 0035, 0211, 
+  0311, 0153, 0036, 0307, 0223, 0021, 0032, 0234, 0052, 0215, 0261, 0055, 0160, 0256, 0015, 0135, 
+  0142, 0152, 0002, 0263, 0374, 0333, 0003, 0312, 0106, 0311, 0272, 0043, 0042, 0302, 0067, 0306, 
+  0301, 0252, 0005, 0177, 0362, 0035, 0233, 0177, 0074, 0325, 0273, 0052, 0126, 0260, 0367, 0372, 
+  0176, 0026, 0123, 0177, 0017, 0314, 0344, 0320, 0334, 0215, 0254, 0267, 0204, 0331, 0063, 0165, 
+  0037, 0321, 0002, 0115, 0112, 0141, 0312, 0037, 0304, 0367, 0171, 0213, 0377, 0360, 0261, 0307, 
+  0120, 0237, 0214, 0071, 0164, 0120, 0217, 0330, 0006, 0106, 0075, 0221, 0310, 0341, 0073, 0245, 
+  0030, 0365, 0140, 0105, 0256, 0311, 0212, 0174, 0243, 0147, 0200, 0111, 0270, 0144, 0022, 0136, 
+  0021, 0217, 0017, 0165, 0122, 0115, 0163, 0160, 0141, 0160, 0201, 0372, 0265, 0034, 0203, 0002, 
+  0015, 0161, 0255, 0032, 0342, 0164, 0063, 0052, 0246, 0035, 0176, 0334, 0214, 0166, 0270, 0270, 
+  0042, 0240, 0070, 0056, 0057, 0225, 0320, 0015, 0337, 0370, 0007, 0326, 0357, 0206, 0226, 0051, 
+  0134, 0360, 0232, 0220, 0170, 0274, 0337, 0205, 0013, 0344, 0052, 0114, 0253, 0227, 0344, 0076, 
+  0336, 0325, 0222, 0334, 0153, 0252, 0250, 0275, 0304, 0144, 0004, 0373, 0352, 0115, 0306, 0003, 
+  0152, 0155, 0301, 0031, 0135, 0250, 0221, 0227, 0264, 0335, 0311, 0147, 0110, 0241, 0167, 0350, 
+  0175, 0253, 0172, 0207, 0042, 0036, 0362, 0276, 0304, 0252, 0226, 0356, 0220, 0072, 0163, 0020, 
+  0073, 0360, 0074, 0215, 0307, 0104, 0150, 0016, 0066, 0303, 0366, 0134, 0251, 0127, 0277, 0014, 
+  0107, 0374, 0251, 0017, 0271, 0075, 0244, 0331, 0072, 0363, 0135, 0335, 0172, 0355, 0253, 0014, 
+  0361, 0274, 0354, 0032, 0235, 0112, 0350, 0030, 0267, 0350, 0272, 0044, 0163, 0326, 0056, 0134, 
+  0114, 0135, 0016, 0173, 0075, 0327, 0070, 0224, 0374, 0257, 0005, 0372, 0142, 0045, 0272, 0142, 
+  0174, 0133, 0146, 0135, 0145, 0035, 0325, 0314, 0330, 0026, 0276, 0057, 0217, 0163, 0015, 0336, 
+  0355, 0324, 0005, 0046, 0335, 0243, 0252, 0323, 0070, 0207, 0003, 0131, 0132, 0050, 0344, 0250, 
+  0060, 0122, 0105, 0236, 0337, 0130, 0053, 0317, 0337, 0233, 0153, 0210, 0224, 0113, 0333, 0155, 
+  0322, 0160, 0132, 0050, 0266, 0073, 0063, 0234, 0002, 0233, 0151, 0127, 0253, 0354, 0266, 0220, 
+  0047, 0014, 0103, 0344, 0005, 0263, 0074, 0334, 0205, 0062, 0273, 0307, 0225, 0055, 0263, 0033, 
+  0222, 0022, 0124, 0232, 0257, 0150, 0241, 0355, 0305, 0063, 0053, 0123, 0360, 0137, 0142, 0146, 
+  0214, 0056, 0370, 0046, 0306, 0027, 0320, 0253, 0052, 0364, 0225, 0213, 0351, 0345, 0076, 0335, 
+  0122, 0334, 0051, 0227, 0314, 0354, 0354, 0202, 0076, 0333, 0026, 0325, 0115, 0144, 0362, 0237, 
+  0321, 0203, 0113, 0307, 0350, 0247, 0076, 0242, 0364, 0057, 0350, 0222, 0330, 0372, 0306, 0353, 
+  0210, 0143, 0333, 0314, 0306, 0335, 0044, 0235, 0263, 0171, 0117, 0222, 0313, 0243, 0107, 0326, 
+  0355, 0070, 0007, 0020, 0263, 0323, 0374, 0216, 0205, 0040, 0251, 0030, 0377, 0243, 0152, 0354, 
+  0356, 0063, 0146, 0110, 0314, 0062, 0153, 0317, 0031, 0156, 0167, 0220, 0074, 0055, 0124, 0370, 
+  0251, 0241, 0204, 0056, 0075, 0066, 0021, 0331, 0021, 0323, 0356, 0154, 0352, 0216, 0165, 0053, 
+  0103, 0067, 0317, 0241, 0345, 0235, 0273, 0237, 0047, 0335, 0045, 0272, 0255, 0332, 0221, 0114, 
+  0141, 0105, 0031, 0341, 0232, 0152, 0073, 0105, 0005, 0150, 0315, 0042, 0212, 0054, 0202, 0003, 
+  0035, 0134, 0255, 0340, 0310, 0225, 0053, 0015, 0252, 0156, 0324, 0107, 0117, 0022, 0222, 0356, 
+  0322, 0222, 0356, 0102, 0205, 0100, 0224, 0015, 0212, 0225, 0224, 0112, 0011, 0167, 0242, 0023, 
+  0164, 0343, 0322, 0047, 0142, 0142, 0023, 0015, 0046, 0022, 0212, 0036, 0344, 0334, 0155, 0113, 
+  0316, 0335, 0102, 0342, 0026, 0344, 0333, 0055, 0347, 0333, 0121, 0306, 0207, 0131, 0321, 0343, 
+  0127, 0013, 0203, 0203, 0343, 0030, 0233, 0115, 0266, 0013, 0167, 0142, 0263, 0105, 0003, 0147, 
+  0146, 0157, 0120, 0317, 0056, 0355, 0345, 0304, 0010, 0142, 0376, 0162, 0204, 0113, 0171, 0202, 
+  0132, 0103, 0065, 0115, 0120, 0246, 0105, 0325, 0053, 0036, 0306, 0104, 0034, 0336, 0057, 0104, 
+  0034, 0122, 0243, 0014, 0273, 0137, 0026, 0061, 0054, 0160, 0226, 0245, 0220, 0242, 0134, 0243, 
+  0245, 0204, 0271, 0206, 0124, 0361, 0305, 0151, 0360, 0043, 0133, 0053, 0251, 0220, 0111, 0152, 
+  0211, 0243, 0367, 0121, 0324, 0042, 0035, 0227, 0332, 0150, 0005, 0201, 0345, 0005, 0257, 0053, 
+  0126, 0106, 0112, 0317, 0155, 0224, 0055, 0211, 0324, 0362, 0034, 0376, 0303, 0245, 0313, 0173, 
+  0257, 0152, 0026, 0150, 0040, 0057, 0265, 0327, 0120, 0210, 0112, 0323, 0245, 0274, 0141, 0352, 
+  0263, 0275, 0253, 0372, 0303, 0245, 0227, 0231, 0045, 0363, 0144, 0022, 0264, 0073, 0051, 0256, 
+  0310, 0320, 0071, 0163, 0055, 0325, 0336, 0224, 0374, 0217, 0133, 0173, 0251, 0135, 0271, 0045, 
+  0174, 0000, 0360, 0000, 0170, 0000, 0174, 0245, 0000, 0337, 0000, 0300, 0003, 0340, 0001, 0360, 
+  0373, 0003, 0370, 0346, 0172, 0001, 0037, 0107, 0272, 0225, 0200, 0372, 0113, 0072, 0331, 0311, 
+  0223, 0334, 0177, 0252, 0164, 0043, 0115, 0153, 0373, 0121, 0333, 0021, 0344, 0004, 0310, 0211, 
+  0215, 0310, 0211, 0313, 0235, 0026, 0022, 0115, 0100, 0073, 0240, 0035, 0320, 0076, 0257, 0100, 
+  0003, 0150, 0257, 0200, 0015, 0130, 0151, 0225, 0160, 0224, 0024, 0220, 0313, 0050, 0143, 0210, 
+  0265, 0276, 0353, 0056, 0216, 0267, 0204, 0345, 0357, 0033, 0021, 0114, 0323, 0065, 0252, 0117, 
+  0007, 0300, 0014, 0112, 0245, 0203, 0177, 0371, 0204, 0125, 0237, 0010, 0300, 0111, 0120, 0052, 
+  0021, 0244, 0347, 0302, 0127, 0205, 0020, 0216, 0301, 0020, 0000, 0103, 0140, 0367, 0014, 0201, 
+  0013, 0060, 0004, 0000, 0355, 0200, 0166, 0010, 0006, 0355, 0171, 0060, 0010, 0000, 0017, 0200, 
+  0337, 0101, 0300, 0377, 0013, 0304, 0073, 0130, 0165, 0020, 0372, 0055, 0050, 0364, 0013, 0036, 
+  0041, 0040, 0033, 0340, 0066, 0100, 0066, 0353, 0041, 0233, 0343, 0315, 0136, 0273, 0055, 0247, 
+  0127, 0147, 0140, 0227, 0031, 0257, 0321, 0256, 0376, 0365, 0223, 0122, 0376, 0121, 0025, 0337, 
+  0250, 0215, 0135, 0335, 0052, 0342, 0332, 0312, 0067, 0125, 0062, 0006, 0324, 0062, 0263, 0337, 
+  0124, 0271, 0076, 0002, 0052, 0363, 0036, 0366, 0327, 0103, 0112, 0037, 0340, 0220, 0022, 0034, 
+  0122, 0002, 0043, 0026, 0274, 0126, 0160, 0110, 0011, 0000, 0017, 0200, 0007, 0300, 0303, 0041, 
+  0045, 0000, 0074, 0000, 0036, 0000, 0277, 0217, 0207, 0224, 0000, 0360, 0000, 0170, 0000, 0074, 
+  0004, 0242, 0001, 0360, 0000, 0170, 0000, 0374, 0132, 0000, 0377, 0036, 0000, 0017, 0200, 0007, 
+  0300, 0357, 0017, 0340, 0117, 0000, 0360, 0000, 0370, 0335, 0003, 0174, 0033, 0122, 0315, 0300, 
+  0105, 0017, 0150, 0337, 0023, 0264, 0367, 0000, 0355, 0340, 0237, 0007, 0264, 0357, 0011, 0332, 
+  0317, 0000, 0355, 0340, 0234, 0007, 0264, 0357, 0213, 0351, 0016, 0150, 0007, 0317, 0074, 0240, 
+  0175, 0117, 0320, 0336, 0001, 0264, 0203, 0133, 0036, 0320, 0276, 0047, 0150, 0277, 0001, 0264, 
+  0127, 0300, 0047, 0277, 0157, 0145, 0176, 0332, 0046, 0141, 0333, 0160, 0126, 0013, 0152, 0306, 
+  0125, 0223, 0176, 0172, 0330, 0360, 0135, 0302, 0010, 0366, 0166, 0232, 0212, 0340, 0174, 0161, 
+  0251, 0124, 0164, 0346, 0133, 0026, 0241, 0366, 0116, 0223, 0020, 0234, 0065, 0056, 0225, 0204, 
+  0316, 0165, 0157, 0264, 0323, 0364, 0163, 0014, 0364, 0123, 0046, 0375, 0264, 0156, 0072, 0073, 
+  0115, 0076, 0357, 0201, 0174, 0312, 0044, 0237, 0033, 0027, 0077, 0140, 0027, 0333, 0306, 0216, 
+  0053, 0102, 0140, 0216, 0101, 0305, 0014, 0260, 0302, 0200, 0154, 0326, 0103, 0066, 0140, 0166, 
+  0001, 0331, 0200, 0251, 0005, 0144, 0263, 0036, 0262, 0001, 0013, 0013, 0310, 0006, 0054, 0053, 
+  0040, 0233, 0365, 0220, 0315, 0111, 0205, 0212, 0310, 0065, 0066, 0137, 0104, 0056, 0246, 0006, 
+  0330, 0061, 0324, 0000, 0233, 0200, 0007, 0106, 0352, 0366, 0042, 0154, 0071, 0020, 0311, 0204, 
+  0274, 0027, 0310, 0173, 0331, 0256, 0274, 0227, 0053, 0310, 0173, 0001, 0264, 0003, 0332, 0367, 
+  0004, 0355, 0137, 0000, 0355, 0160, 0072, 0015, 0320, 0276, 0047, 0150, 0157, 0001, 0332, 0341, 
+  0164, 0032, 0240, 0175, 0117, 0320, 0016, 0205, 0145, 0100, 0231, 0007, 0300, 0003, 0340, 0001, 
+  0360, 0240, 0317, 0003, 0340, 0001, 0360, 0120, 0015, 0032, 0322, 0153, 0213, 0012, 0356, 0120, 
+  0366, 0210, 0047, 0160, 0306, 0010, 0110, 0050, 0273, 0057, 0142, 0220, 0046, 0072, 0340, 0204, 
+  0021, 0044, 0242, 0100, 0156, 0066, 0220, 0015, 0220, 0015, 0210, 0053, 0040, 0233, 0052, 0347, 
+  0146, 0027, 0224, 0366, 0326, 0204, 0273, 0123, 0327, 0176, 0167, 0352, 0025, 0361, 0030, 0165, 
+  0047, 0350, 0007, 0261, 0271, 0121, 0277, 0307, 0127, 0250, 0066, 0327, 0221, 0076, 0331, 0204, 
+  0364, 0111, 0110, 0237, 0224, 0274, 0323, 0230, 0241, 0013, 0376, 0013, 0244, 0120, 0202, 0211, 
+  0235, 0331, 0075, 0150, 0121, 0265, 0061, 0200, 0217, 0006, 0374, 0372, 0340, 0327, 0337, 0274, 
+  0137, 0377, 0002, 0362, 0164, 0040, 0154, 0017, 0150, 0337, 0227, 0050, 0036, 0240, 0035, 0144, 
+  0073, 0240, 0035, 0142, 0366, 0220, 0225, 0007, 0200, 0007, 0300, 0003, 0340, 0041, 0053, 0017, 
+  0102, 0126, 0020, 0262, 0002, 0257, 0041, 0220, 0115, 0345, 0002, 0344, 0233, 0214, 0120, 0035, 
+  0103, 0244, 0063, 0117, 0244, 0163, 0241, 0044, 0350, 0116, 0105, 0073, 0033, 0225, 0215, 0166, 
+  0276, 0207, 0150, 0047, 0104, 0073, 0345, 0256, 0055, 0030, 0321, 0147, 0164, 0156, 0121, 0343, 
+  0321, 0203, 0200, 0047, 0004, 0074, 0163, 0221, 0121, 0307, 0066, 0211, 0001, 0367, 0137, 0000, 
+  0035, 0345, 0113, 0276, 0350, 0115, 0306, 0134, 0230, 0173, 0220, 0241, 0016, 0144, 0004, 0371, 
+  0027, 0160, 0323, 0047, 0270, 0154, 0367, 0310, 0145, 0373, 0137, 0020, 0221, 0205, 0000, 0015, 
+  0240, 0175, 0117, 0320, 0376, 0157, 0100, 0073, 0344, 0137, 0000, 0332, 0367, 0004, 0355, 0075, 
+  0100, 0073, 0324, 0100, 0003, 0264, 0103, 0156, 0345, 0076, 0243, 0035, 0354, 0166, 0100, 0073, 
+  0244, 0132, 0101, 0156, 0045, 0000, 0036, 0000, 0017, 0200, 0207, 0334, 0112, 0000, 0074, 0000, 
+  0036, 0000, 0277, 0325, 0200, 0007, 0003, 0036, 0000, 0017, 0200, 0337, 0043, 0300, 0303, 0365, 
+  0250, 0220, 0006, 0017, 0051, 0210, 0100, 0066, 0133, 0164, 0172, 0002, 0310, 0006, 0312, 0013, 
+  0002, 0331, 0000, 0331, 0254, 0107, 0267, 0331, 0344, 0371, 0032, 0070, 0253, 0225, 0353, 0254, 
+  0126, 0227, 0215, 0260, 0073, 0075, 0245, 0345, 0355, 0306, 0061, 0255, 0146, 0145, 0217, 0151, 
+  0301, 0235, 0336, 0160, 0114, 0113, 0016, 0226, 0227, 0304, 0302, 0160, 0076, 0013, 0016, 0104, 
+  0144, 0245, 0237, 0356, 0027, 0070, 0225, 0005, 0324, 0003, 0307, 0151, 0300, 0207, 0017, 0076, 
+  0174, 0110, 0302, 0203, 0224, 0133, 0100, 0073, 0240, 0175, 0347, 0320, 0336, 0005, 0264, 0103, 
+  0102, 0016, 0240, 0175, 0117, 0320, 0176, 0011, 0150, 0207, 0174, 0133, 0100, 0073, 0144, 0343, 
+  0100, 0202, 0075, 0000, 0036, 0000, 0017, 0200, 0207, 0004, 0173, 0000, 0074, 0000, 0036, 0000, 
+  0017, 0011, 0366, 0220, 0312, 0004, 0251, 0114, 0020, 0122, 0006, 0262, 0201, 0130, 0062, 0220, 
+  0015, 0134, 0347, 0275, 0221, 0304, 0111, 0307, 0322, 0015, 0074, 0242, 0226, 0211, 0335, 0243, 
+  0022, 0132, 0056, 0057, 0324, 0322, 0303, 0260, 0113, 0044, 0064, 0132, 0076, 0101, 0302, 0054, 
+  0074, 0320, 0335, 0127, 0200, 0255, 0002, 0360, 0012, 0353, 0374, 0123, 0147, 0013, 0357, 0144, 
+  0000, 0137, 0026, 0320, 0255, 0252, 0342, 0134, 0021, 0067, 0104, 0252, 0205, 0066, 0360, 0031, 
+  0243, 0166, 0302, 0347, 0126, 0346, 0130, 0333, 0262, 0264, 0325, 0204, 0173, 0321, 0051, 0173, 
+  0304, 0223, 0102, 0162, 0117, 0037, 0250, 0315, 0064, 0023, 0173, 0306, 0153, 0372, 0151, 0367, 
+  0145, 0062, 0304, 0266, 0326, 0343, 0137, 0105, 0215, 0172, 0366, 0104, 0324, 0114, 0271, 0303, 
+  0337, 0260, 0355, 0237, 0115, 0167, 0266, 0324, 0235, 0120, 0151, 0026, 0064, 0321, 0250, 0315, 
+  0051, 0217, 0030, 0217, 0252, 0351, 0240, 0330, 0300, 0344, 0011, 0173, 0174, 0221, 0037, 0164, 
+  0337, 0142, 0152, 0237, 0166, 0261, 0105, 0360, 0103, 0355, 0324, 0246, 0266, 0164, 0033, 0207, 
+  0072, 0276, 0363, 0112, 0044, 0142, 0105, 0145, 0133, 0372, 0034, 0127, 0274, 0065, 0175, 0302, 
+  0156, 0332, 0054, 0243, 0105, 0167, 0064, 0143, 0212, 0127, 0000, 0164, 0303, 0300, 0026, 0166, 
+  0165, 0106, 0135, 0304, 0007, 0313, 0227, 0272, 0206, 0074, 0156, 0241, 0353, 0026, 0337, 0054, 
+  0261, 0330, 0330, 0254, 0241, 0061, 0065, 0311, 0003, 0301, 0256, 0240, 0220, 0213, 0057, 0367, 
+  0347, 0335, 0353, 0376, 0155, 0367, 0353, 0375, 0267, 0126, 0357, 0313, 0062, 0165, 0246, 0322, 
+  0140, 0054, 0113, 0134, 0174, 0020, 0115, 0224, 0065, 0104, 0314, 0117, 0265, 0157, 0072, 0261, 
+  0333, 0046, 0141, 0301, 0057, 0323, 0136, 0124, 0010, 0123, 0225, 0065, 0054, 0057, 0163, 0364, 
+  0310, 0072, 0014, 0217, 0127, 0107, 0327, 0303, 0206, 0357, 0022, 0066, 0331, 0064, 0307, 0216, 
+  0147, 0142, 0367, 0323, 0041, 0222, 0350, 0162, 0370, 0121, 0264, 0351, 0333, 0234, 0260, 0054, 
+  0142, 0047, 0215, 0171, 0205, 0244, 0274, 0071, 0111, 0351, 0006, 0043, 0117, 0072, 0303, 0222, 
+  0064, 0225, 0052, 0101, 0263, 0154, 0314, 0231, 0157, 0131, 0144, 0211, 0275, 0125, 0155, 0137, 
+  0246, 0043, 0054, 0165, 0123, 0006, 0325, 0332, 0224, 0163, 0335, 0033, 0125, 0170, 0107, 0304, 
+  0360, 0112, 0335, 0016, 0143, 0023, 0333, 0321, 0303, 0216, 0036, 0214, 0341, 0165, 0137, 0326, 
+  0272, 0003, 0245, 0020, 0122, 0353, 0246, 0123, 0135, 0072, 0152, 0335, 0334, 0167, 0112, 0045, 
+  0043, 0122, 0055, 0124, 0213, 0113, 0265, 0052, 0214, 0352, 0205, 0073, 0277, 0112, 0335, 0025, 
+  0247, 0370, 0135, 0121, 0321, 0227, 0304, 0271, 0234, 0352, 0352, 0113, 0263, 0321, 0135, 0021, 
+  0217, 0057, 0130, 0205, 0325, 0245, 0140, 0200, 0367, 0356, 0244, 0124, 0122, 0161, 0253, 0001, 
+  0340, 0331, 0246, 0364, 0135, 0156, 0116, 0124, 0167, 0113, 0332, 0057, 0016, 0165, 0031, 0272, 
+  0017, 0206, 0131, 0352, 0276, 0260, 0152, 0355, 0313, 0005, 0321, 0207, 0066, 0365, 0030, 0061, 
+  0274, 0352, 0356, 0316, 0065, 0146, 0317, 0324, 0175, 0104, 0367, 0013, 0243, 0055, 0165, 0223, 
+  0206, 0240, 0104, 0025, 0103, 0136, 0377, 0362, 0011, 0253, 0260, 0334, 0026, 0303, 0053, 0225, 
+  0220, 0376, 0330, 0254, 0300, 0276, 0302, 0226, 0123, 0135, 0201, 0075, 0033, 0335, 0324, 0275, 
+  0125, 0141, 0201, 0115, 0331, 0175, 0234, 0227, 0266, 0060, 0122, 0171, 0254, 0206, 0140, 0230, 
+  0155, 0112, 0153, 0100, 0375, 0052, 0103, 0067, 0030, 0137, 0251, 0033, 0242, 0257, 0033, 0273, 
+  0055, 0307, 0261, 0210, 0241, 0063, 0102, 0355, 0260, 0044, 0305, 0174, 0127, 0246, 0177, 0027, 
+  0013, 0143, 0231, 0327, 0247, 0256, 0156, 0355, 0231, 0230, 0154, 0124, 0073, 0375, 0365, 0343, 
+  0211, 0154, 0213, 0121, 0130, 0012, 0343, 0364, 0327, 0146, 0152, 0023, 0142, 0010, 0057, 0132, 
+  0217, 0211, 0173, 0131, 0065, 0361, 0307, 0241, 0143, 0017, 0323, 0032, 0005, 0001, 0244, 0061, 
+  0247, 0324, 0040, 0340, 0225, 0211, 0045, 0365, 0014, 0227, 0132, 0026, 0066, 0227, 0126, 0267, 
+  0150, 0142, 0227, 0155, 0262, 0224, 0233, 0106, 0354, 0370, 0100, 0130, 0162, 0330, 0345, 0073, 
+  0301, 0317, 0102, 0227, 0335, 0150, 0370, 0053, 0072, 0244, 0260, 0134, 0027, 0244, 0021, 0127, 
+  0027, 0104, 0272, 0066, 0310, 0346, 0022, 0007, 0024, 0122, 0003, 0317, 0350, 0313, 0066, 0044, 
+  0006, 0122, 0227, 0140, 0233, 0005, 0274, 0247, 0166, 0372, 0304, 0037, 0160, 0106, 0224, 0236, 
+  0240, 0027, 0273, 0016, 0321, 0153, 0161, 0213, 0237, 0260, 0316, 0171, 0354, 0234, 0257, 0005, 
+  0167, 0061, 0277, 0376, 0034, 0327, 0123, 0316, 0265, 0052, 0142, 0275, 0042, 0363, 0011, 0204, 
+  0130, 0042, 0142, 0311, 0246, 0250, 0365, 0054, 0142, 0162, 0141, 0343, 0344, 0354, 0314, 0364, 
+  0335, 0351, 0106, 0034, 0327, 0353, 0131, 0372, 0162, 0203, 0005, 0325, 0202, 0335, 0121, 0130, 
+  0242, 0304, 0335, 0214, 0100, 0360, 0361, 0014, 0301, 0215, 0010, 0004, 0113, 0240, 0171, 0231, 
+  0012, 0142, 0000, 0136, 0050, 0025, 0024, 0105, 0011, 0221, 0203, 0231, 0046, 0044, 0313, 0044, 
+  0247, 0046, 0324, 0263, 0300, 0057, 0216, 0156, 0233, 0212, 0123, 0112, 0335, 0271, 0054, 0311, 
+  0336, 0245, 0254, 0176, 0221, 0073, 0220, 0253, 0036, 0110, 0051, 0033, 0221, 0063, 0135, 0135, 
+  0051, 0175, 0075, 0051, 0217, 0040, 0073, 0221, 0250, 0012, 0261, 0322, 0210, 0244, 0150, 0102, 
+  0051, 0114, 0350, 0145, 0137, 0327, 0244, 0144, 0245, 0200, 0027, 0136, 0343, 0347, 0237, 0324, 
+  0175, 0354, 0223, 0061, 0116, 0072, 0121, 0120, 0372, 0272, 0227, 0261, 0366, 0111, 0140, 0125, 
+  0143, 0231, 0111, 0075, 0216, 0165, 0167, 0110, 0154, 0055, 0100, 0177, 0112, 0201, 0034, 0305, 
+  0056, 0261, 0340, 0005, 0205, 0164, 0230, 0344, 0347, 0174, 0106, 0202, 0000, 0220, 0240, 0000, 
+  0365, 0117, 0305, 0037, 0171, 0210, 0033, 0130, 0134, 0322, 0250, 0354, 0124, 0146, 0074, 0262, 
+  0060, 0212, 0170, 0040, 0226, 0125, 0034, 0315, 0072, 0064, 0324, 0250, 0024, 0331, 0156, 0142, 
+  0036, 0153, 0374, 0353, 0012, 0174, 0240, 0110, 0236, 0361, 0023, 0330, 0105, 0011, 0120, 0254, 
+  0327, 0377, 0121, 0257, 0027, 0361, 0011, 0245, 0103, 0113, 0200, 0152, 0045, 0124, 0067, 0252, 
+  0204, 0152, 0371, 0175, 0222, 0354, 0124, 0266, 0103, 0371, 0015, 0317, 0176, 0140, 0255, 0240, 
+  0223, 0110, 0031, 0167, 0103, 0152, 0301, 0300, 0010, 0132, 0141, 0224, 0134, 0147, 0001, 0023, 
+  0010, 0114, 0240, 0155, 0062, 0201, 0276, 0351, 0356, 0043, 0146, 0101, 0011, 0116, 0320, 0151, 
+  0366, 0320, 0004, 0012, 0367, 0037, 0005, 0004, 0340, 0241, 0216, 0015, 0372, 0022, 0130, 0101, 
+  0022, 0154, 0043, 0260, 0201, 0270, 0066, 0003, 0074, 0243, 0014, 0073, 0010, 0114, 0041, 0060, 
+  0205, 0366, 0311, 0024, 0152, 0356, 0207, 0051, 0024, 0177, 0304, 0057, 0303, 0127, 0323, 0267, 
+  0050, 0245, 0223, 0264, 0016, 0322, 0367, 0066, 0067, 0170, 0363, 0201, 0065, 0227, 0334, 0115, 
+  0331, 0376, 0304, 0265, 0313, 0037, 0206, 0357, 0330, 0046, 0061, 0260, 0007, 0201, 0370, 0274, 
+  0201, 0370, 0164, 0230, 0310, 0047, 0041, 0155, 0042, 0002, 0236, 0247, 0233, 0142, 0002, 0340, 
+  0117, 0136, 0260, 0036, 0003, 0335, 0325, 0034, 0152, 0021, 0203, 0253, 0013, 0066, 0047, 0113, 
+  0267, 0354, 0130, 0170, 0114, 0336, 0324, 0326, 0372, 0200, 0236, 0062, 0053, 0211, 0340, 0162, 
+  0051, 0327, 0345, 0362, 0224, 0113, 0175, 0257, 0244, 0003, 0347, 0365, 0350, 0302, 0156, 0231, 
+  0136, 0140, 0157, 0354, 0250, 0053, 0141, 0071, 0217, 0355, 0243, 0154, 0036, 0133, 0062, 0010, 
+  0226, 0163, 0332, 0246, 0052, 0125, 0130, 0157, 0107, 0042, 0267, 0155, 0353, 0275, 0022, 0323, 
+  0133, 0357, 0106, 0164, 0114, 0207, 0330, 0306, 0124, 0125, 0235, 0310, 0276, 0235, 0251, 0336, 
+  0241, 0013, 0372, 0254, 0352, 0030, 0052, 0145, 0033, 0312, 0332, 0212, 0162, 0234, 0104, 0152, 
+  0216, 0042, 0276, 0306, 0105, 0175, 0044, 0267, 0237, 0050, 0013, 0357, 0316, 0306, 0277, 0213, 
+  0215, 0252, 0226, 0340, 0126, 0310, 0301, 0200, 0225, 0231, 0160, 0011, 0310, 0275, 0326, 0075, 
+  0123, 0377, 0003, 0300, 0133, 0062, 0170, 0303, 0145, 0006, 0374, 0052, 0126, 0110, 0004, 0374, 
+  0246, 0341, 0267, 0167, 0003, 0330, 0055, 0031, 0273, 0275, 0277, 0352, 0143, 0347, 0267, 0033, 
+  0164, 0122, 0257, 0157, 0065, 0322, 0232, 0200, 0264, 0074, 0110, 0073, 0043, 0314, 0240, 0304, 
+  0006, 0270, 0225, 0014, 0267, 0351, 0072, 0157, 0065, 0324, 0216, 0001, 0152, 0171, 0240, 0366, 
+  0271, 0007, 0050, 0053, 0031, 0145, 0237, 0251, 0145, 0036, 0365, 0210, 0365, 0264, 0345, 0352, 
+  0343, 0007, 0100, 0132, 0056, 0244, 0161, 0062, 0000, 0254, 0255, 0001, 0153, 0133, 0015, 0262, 
+  0367, 0000, 0262, 0134, 0066, 0132, 0300, 0146, 0001, 0146, 0145, 0333, 0151, 0333, 0057, 0315, 
+  0116, 0366, 0012, 0150, 0020, 0375, 0333, 0216, 0154, 0103, 0010, 0137, 0003, 0001, 0253, 0022, 
+  0160, 0023, 0302, 0327, 0122, 0341, 0353, 0357, 0342, 0042, 0021, 0210, 0136, 0157, 0072, 0172, 
+  0315, 0167, 0003, 0277, 0004, 0173, 0001, 0032, 0132, 0171, 0032, 0332, 0361, 0361, 0273, 0223, 
+  0343, 0017, 0207, 0037, 0353, 0007, 0307, 0315, 0367, 0047, 0307, 0357, 0117, 0040, 0040, 0006, 
+  0001, 0355, 0122, 0002, 0332, 0200, 0347, 0165, 0340, 0271, 0321, 0170, 0327, 0370, 0373, 0207, 
+  0303, 0146, 0023, 0160, 0014, 0201, 0355, 0302, 0003, 0333, 0200, 0341, 0265, 0310, 0344, 0167, 
+  0177, 0077, 0371, 0170, 0330, 0004, 0121, 0014, 0021, 0363, 0222, 0042, 0346, 0000, 0341, 0222, 
+  0041, 0374, 0153, 0035, 0300, 0013, 0061, 0370, 0302, 0143, 0360, 0200, 0133, 0300, 0355, 0006, 
+  0160, 0013, 0021, 0375, 0174, 0270, 0245, 0226, 0011, 0310, 0005, 0344, 0156, 0000, 0271, 0220, 
+  0046, 0220, 0317, 0342, 0015, 0342, 0327, 0200, 0135, 0300, 0356, 0006, 0260, 0013, 0231, 0007, 
+  0305, 0056, 0370, 0326, 0006, 0156, 0217, 0241, 0316, 0021, 0124, 0343, 0311, 0127, 0215, 0247, 
+  0121, 0146, 0065, 0236, 0244, 0165, 0113, 0136, 0263, 0174, 0121, 0267, 0034, 0174, 0056, 0141, 
+  0262, 0261, 0023, 0125, 0271, 0001, 0111, 0252, 0300, 0115, 0131, 0227, 0041, 0145, 0151, 0256, 
+  0124, 0367, 0166, 0145, 0340, 0171, 0032, 0217, 0211, 0110, 0353, 0340, 0322, 0332, 0236, 0337, 
+  0237, 0326, 0120, 0336, 0173, 0361, 0247, 0076, 0324, 0031, 0326, 0154, 0235, 0371, 0256, 0156, 
+  0275, 0366, 0045, 0065, 0046, 0305, 0152, 0122, 0175, 0027, 0143, 0121, 0074, 0147, 0236, 0073, 
+  0362, 0372, 0313, 0146, 0312, 0110, 0145, 0355, 0302, 0305, 0324, 0065, 0261, 0253, 0347, 0032, 
+  0307, 0210, 0162, 0045, 0131, 0363, 0260, 0305, 0027, 0051, 0340, 0066, 0131, 0073, 0302, 0266, 
+  0030, 0210, 0066, 0164, 0211, 0251, 0211, 0233, 0013, 0371, 0304, 0006, 0224, 0215, 0162, 0164, 
+  0305, 0370, 0266, 0314, 0272, 0312, 0072, 0252, 0331, 0105, 0210, 0032, 0265, 0065, 0217, 0263, 
+  0014, 0336, 0255, 0141, 0021, 0343, 0121, 0365, 0226, 0051, 0104, 0204, 0112, 0152, 0317, 0056, 
+  0251, 0372, 0124, 0133, 0130, 0061, 0245, 0352, 0131, 0202, 0326, 0172, 0257, 0155, 0217, 0112, 
+  0222, 0167, 0133, 0306, 0360, 0033, 0153, 0145, 0370, 0061, 0227, 0202, 0065, 0143, 0262, 0321, 
+  0244, 0257, 0366, 0053, 0123, 0054, 0144, 0272, 0043, 0157, 0132, 0006, 0231, 0303, 0220, 0321, 
+  0261, 0204, 0115, 0262, 0302, 0140, 0350, 0263, 0172, 0202, 0131, 0121, 0211, 0152, 0252, 0154, 
+  0375, 0306, 0245, 0103, 0027, 0173, 0336, 0231, 0076, 0255, 0023, 0270, 0370, 0303, 0226, 0325, 
+  0007, 0124, 0267, 0341, 0127, 0104, 0252, 0317, 0077, 0255, 0171, 0014, 0073, 0034, 0232, 0207, 
+  0315, 0114, 0267, 0362, 0061, 0374, 0302, 0042, 0115, 0376, 0113, 0142, 0353, 0266, 0101, 0164, 
+  0013, 0235, 0133, 0242, 0230, 0127, 0226, 0316, 0203, 0333, 0120, 0203, 0057, 0110, 0256, 0164, 
+  0361, 0012, 0276, 0172, 0172, 0111, 0116, 0343, 0174, 0235, 0065, 0063, 0317, 0174, 0016, 0172, 
+  0073, 0104, 0302, 0045, 0146, 0306, 0350, 0202, 0157, 0341, 0131, 0377, 0172, 0353, 0164, 0034, 
+  0003, 0223, 0047, 0354, 0151, 0323, 0133, 0172, 0263, 0367, 0304, 0050, 0265, 0030, 0161, 0264, 
+  0130, 0252, 0276, 0240, 0317, 0266, 0105, 0165, 0023, 0231, 0374, 0147, 0364, 0340, 0322, 0061, 
+  0342, 0204, 0156, 0217, 0374, 0301, 0041, 0241, 0210, 0253, 0310, 0350, 0247, 0076, 0242, 0364, 
+  0057, 0050, 0044, 0377, 0015, 0001, 0373, 0111, 0355, 0252, 0214, 0054, 0005, 0076, 0027, 0174, 
+  0250, 0163, 0312, 0141, 0122, 0047, 0365, 0053, 0175, 0341, 0145, 0302, 0211, 0102, 0314, 0220, 
+  0230, 0145, 0326, 0236, 0063, 0172, 0056, 0177, 0347, 0274, 0303, 0045, 0003, 0237, 0141, 0057, 
+  0325, 0321, 0362, 0372, 0352, 0314, 0271, 0300, 0255, 0056, 0016, 0012, 0317, 0250, 0241, 0047, 
+  0341, 0342, 0376, 0124, 0353, 0276, 0114, 0270, 0200, 0325, 0172, 0174, 0166, 0250, 0121, 0257, 
+  0245, 0126, 0110, 0226, 0373, 0170, 0156, 0307, 0114, 0324, 0115, 0345, 0346, 0374, 0246, 0362, 
+  0100, 0033, 0307, 0246, 0344, 0105, 0345, 0333, 0046, 0024, 0032, 0033, 0025, 0012, 0351, 0365, 
+  0262, 0241, 0367, 0014, 0275, 0127, 0321, 0202, 0152, 0026, 0155, 0101, 0105, 0117, 0062, 0342, 
+  0345, 0325, 0027, 0337, 0274, 0264, 0374, 0302, 0322, 0303, 0251, 0155, 0055, 0052, 0365, 0362, 
+  0351, 0020, 0146, 0341, 0301, 0202, 0262, 0276, 0052, 0231, 0302, 0342, 0224, 0257, 0032, 0276, 
+  0360, 0335, 0314, 0177, 0212, 0277, 0251, 0076, 0125, 0012, 0145, 0221, 0070, 0221, 0012, 0255, 
+  0041, 0256, 0201, 0321, 0006, 0241, 0356, 0025, 0377, 0271, 0225, 0151, 0057, 0211, 0325, 0070, 
+  0211, 0234, 0174, 0327, 0275, 0224, 0250, 0315, 0052, 0132, 0345, 0105, 0351, 0253, 0155, 0340, 
+  0305, 0366, 0025, 0057, 0170, 0162, 0113, 0271, 0070, 0251, 0226, 0112, 0244, 0121, 0034, 0143, 
+  0165, 0037, 0276, 0141, 0333, 0137, 0124, 0254, 0005, 0001, 0136, 0022, 0013, 0007, 0277, 0257, 
+  0350, 0326, 0105, 0357, 0220, 0112, 0263, 0240, 0211, 0160, 0172, 0115, 0275, 0135, 0112, 0273, 
+  0253, 0246, 0164, 0257, 0266, 0346, 0106, 0341, 0103, 0162, 0345, 0355, 0325, 0140, 0207, 0343, 
+  0073, 0342, 0062, 0245, 0371, 0172, 0312, 0066, 0365, 0071, 0340, 0170, 0163, 0341, 0306, 0114, 
+  0233, 0146, 0064, 0243, 0213, 0227, 0005, 0221, 0254, 0161, 0125, 0233, 0171, 0310, 0243, 0315, 
+  0224, 0110, 0231, 0155, 0223, 0060, 0240, 0314, 0342, 0050, 0163, 0266, 0236, 0153, 0243, 0314, 
+  0225, 0135, 0356, 0214, 0365, 0141, 0124, 0062, 0113, 0146, 0263, 0053, 0217, 0251, 0365, 0266, 
+  0055, 0061, 0370, 0246, 0332, 0301, 0255, 0224, 0026, 0361, 0270, 0136, 0143, 0232, 0252, 0315, 
+  0357, 0075, 0362, 0047, 0116, 0324, 0232, 0245, 0325, 0222, 0050, 0240, 0342, 0142, 0201, 0032, 
+  0247, 0355, 0051, 0107, 0162, 0043, 0264, 0263, 0302, 0230, 0300, 0025, 0266, 0034, 0140, 0002, 
+  0305, 0061, 0201, 0331, 0172, 0002, 0023, 0110, 0143, 0002, 0043, 0276, 0122, 0263, 0340, 0260, 
+  0127, 0061, 0116, 0060, 0332, 0064, 0047, 0150, 0146, 0345, 0004, 0261, 0326, 0324, 0342, 0203, 
+  0210, 0113, 0203, 0115, 0341, 0243, 0032, 0363, 0255, 0230, 0005, 0107, 0360, 0303, 0025, 0365, 
+  0135, 0157, 0341, 0301, 0264, 0313, 0267, 0004, 0354, 0070, 0202, 0164, 0077, 0276, 0035, 0360, 
+  0212, 0375, 0303, 0260, 0243, 0021, 0333, 0160, 0161, 0330, 0131, 0043, 0255, 0201, 0303, 0311, 
+  0170, 0261, 0301, 0207, 0067, 0006, 0160, 0362, 0204, 0004, 0006, 0347, 0123, 0011, 0376, 0212, 
+  0376, 0114, 0042, 0014, 0124, 0111, 0177, 0031, 0243, 0321, 0243, 0352, 0060, 0074, 0136, 0036, 
+  0131, 0160, 0071, 0350, 0246, 0355, 0323, 0170, 0223, 0355, 0076, 0030, 0237, 0114, 0037, 0202, 
+  0231, 0371, 0066, 0127, 0224, 0105, 0124, 0076, 0141, 0270, 0053, 0170, 0063, 0346, 0170, 0233, 
+  0105, 0344, 0045, 0001, 0227, 0221, 0336, 0247, 0271, 0073, 0257, 0333, 0260, 0224, 0313, 0243, 
+  0274, 0353, 0021, 0357, 0047, 0312, 0236, 0125, 0231, 0303, 0331, 0131, 0230, 0247, 0041, 0365, 
+  0001, 0156, 0361, 0062, 0227, 0116, 0264, 0147, 0302, 0106, 0232, 0243, 0273, 0001, 0076, 0144, 
+  0076, 0044, 0130, 0147, 0355, 0264, 0307, 0250, 0361, 0350, 0151, 0342, 0217, 0103, 0307, 0036, 
+  0246, 0042, 0367, 0221, 0070, 0232, 0100, 0243, 0253, 0215, 0110, 0354, 0227, 0226, 0051, 0177, 
+  0071, 0206, 0336, 0234, 0305, 0320, 0077, 0056, 0304, 0320, 0123, 0343, 0346, 0033, 0201, 0301, 
+  0362, 0155, 0303, 0047, 0012, 0115, 0202, 0333, 0204, 0125, 0032, 0060, 0352, 0250, 0065, 0110, 
+  0014, 0324, 0107, 0005, 0347, 0075, 0056, 0055, 0270, 0260, 0340, 0342, 0244, 0056, 0265, 0136, 
+  0012, 0241, 0170, 0031, 0175, 0163, 0121, 0327, 0024, 0040, 0013, 0350, 0256, 0067, 0031, 0017, 
+  0250, 0165, 0347, 0230, 0034, 0343, 0325, 0122, 0072, 0127, 0365, 0106, 0045, 0265, 0123, 0076, 
+  0200, 0350, 0005, 0113, 0200, 0204, 0025, 0024, 0306, 0021, 0303, 0042, 0032, 0175, 0127, 0270, 
+  0052, 0017, 0015, 0072, 0226, 0375, 0244, 0134, 0270, 0060, 0123, 0072, 0140, 0246, 0064, 0100, 
+  0131, 0025, 0065, 0056, 0124, 0130, 0011, 0025, 0065, 0071, 0014, 0030, 0222, 0157, 0262, 0276, 
+  0232, 0034, 0071, 0053, 0044, 0124, 0227, 0024, 0236, 0313, 0245, 0371, 0172, 0233, 0321, 0174, 
+  0345, 0302, 0152, 0111, 0021, 0216, 0223, 0162, 0155, 0347, 0055, 0162, 0261, 0007, 0154, 0166, 
+  0112, 0250, 0350, 0053, 0147, 0062, 0325, 0366, 0264, 0147, 0042, 0221, 0072, 0220, 0110, 0056, 
+  0022, 0031, 0321, 0147, 0064, 0055, 0211, 0007, 0324, 0221, 0170, 0234, 0262, 0050, 0352, 0350, 
+  0161, 0145, 0235, 0177, 0146, 0256, 0014, 0215, 0202, 0062, 0170, 0142, 0007, 0246, 0217, 0252, 
+  0243, 0011, 0245, 0252, 0062, 0122, 0364, 0123, 0210, 0262, 0022, 0230, 0203, 0151, 0263, 0136, 
+  0221, 0142, 0057, 0231, 0355, 0311, 0115, 0213, 0261, 0015, 0120, 0041, 0067, 0357, 0271, 0071, 
+  0270, 0245, 0104, 0030, 0016, 0276, 0212, 0064, 0370, 0347, 0326, 0322, 0340, 0061, 0310, 0111, 
+  0005, 0022, 0333, 0063, 0061, 0011, 0304, 0061, 0043, 0216, 0300, 0077, 0216, 0350, 0003, 0012, 
+  0235, 0031, 0100, 0041, 0311, 0271, 0146, 0205, 0211, 0060, 0207, 0330, 0157, 0075, 0113, 0301, 
+  0126, 0004, 0017, 0126, 0256, 0130, 0257, 0264, 0010, 0223, 0046, 0241, 0102, 0344, 0330, 0123, 
+  0246, 0126, 0143, 0375, 0105, 0263, 0260, 0075, 0144, 0112, 0342, 0044, 0156, 0306, 0322, 0075, 
+  0274, 0114, 0007, 0133, 0077, 0074, 0221, 0337, 0045, 0307, 0323, 0004, 0263, 0326, 0236, 0165, 
+  0327, 0016, 0034, 0237, 0112, 0120, 0047, 0266, 0343, 0063, 0315, 0361, 0135, 0047, 0210, 0307, 
+  0330, 0376, 0170, 0240, 0240, 0044, 0054, 0004, 0312, 0042, 0242, 0147, 0322, 0163, 0260, 0310, 
+  0170, 0240, 0271, 0102, 0131, 0220, 0137, 0053, 0317, 0326, 0071, 0221, 0121, 0215, 0021, 0056, 
+  0250, 0324, 0110, 0224, 0117, 0022, 0273, 0304, 0120, 0153, 0364, 0354, 0352, 0216, 0132, 0013, 
+  0077, 0240, 0157, 0315, 0241, 0026, 0061, 0046, 0265, 0123, 0362, 0240, 0011, 0142, 0064, 0025, 
+  0050, 0327, 0307, 0011, 0371, 0021, 0233, 0323, 0225, 0112, 0146, 0166, 0347, 0164, 0074, 0240, 
+  0234, 0251, 0365, 0003, 0074, 0315, 0330, 0335, 0235, 0163, 0203, 0335, 0157, 0304, 0236, 0075, 
+  0255, 0222, 0274, 0114, 0345, 0171, 0123, 0126, 0207, 0370, 0024, 0020, 0237, 0003, 0227, 0134, 
+  0125, 0344, 0172, 0101, 0110, 0016, 0153, 0134, 0137, 0347, 0353, 0106, 0306, 0143, 0154, 0022, 
+  0135, 0176, 0244, 0063, 0213, 0241, 0256, 0224, 0101, 0242, 0075, 0220, 0027, 0154, 0152, 0317, 
+  0304, 0024, 0274, 0066, 0171, 0325, 0011, 0303, 0343, 0125, 0165, 0102, 0374, 0032, 0265, 0346, 
+  0174, 0034, 0342, 0221, 0364, 0373, 0015, 0305, 0367, 0233, 0212, 0357, 0037, 0053, 0276, 0377, 
+  0136, 0361, 0375, 0023, 0305, 0367, 0077, 0104, 0275, 0037, 0376, 0346, 0125, 0205, 0323, 0064, 
+  0100, 0361, 0126, 0347, 0040, 0173, 0246, 0172, 0003, 0215, 0274, 0006, 0133, 0261, 0101, 0306, 
+  0272, 0205, 0156, 0104, 0366, 0066, 0230, 0146, 0311, 0215, 0312, 0325, 0126, 0370, 0126, 0204, 
+  0273, 0260, 0225, 0352, 0212, 0044, 0041, 0201, 0252, 0122, 0220, 0252, 0122, 0210, 0052, 0121, 
+  0061, 0321, 0135, 0062, 0354, 0056, 0071, 0147, 0172, 0353, 0021, 0021, 0277, 0235, 0217, 0050, 
+  0067, 0144, 0335, 0252, 0147, 0331, 0024, 0352, 0121, 0071, 0037, 0351, 0366, 0020, 0043, 0066, 
+  0302, 0110, 0060, 0154, 0344, 0141, 0306, 0310, 0152, 0216, 0133, 0174, 0342, 0271, 0260, 0337, 
+  0103, 0216, 0336, 0224, 0227, 0102, 0366, 0320, 0017, 0222, 0256, 0271, 0064, 0360, 0245, 0171, 
+  0204, 0343, 0342, 0047, 0202, 0247, 0125, 0056, 0216, 0122, 0054, 0174, 0161, 0172, 0160, 0326, 
+  0200, 0163, 0007, 0167, 0242, 0312, 0347, 0202, 0143, 0204, 0021, 0053, 0126, 0231, 0250, 0303, 
+  0007, 0320, 0135, 0146, 0147, 0044, 0251, 0015, 0071, 0033, 0171, 0251, 0242, 0224, 0143, 0305, 
+  0160, 0206, 0270, 0012, 0370, 0020, 0362, 0015, 0273, 0330, 0256, 0274, 0142, 0237, 0367, 0224, 
+  0026, 0034, 0310, 0312, 0167, 0040, 0153, 0166, 0300, 0002, 0316, 0012, 0347, 0072, 0054, 0061, 
+  0077, 0113, 0323, 0303, 0206, 0357, 0022, 0106, 0260, 0127, 0315, 0023, 0065, 0323, 0361, 0115, 
+  0340, 0124, 0315, 0306, 0117, 0325, 0314, 0266, 0242, 0320, 0223, 0065, 0352, 0007, 0145, 0002, 
+  0206, 0063, 0263, 0123, 0217, 0117, 0352, 0262, 0055, 0146, 0025, 0146, 0233, 0365, 0372, 0366, 
+  0237, 0306, 0131, 0075, 0231, 0261, 0344, 0204, 0331, 0344, 0101, 0033, 0245, 0063, 0055, 0324, 
+  0025, 0345, 0004, 0365, 0360, 0210, 0044, 0147, 0322, 0214, 0030, 0272, 0045, 0245, 0070, 0315, 
+  0016, 0302, 0234, 0144, 0075, 0313, 0322, 0343, 0352, 0350, 0343, 0062, 0145, 0207, 0077, 0125, 
+  0110, 0143, 0222, 0255, 0347, 0271, 0242, 0157, 0013, 0356, 0024, 0034, 0074, 0325, 0114, 0337, 
+  0235, 0056, 0357, 0111, 0275, 0236, 0241, 0275, 0320, 0067, 0153, 0247, 0236, 0105, 0114, 0254, 
+  0005, 0312, 0277, 0053, 0140, 0044, 0037, 0200, 0147, 0330, 0165, 0250, 0045, 0102, 0305, 0341, 
+  0001, 0337, 0014, 0247, 0115, 0226, 0217, 0236, 0065, 0146, 0107, 0317, 0076, 0104, 0224, 0157, 
+  0225, 0056, 0335, 0132, 0211, 0203, 0051, 0113, 0047, 0272, 0116, 0124, 0133, 0052, 0025, 0130, 
+  0055, 0242, 0110, 0253, 0112, 0111, 0365, 0244, 0332, 0201, 0225, 0052, 0231, 0233, 0220, 0052, 
+  0030, 0234, 0267, 0110, 0355, 0057, 0275, 0252, 0136, 0141, 0245, 0374, 0322, 0112, 0370, 0101, 
+  0151, 0377, 0025, 0072, 0154, 0007, 0236, 0265, 0145, 0056, 0037, 0354, 0153, 0360, 0140, 0065, 
+  0164, 0121, 0066, 0215, 0146, 0151, 0236, 0236, 0067, 0035, 0234, 0017, 0362, 0344, 0350, 0065, 
+  0127, 0201, 0322, 0154, 0361, 0015, 0251, 0104, 0064, 0145, 0052, 0223, 0310, 0047, 0213, 0265, 
+  0046, 0347, 0126, 0135, 0374, 0252, 0376, 0370, 0367, 0317, 0377, 0122, 0355, 0370, 0115, 0302, 
+  0231, 0156, 0071, 0043, 0075, 0015, 0000, 0373, 0136, 0235, 0175, 0047, 0145, 0307, 0210, 0133, 
+  0015, 0036, 0310, 0216, 0212, 0325, 0270, 0314, 0057, 0073, 0202, 0175, 0335, 0045, 0331, 0161, 
+  0035, 0344, 0304, 0212, 0214, 0145, 0117, 0216, 0146, 0101, 0176, 0110, 0312, 0217, 0274, 0053, 
+  0373, 0106, 0226, 0230, 0144, 0110, 0230, 0267, 0175, 0302, 0344, 0030, 0204, 0111, 0116, 0141, 
+  0162, 0116, 0075, 0006, 0242, 0044, 0037, 0025, 0276, 0257, 0234, 0050, 0021, 0273, 0272, 0113, 
+  0202, 0104, 0314, 0007, 0361, 0026, 0041, 0267, 0003, 0061, 0122, 0224, 0030, 0311, 0267, 0256, 
+  0073, 0042, 0104, 0116, 0326, 0123, 0355, 0074, 0151, 0202, 0053, 0347, 0154, 0202, 0232, 0207, 
+  0212, 0065, 0117, 0143, 0223, 0166, 0116, 0133, 0111, 0035, 0305, 0314, 0057, 0072, 0004, 0051, 
+  0131, 0262, 0047, 0232, 0355, 0124, 0302, 0057, 0052, 0035, 0025, 0210, 0345, 0046, 0345, 0272, 
+  0065, 0043, 0302, 0141, 0025, 0125, 0063, 0212, 0303, 0262, 0322, 0345, 0250, 0331, 0057, 0106, 
+  0215, 0057, 0240, 0271, 0141, 0107, 0342, 0152, 0046, 0364, 0134, 0220, 0107, 0046, 0101, 0127, 
+  0122, 0311, 0114, 0167, 0045, 0006, 0067, 0025, 0042, 0035, 0171, 0323, 0331, 0155, 0223, 0040, 
+  0117, 0315, 0174, 0216, 0153, 0030, 0346, 0136, 0151, 0036, 0016, 0242, 0136, 0117, 0174, 0332, 
+  0265, 0123, 0152, 0253, 0323, 0252, 0132, 0036, 0165, 0162, 0076, 0165, 0152, 0236, 0164, 0304, 
+  0126, 0105, 0345, 0131, 0307, 0346, 0117, 0357, 0040, 0217, 0150, 0124, 0125, 0115, 0160, 0361, 
+  0230, 0076, 0341, 0142, 0064, 0205, 0133, 0345, 0276, 0244, 0026, 0110, 0136, 0307, 0310, 0236, 
+  0075, 0052, 0105, 0040, 0352, 0204, 0241, 0054, 0064, 0212, 0112, 0101, 0136, 0314, 0321, 0237, 
+  0211, 0203, 0356, 0143, 0265, 0322, 0363, 0123, 0153, 0327, 0306, 0163, 0362, 0314, 0371, 0175, 
+  0345, 0036, 0010, 0240, 0343, 0061, 0141, 0050, 0074, 0027, 0120, 0311, 0363, 0073, 0120, 0132, 
+  0263, 0166, 0332, 0375, 0262, 0263, 0025, 0065, 0151, 0276, 0313, 0354, 0022, 0073, 0134, 0153, 
+  0141, 0251, 0265, 0263, 0343, 0006, 0344, 0376, 0257, 0047, 0367, 0077, 0310, 0144, 0013, 0013, 
+  0300, 0141, 0267, 0112, 0031, 0155, 0322, 0226, 0371, 0352, 0155, 0003, 0101, 0156, 0336, 0122, 
+  0252, 0236, 0154, 0361, 0020, 0310, 0332, 0337, 0154, 0326, 0376, 0162, 0222, 0071, 0344, 0356, 
+  0113, 0247, 0144, 0163, 0253, 0115, 0350, 0035, 0017, 0174, 0036, 0247, 0007, 0377, 0037, 0077, 
+  0221, 0033, 0200, 0000, 0050, 0165, 0165, 0141, 0171, 0051
 } };
 
 static GStaticResource static_resource = { resources_resource_data.data, sizeof (resources_resource_data.data) - 1 /* nul terminator */, NULL, NULL, NULL };
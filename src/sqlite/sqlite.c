@@ -290,10 +290,11 @@ static void error_msg(sqlite3 *db) {
 
 static void sqlite_run_cmd(GMutex *mutex, const gchar *db_path, gint (*func)(),
                            void *data, const gchar *cmd) {
-  g_mutex_lock(mutex);
+  MutexLock(mutex);
 
   gchar *err_msg = 0;
   sqlite3 *db;
+  gint64 start = g_get_monotonic_time();
 
   /* Open the sqlite database file. */
   if (sqlite3_open(db_path, &db) != SQLITE_OK) {
@@ -314,6 +315,7 @@ static void sqlite_run_cmd(GMutex *mutex, const gchar *db_path, gint (*func)(),
   }
 
   g_mutex_unlock(mutex);
+  MetricsSqlite(g_get_monotonic_time() - start);
 }
 
 void SqliteProcessing(portfolio_packet *pkg) {
@@ -530,6 +532,7 @@ symbol_name_map *SqliteGetSNMap(meta *D) {
   sn_map->sn_container_arr = g_malloc(1);
   sn_map->size = 0;
   sn_map->hash_table = NULL;
+  sn_map->index = NULL;
 
   /* Run the command. */
   gchar *sql_cmd = "SELECT * FROM symbolname;";
@@ -0,0 +1,417 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <gio/gio.h>
+#include <glib/gprintf.h> /* g_fprintf() */
+#ifdef __GLIBC__
+#include <malloc.h> /* mallinfo2 () */
+#endif
+
+#include "../include/macros.h"
+#include "../include/multicurl.h" /* TelemetryPrometheus () */
+#include "../include/mutex.h"
+#include "../include/workfuncs.h"
+
+/* Session health metrics in the Prometheus text format, served on
+   127.0.0.1:$FINANCIALS_METRICS_PORT when that is set.  The hooks are cheap
+   enough to leave in place when it isn't; the per-host request counters
+   are telemetry.c's, the stage durations come from TraceEnd (). */
+
+#define METRICS_BUCKETS 11
+#define METRICS_STAGES 16
+#define METRICS_PROVIDERS 4
+
+/* Upper bounds in microseconds, the last bucket is unbounded. */
+static const gint64 bound_arr[METRICS_BUCKETS - 1] = {
+    1000, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000, 5000000};
+
+typedef struct {
+  guint64 count;
+  gint64 sum_us;
+  guint64 bucket_arr[METRICS_BUCKETS];
+} metrics_histogram;
+
+typedef struct {
+  const gchar *name; /* A string literal [a trace stage name]. */
+  metrics_histogram hist;
+} metrics_named;
+
+typedef struct {
+  const gchar *provider;
+  guint64 count;
+} metrics_counter;
+
+/* Guarded by METRICS_MUTEX, which is locked with g_mutex_lock () so the
+   lock wait accounting doesn't recurse. */
+static metrics_named stage_arr[METRICS_STAGES];
+static guint stage_count = 0;
+static metrics_histogram cycle_hist, sqlite_hist, idle_lag_hist;
+static guint64 cycle_failures = 0;
+static metrics_counter zero_quote_arr[METRICS_PROVIDERS];
+static guint64 lock_contended_arr[MUTEX_NUMBER];
+static gint64 lock_wait_us_arr[MUTEX_NUMBER];
+static gint64 idle_probe_posted = 0; /* 0 when no probe is queued. */
+
+static GSocketService *service = NULL;
+static guint idle_probe_id = 0;
+
+static const gchar *mutex_name_arr[MUTEX_NUMBER] = {
+    [CLASS_MEMBER_MUTEX] = "class_member",
+    [CLASS_CALCULATE_MUTEX] = "class_calculate",
+    [CLASS_EXTRACT_DATA_MUTEX] = "class_extract_data",
+    [CLASS_TOSTRINGS_MUTEX] = "class_tostrings",
+    [CLOCKS_HANDLER_MUTEX] = "clocks_handler",
+    [FETCH_DATA_MUTEX] = "fetch_data",
+    [FETCH_CYCLE_MUTEX] = "fetch_cycle",
+    [FETCH_DATA_HANDLER_MUTEX] = "fetch_data_handler",
+    [HISTORY_FETCH_MUTEX] = "history_fetch",
+    [MULTICURL_PROG_MUTEX] = "multicurl_prog",
+    [MULTICURL_NO_PROG_MUTEX] = "multicurl_no_prog",
+    [MULTICURL_REM_HAND_MUTEX] = "multicurl_rem_hand",
+    [MULTICURL_HEDGE_MUTEX] = "multicurl_hedge",
+    [HTTP_CACHE_MUTEX] = "http_cache",
+    [TELEMETRY_MUTEX] = "telemetry",
+    [TASK_POOL_MUTEX] = "task_pool",
+    [TIMER_WHEEL_MUTEX] = "timer_wheel",
+    [TRANSPORT_MUTEX] = "transport",
+    [DAEMON_MUTEX] = "daemon",
+    [QUOTE_BOARD_MUTEX] = "quote_board",
+    [METRICS_MUTEX] = "metrics",
+    [SYMBOL_NAME_MAP_SQLITE_MUTEX] = "symbol_name_map_sqlite",
+    [SYMBOL_NAME_INDEX_MUTEX] = "symbol_name_index",
+    [SQLITE_MUTEX] = "sqlite",
+};
+
+static void histogram_add(metrics_histogram *h, gint64 us) {
+  guint b = 0;
+  while (b < METRICS_BUCKETS - 1 && us > bound_arr[b])
+    b++;
+  h->bucket_arr[b]++;
+  h->count++;
+  h->sum_us += us;
+}
+
+void MutexLock(GMutex *mutex)
+/* g_mutex_lock () for the mutexes[] entries, the wait on a contended lock
+   is added to the entry's total. */
+{
+  if (g_mutex_trylock(mutex))
+    return;
+
+  gint64 start = g_get_monotonic_time();
+  g_mutex_lock(mutex);
+  gint64 wait = g_get_monotonic_time() - start;
+
+  if (mutex < mutexes || mutex >= mutexes + MUTEX_NUMBER)
+    return;
+  g_mutex_lock(&mutexes[METRICS_MUTEX]);
+  lock_contended_arr[mutex - mutexes]++;
+  lock_wait_us_arr[mutex - mutexes] += wait;
+  g_mutex_unlock(&mutexes[METRICS_MUTEX]);
+}
+
+void MetricsStage(const gchar *name, gint64 dur_us)
+/* name must be a string literal, stages past METRICS_STAGES are dropped. */
+{
+  g_mutex_lock(&mutexes[METRICS_MUTEX]);
+  guint s = 0;
+  while (s < stage_count && stage_arr[s].name != name &&
+         g_strcmp0(stage_arr[s].name, name) != 0)
+    s++;
+  if (s == stage_count && stage_count < METRICS_STAGES)
+    stage_arr[stage_count++].name = name;
+  if (s < stage_count)
+    histogram_add(&stage_arr[s].hist, dur_us);
+  g_mutex_unlock(&mutexes[METRICS_MUTEX]);
+}
+
+void MetricsFetchCycle(gint64 dur_us, gboolean failed) {
+  g_mutex_lock(&mutexes[METRICS_MUTEX]);
+  histogram_add(&cycle_hist, dur_us);
+  cycle_failures += failed ? 1 : 0;
+  g_mutex_unlock(&mutexes[METRICS_MUTEX]);
+}
+
+void MetricsZeroQuotes(const gchar *provider, guint n)
+/* n quotes from provider [a string literal] extracted as zero, a rate limit
+   or an unknown symbol. */
+{
+  if (n == 0)
+    return;
+
+  g_mutex_lock(&mutexes[METRICS_MUTEX]);
+  for (guint p = 0; p < METRICS_PROVIDERS; p++) {
+    if (zero_quote_arr[p].provider == NULL)
+      zero_quote_arr[p].provider = provider;
+    if (g_strcmp0(zero_quote_arr[p].provider, provider) == 0) {
+      zero_quote_arr[p].count += n;
+      break;
+    }
+  }
+  g_mutex_unlock(&mutexes[METRICS_MUTEX]);
+}
+
+void MetricsSqlite(gint64 dur_us) {
+  g_mutex_lock(&mutexes[METRICS_MUTEX]);
+  histogram_add(&sqlite_hist, dur_us);
+  g_mutex_unlock(&mutexes[METRICS_MUTEX]);
+}
+
+static gboolean idle_probe_run(gpointer data) {
+  UNUSED(data)
+  g_mutex_lock(&mutexes[METRICS_MUTEX]);
+  histogram_add(&idle_lag_hist, g_get_monotonic_time() - idle_probe_posted);
+  idle_probe_posted = 0;
+  g_mutex_unlock(&mutexes[METRICS_MUTEX]);
+  return G_SOURCE_REMOVE;
+}
+
+static gboolean idle_probe_post(gpointer data)
+/* GLib doesn't expose the idle queue's depth, its wait is measured instead:
+   once a second a probe joins the queue at the gdk_threads_add_idle ()
+   priority and records how long it waited behind the GUI updates. */
+{
+  UNUSED(data)
+  g_mutex_lock(&mutexes[METRICS_MUTEX]);
+  gboolean queued = idle_probe_posted != 0;
+  if (!queued)
+    idle_probe_posted = g_get_monotonic_time();
+  g_mutex_unlock(&mutexes[METRICS_MUTEX]);
+
+  if (!queued)
+    g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, idle_probe_run, NULL, NULL);
+  return G_SOURCE_CONTINUE;
+}
+
+static void append_histogram(GString *out, const gchar *name,
+                             const gchar *labels, const metrics_histogram *h)
+/* labels is empty or 'key="value",' */
+{
+  guint64 cumulative = 0;
+  for (guint b = 0; b < METRICS_BUCKETS; b++) {
+    cumulative += h->bucket_arr[b];
+    if (b < METRICS_BUCKETS - 1)
+      g_string_append_printf(out, "%s_bucket{%sle=\"%g\"} %" G_GUINT64_FORMAT
+                                  "\n",
+                             name, labels, (gdouble)bound_arr[b] / 1e6,
+                             cumulative);
+    else
+      g_string_append_printf(out, "%s_bucket{%sle=\"+Inf\"} %" G_GUINT64_FORMAT
+                                  "\n",
+                             name, labels, cumulative);
+  }
+  gchar *bare = g_strndup(labels, labels[0] ? strlen(labels) - 1 : 0);
+  const gchar *open = bare[0] ? "{" : "", *close = bare[0] ? "}" : "";
+  g_string_append_printf(out, "%s_sum%s%s%s %.6f\n", name, open, bare, close,
+                         (gdouble)h->sum_us / 1e6);
+  g_string_append_printf(out, "%s_count%s%s%s %" G_GUINT64_FORMAT "\n", name,
+                         open, bare, close, h->count);
+  g_free(bare);
+}
+
+static void append_help(GString *out, const gchar *name, const gchar *type,
+                        const gchar *help) {
+  g_string_append_printf(out, "# HELP %s %s\n# TYPE %s %s\n", name, help, name,
+                         type);
+}
+
+gchar *MetricsRender()
+/* The current metrics in the Prometheus text format.  Must free return
+   value. */
+{
+  GString *out = g_string_new(NULL);
+
+  g_mutex_lock(&mutexes[METRICS_MUTEX]);
+  append_help(out, "financials_fetch_cycles_total", "counter",
+              "Refresh cycles started.");
+  g_string_append_printf(out, "financials_fetch_cycles_total %" G_GUINT64_FORMAT
+                              "\n",
+                         cycle_hist.count);
+  append_help(out, "financials_fetch_cycle_failures_total", "counter",
+              "Refresh cycles with a failed transfer.");
+  g_string_append_printf(out,
+                         "financials_fetch_cycle_failures_total "
+                         "%" G_GUINT64_FORMAT "\n",
+                         cycle_failures);
+  append_help(out, "financials_fetch_cycle_seconds", "histogram",
+              "Refresh cycle duration, fetch through conversion.");
+  append_histogram(out, "financials_fetch_cycle_seconds", "", &cycle_hist);
+
+  append_help(out, "financials_stage_seconds", "histogram",
+              "Pipeline stage duration.");
+  for (guint s = 0; s < stage_count; s++) {
+    gchar *labels = g_strdup_printf("stage=\"%s\",", stage_arr[s].name);
+    append_histogram(out, "financials_stage_seconds", labels,
+                     &stage_arr[s].hist);
+    g_free(labels);
+  }
+
+  append_help(out, "financials_zero_quotes_total", "counter",
+              "Quotes extracted as zero, per provider.");
+  for (guint p = 0; p < METRICS_PROVIDERS && zero_quote_arr[p].provider; p++)
+    g_string_append_printf(out,
+                           "financials_zero_quotes_total{provider=\"%s\"} "
+                           "%" G_GUINT64_FORMAT "\n",
+                           zero_quote_arr[p].provider, zero_quote_arr[p].count);
+
+  append_help(out, "financials_sqlite_seconds", "histogram",
+              "SQLite open, statement, and close duration.");
+  append_histogram(out, "financials_sqlite_seconds", "", &sqlite_hist);
+
+  append_help(out, "financials_gtk_idle_wait_seconds", "histogram",
+              "Wait of a probe queued behind the GUI idle callbacks.");
+  append_histogram(out, "financials_gtk_idle_wait_seconds", "",
+                   &idle_lag_hist);
+
+  append_help(out, "financials_lock_contended_total", "counter",
+              "Lock acquisitions that had to wait, per mutex.");
+  for (guint m = 0; m < MUTEX_NUMBER; m++)
+    g_string_append_printf(out,
+                           "financials_lock_contended_total{mutex=\"%s\"} "
+                           "%" G_GUINT64_FORMAT "\n",
+                           mutex_name_arr[m], lock_contended_arr[m]);
+  append_help(out, "financials_lock_wait_seconds_total", "counter",
+              "Time spent waiting for a lock, per mutex.");
+  for (guint m = 0; m < MUTEX_NUMBER; m++)
+    g_string_append_printf(out,
+                           "financials_lock_wait_seconds_total{mutex=\"%s\"} "
+                           "%.6f\n",
+                           mutex_name_arr[m],
+                           (gdouble)lock_wait_us_arr[m] / 1e6);
+  g_mutex_unlock(&mutexes[METRICS_MUTEX]);
+
+#ifdef __GLIBC__
+  /* The allocator's state, scrape over time for the churn. */
+  struct mallinfo2 mi = mallinfo2();
+  append_help(out, "financials_heap_in_use_bytes", "gauge",
+              "malloc arena bytes in use.");
+  g_string_append_printf(out, "financials_heap_in_use_bytes %zu\n",
+                         mi.uordblks);
+  append_help(out, "financials_heap_free_bytes", "gauge",
+              "malloc arena bytes free [fragmentation].");
+  g_string_append_printf(out, "financials_heap_free_bytes %zu\n", mi.fordblks);
+  append_help(out, "financials_heap_mmap_bytes", "gauge",
+              "Bytes in large mmap allocations.");
+  g_string_append_printf(out, "financials_heap_mmap_bytes %zu\n", mi.hblkhd);
+#endif
+
+  /* Requests, failures, bytes, and latency per host. */
+  TelemetryPrometheus(out);
+
+  return g_string_free(out, FALSE);
+}
+
+static gboolean metrics_connection(GThreadedSocketService *srv,
+                                   GSocketConnection *connection,
+                                   GObject *source_object, gpointer data)
+/* Answer any GET with the metrics [runs in a service thread]. */
+{
+  UNUSED(srv)
+  UNUSED(source_object)
+  UNUSED(data)
+  GInputStream *in = g_io_stream_get_input_stream(G_IO_STREAM(connection));
+  GOutputStream *out = g_io_stream_get_output_stream(G_IO_STREAM(connection));
+  GDataInputStream *data_in = g_data_input_stream_new(in);
+  g_data_input_stream_set_newline_type(data_in,
+                                       G_DATA_STREAM_NEWLINE_TYPE_ANY);
+
+  /* The request line and the headers, up to the blank line. */
+  gchar *line = NULL;
+  while ((line = g_data_input_stream_read_line(data_in, NULL, NULL, NULL)) &&
+         line[0]) {
+    g_free(line);
+  }
+  g_free(line);
+
+  gchar *body = MetricsRender();
+  gchar *head = g_strdup_printf(
+      "HTTP/1.1 200 OK\r\n"
+      "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+      "Content-Length: %" G_GSIZE_FORMAT "\r\n"
+      "Connection: close\r\n\r\n",
+      strlen(body));
+  g_output_stream_write_all(out, head, strlen(head), NULL, NULL, NULL);
+  g_output_stream_write_all(out, body, strlen(body), NULL, NULL, NULL);
+
+  g_free(head);
+  g_free(body);
+  g_object_unref(data_in);
+  return TRUE;
+}
+
+void MetricsInit()
+/* Serve the metrics if FINANCIALS_METRICS_PORT is set.  Call from the main
+   thread, the listener and the idle probe run on the default main context
+   [the gtk main loop, or the daemon's loop]. */
+{
+  const gchar *port_ch = g_getenv("FINANCIALS_METRICS_PORT");
+  if (port_ch == NULL || service)
+    return;
+
+  guint16 port = (guint16)g_ascii_strtoull(port_ch, NULL, 10);
+  GError *error = NULL;
+  GSocketAddress *address =
+      g_inet_socket_address_new_from_string("127.0.0.1", port);
+  service = g_threaded_socket_service_new(4);
+
+  if (port == 0 ||
+      !g_socket_listener_add_address(
+          G_SOCKET_LISTENER(service), address, G_SOCKET_TYPE_STREAM,
+          G_SOCKET_PROTOCOL_DEFAULT, NULL, NULL, &error)) {
+    g_fprintf(stderr, "Cannot serve metrics on port '%s': %s\n", port_ch,
+              error ? error->message : "invalid port");
+    if (error)
+      g_error_free(error);
+    g_object_unref(address);
+    g_object_unref(service);
+    service = NULL;
+    return;
+  }
+  g_object_unref(address);
+
+  g_signal_connect(service, "run", G_CALLBACK(metrics_connection), NULL);
+  g_socket_service_start(service);
+  idle_probe_id = g_timeout_add_seconds(1, idle_probe_post, NULL);
+}
+
+void MetricsDestruct() {
+  if (idle_probe_id)
+    g_source_remove(idle_probe_id);
+  idle_probe_id = 0;
+
+  if (service) {
+    g_socket_service_stop(service);
+    g_socket_listener_close(G_SOCKET_LISTENER(service));
+    g_object_unref(service);
+    service = NULL;
+  }
+}
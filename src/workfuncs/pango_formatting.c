@@ -31,84 +31,105 @@ POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "../include/macros.h"
+#include "../include/mutex.h"
 #include "../include/workfuncs.h"
 
-/* Font name file global. */
-static const gchar *font_name;
-
-void SetFont(const gchar *fnt) { font_name = fnt; }
-
-static void create_markup(gchar **str, const gchar *fmt, ...)
-/* Create a string from a format string and a list of arguments.
-   Useful for creating marked up strings and their attribute components.
-
-   Make sure *str = NULL or an allocated pointer address. */
-{
-  va_list arg_ptr;
-
-  /* Set the arg pointer. */
-  va_start(arg_ptr, fmt);
-  /* Get the size of the potential string. */
-  gsize len = g_vsnprintf(NULL, 0, fmt, arg_ptr) + 1;
-  va_end(arg_ptr);
-
-  /* Realloc str[0] to the string size. */
-  gchar *tmp = g_realloc(str[0], len);
-  str[0] = tmp;
-
-  /* Reset the arg pointer. */
-  va_start(arg_ptr, fmt);
-  /* Create the markup string from format and argument list. */
-  g_vsnprintf(str[0], len, fmt, arg_ptr);
-  va_end(arg_ptr);
-}
-
-static gchar *font_attr(const gchar *fnt_name) {
-  const gchar *fnt_fmt = "font_desc='%s'";
-  gchar *attr = NULL;
-
-  create_markup(&attr, fnt_fmt, fnt_name);
-  return attr;
-}
-
-static gchar *fg_attr(const gchar *fg_color) {
-  const gchar *fg_fmt = "foreground='%s'";
-  gchar *attr = NULL;
-
-  create_markup(&attr, fg_fmt, fg_color);
-  return attr;
+/* The span attributes of each color enum, without the font. */
+static const gchar *attr_arr[PANGO_FORMATS] = {
+    [NO_COLOR] = "weight='Medium'",
+    [BLACK] = "foreground='Black' weight='Medium'",
+    [GREEN] = "foreground='DarkGreen' weight='Medium'",
+    [RED] = "foreground='DarkRed' weight='Medium'",
+    [BLUE] = "foreground='MidnightBlue' weight='Medium'",
+    [GREY] = "foreground='DarkSlateGrey' weight='Medium'",
+    [CYAN] = "foreground='DarkCyan' weight='Medium'",
+    [ORANGE] = "foreground='OrangeRed' weight='Medium'",
+    [CHOCOLATE] = "foreground='Chocolate' weight='Medium'",
+    [SIENNA] = "foreground='Sienna' weight='Medium'",
+    [HEADING_ASST_TYPE_FORMAT] =
+        "foreground='DarkSlateGray' weight='Demi-Bold'",
+    [HEADING_UNLN_FORMAT] = "foreground='SaddleBrown' weight='Demi-Bold' "
+                            "underline='single' underline_color='SaddleBrown'",
+    [STR_TO_MON_STR] = "foreground='DarkSlateGrey' weight='Medium'",
+    [GREEN_ITALIC] = "foreground='DarkGreen' weight='Medium' style='italic'",
+    [RED_ITALIC] = "foreground='DarkRed' weight='Medium' style='italic'",
+    [BLUE_ITALIC] = "foreground='MidnightBlue' weight='Medium' style='italic'",
+    [BLACK_ITALIC] = "foreground='Black' weight='Medium' style='italic'",
+};
+
+#define SPAN_CLOSE "</span>"
+
+/* The opening span of each color enum for the current font, compiled by
+   SetFont [ClassInitMeta sets the first font]. */
+typedef struct {
+  gchar *prefix_arr[PANGO_FORMATS];
+  gsize prefix_len_arr[PANGO_FORMATS];
+} pango_templates;
+
+/* Swapped by SetFont on the GTK thread under CLASS_TOSTRINGS_MUTEX, the
+   other formatting threads hold that lock. */
+static pango_templates *templates = NULL;
+
+static void templates_free(pango_templates *T) {
+  if (T == NULL)
+    return;
+  for (guint c = 0; c < PANGO_FORMATS; c++)
+    g_free(T->prefix_arr[c]);
+  g_free(T);
 }
 
-static gchar *wght_attr(const gchar *wght_name) {
-  const gchar *wght_fmt = "weight='%s'";
-  gchar *attr = NULL;
-
-  create_markup(&attr, wght_fmt, wght_name);
-  return attr;
-}
+void SetFont(const gchar *fnt)
+/* Compile the span prefixes for this font, each cell is then one copy.
+   Don't hold CLASS_TOSTRINGS_MUTEX. */
+{
+  pango_templates *T = g_malloc(sizeof(*T));
 
-static gchar *undln_attr(const gchar *undln_type) {
-  const gchar *undln_fmt = "underline='%s'";
-  gchar *attr = NULL;
+  for (guint c = 0; c < PANGO_FORMATS; c++) {
+    T->prefix_arr[c] =
+        g_strdup_printf("<span font_desc='%s' %s>", fnt, attr_arr[c]);
+    T->prefix_len_arr[c] = strlen(T->prefix_arr[c]);
+  }
 
-  create_markup(&attr, undln_fmt, undln_type);
-  return attr;
+  MutexLock(&mutexes[CLASS_TOSTRINGS_MUTEX]);
+  pango_templates *old = templates;
+  templates = T;
+  g_mutex_unlock(&mutexes[CLASS_TOSTRINGS_MUTEX]);
+  templates_free(old);
 }
 
-static gchar *undln__colr_attr(const gchar *undln_color) {
-  const gchar *undln_colr_fmt = "underline_color='%s'";
-  gchar *attr = NULL;
+gboolean NumericColumns()
+/* TRUE if FINANCIALS_NUMERIC_COLUMNS is set; the primary treeview then
+   formats the equity cells as they are drawn, ToStrings skips them. */
+{
+  static gsize numeric_init = 0;
+  static gboolean numeric_bool = FALSE;
 
-  create_markup(&attr, undln_colr_fmt, undln_color);
-  return attr;
+  if (g_once_init_enter(&numeric_init)) {
+    numeric_bool = g_getenv("FINANCIALS_NUMERIC_COLUMNS") != NULL;
+    g_once_init_leave(&numeric_init, 1);
+  }
+  return numeric_bool;
 }
 
-static gchar *style_attr(const gchar *style_type) {
-  const gchar *style_fmt = "style='%s'";
-  gchar *attr = NULL;
-
-  create_markup(&attr, style_fmt, style_type);
-  return attr;
+static gsize pango_append(gchar **dst, gsize at, const gchar *src,
+                          const guint color)
+/* Write src as a span of color at offset at of *dst, growing *dst to fit.
+   Returns the new string length. */
+{
+  const pango_templates *T = templates;
+  guint c = color < PANGO_FORMATS ? color : HEADING_UNLN_FORMAT;
+  gsize src_len = strlen(src);
+  gsize len = at + T->prefix_len_arr[c] + src_len + strlen(SPAN_CLOSE);
+
+  dst[0] = StrArenaRealloc(dst[0], at, len + 1);
+  gchar *p = dst[0] + at;
+  memcpy(p, T->prefix_arr[c], T->prefix_len_arr[c]);
+  p += T->prefix_len_arr[c];
+  memcpy(p, src, src_len);
+  p += src_len;
+  memcpy(p, SPAN_CLOSE, strlen(SPAN_CLOSE) + 1);
+
+  return len;
 }
 
 void StringToStrPango(gchar **dst, const gchar *src, const guint color)
@@ -123,128 +144,16 @@ void StringToStrPango(gchar **dst, const gchar *src, const guint color)
   if (!dst || !src)
     return;
 
-  gchar *font = font_attr(font_name);
-  gchar *fg = NULL;
-  gchar *wght = NULL;
-  gchar *undln = NULL;
-  gchar *undln_colr = NULL;
-  gchar *style = NULL;
-  gchar *tmp = NULL;
-  const gchar *format_three = "<span %s %s>%s</span>";
-  const gchar *format_four = "<span %s %s %s>%s</span>";
-  const gchar *format_five = "<span %s %s %s %s>%s</span>";
-  const gchar *format_six = "<span %s %s %s %s %s>%s</span>";
-
-  switch (color) {
-  case NO_COLOR:
-    wght = wght_attr("Medium");
-    create_markup(dst, format_three, font, wght, src);
-    break;
-  case BLACK:
-    fg = fg_attr("Black");
-    wght = wght_attr("Medium");
-    create_markup(dst, format_four, font, fg, wght, src);
-    break;
-  case RED:
-    fg = fg_attr("DarkRed");
-    wght = wght_attr("Medium");
-    create_markup(dst, format_four, font, fg, wght, src);
-    break;
-  case GREEN:
-    fg = fg_attr("DarkGreen");
-    wght = wght_attr("Medium");
-    create_markup(dst, format_four, font, fg, wght, src);
-    break;
-  case BLUE:
-    fg = fg_attr("MidnightBlue");
-    wght = wght_attr("Medium");
-    create_markup(dst, format_four, font, fg, wght, src);
-    break;
-  case GREY:
-    fg = fg_attr("DarkSlateGrey");
-    wght = wght_attr("Medium");
-    create_markup(dst, format_four, font, fg, wght, src);
-    break;
-  case CYAN:
-    fg = fg_attr("DarkCyan");
-    wght = wght_attr("Medium");
-    create_markup(dst, format_four, font, fg, wght, src);
-    break;
-  case ORANGE:
-    fg = fg_attr("OrangeRed");
-    wght = wght_attr("Medium");
-    create_markup(dst, format_four, font, fg, wght, src);
-    break;
-  case CHOCOLATE:
-    fg = fg_attr("Chocolate");
-    wght = wght_attr("Medium");
-    create_markup(dst, format_four, font, fg, wght, src);
-    break;
-  case SIENNA:
-    fg = fg_attr("Sienna");
-    wght = wght_attr("Medium");
-    create_markup(dst, format_four, font, fg, wght, src);
-    break;
-  case BLACK_ITALIC:
-    fg = fg_attr("Black");
-    wght = wght_attr("Medium");
-    style = style_attr("italic");
-    create_markup(dst, format_five, font, fg, wght, style, src);
-    break;
-  case RED_ITALIC:
-    fg = fg_attr("DarkRed");
-    wght = wght_attr("Medium");
-    style = style_attr("italic");
-    create_markup(dst, format_five, font, fg, wght, style, src);
-    break;
-  case GREEN_ITALIC:
-    fg = fg_attr("DarkGreen");
-    wght = wght_attr("Medium");
-    style = style_attr("italic");
-    create_markup(dst, format_five, font, fg, wght, style, src);
-    break;
-  case BLUE_ITALIC:
-    fg = fg_attr("MidnightBlue");
-    wght = wght_attr("Medium");
-    style = style_attr("italic");
-    create_markup(dst, format_five, font, fg, wght, style, src);
-    break;
-  case STR_TO_MON_STR:
-    /* This is a special conversion, make sure the string can be converted to a
-     * double */
-    StringToMonStr(&tmp, src, 2);
-    fg = fg_attr("DarkSlateGrey");
-    wght = wght_attr("Medium");
-    create_markup(dst, format_four, font, fg, wght, tmp);
-    break;
-  case HEADING_ASST_TYPE_FORMAT:
-    fg = fg_attr("DarkSlateGray");
-    wght = wght_attr("Demi-Bold");
-    create_markup(dst, format_four, font, fg, wght, src);
-    break;
-  default: /* HEADING_UNLN_FORMAT */
-    fg = fg_attr("SaddleBrown");
-    wght = wght_attr("Demi-Bold");
-    undln = undln_attr("single");
-    undln_colr = undln__colr_attr("SaddleBrown");
-    create_markup(dst, format_six, font, fg, wght, undln, undln_colr, src);
-    break;
+  if (color == STR_TO_MON_STR) {
+    /* This is a special conversion, make sure the string can be converted to
+     * a double */
+    gchar buf[FORMAT_BUF_SIZE];
+    FormatDouble(buf, sizeof(buf), StringToDouble(src), 2, MON_STR);
+    pango_append(dst, 0, buf, color);
+    return;
   }
 
-  if (font)
-    g_free(font);
-  if (fg)
-    g_free(fg);
-  if (wght)
-    g_free(wght);
-  if (undln)
-    g_free(undln);
-  if (undln_colr)
-    g_free(undln_colr);
-  if (style)
-    g_free(style);
-  if (tmp)
-    g_free(tmp);
+  pango_append(dst, 0, src, color);
 }
 
 void DoubleToFormattedStrPango(gchar **dst, const gdouble num,
@@ -267,121 +176,82 @@ void DoubleToFormattedStrPango(gchar **dst, const gdouble num,
    The macro enums are defined in workfuncs.h.
 */
 {
-  gchar *tmp = NULL;
-  DoubleToFormattedStr(&tmp, num, digits_right, format_type);
-  StringToStrPango(dst, tmp, color);
-  g_free(tmp);
+  if (!dst || digits_right > 4)
+    return;
+
+  gchar buf[FORMAT_BUF_SIZE];
+  FormatDouble(buf, sizeof(buf), num, digits_right, format_type);
+  pango_append(dst, 0, buf, color);
 }
 
 void RangeStrPango(gchar **dest, const double low_f, const double high_f,
                    const guint8 digits_right) {
-  gchar *low_ch = NULL, *high_ch = NULL, *range_ch = NULL;
+  gchar low_ch[FORMAT_BUF_SIZE], high_ch[FORMAT_BUF_SIZE];
+  gchar range_ch[FORMAT_BUF_SIZE * 2 + 4];
 
   /* Create the monetary format strings. */
-  DoubleToFormattedStr(&low_ch, low_f, digits_right, MON_STR);
-
-  DoubleToFormattedStr(&high_ch, high_f, digits_right, MON_STR);
+  FormatDouble(low_ch, sizeof(low_ch), low_f, digits_right, MON_STR);
+  FormatDouble(high_ch, sizeof(high_ch), high_f, digits_right, MON_STR);
 
   /* Create the unmarked string. */
-  range_ch = SnPrint("%s - %s", low_ch, high_ch);
+  g_snprintf(range_ch, sizeof(range_ch), "%s - %s", low_ch, high_ch);
 
   /* Create the marked up string. */
-  StringToStrPango(dest, range_ch, GREY);
+  pango_append(dest, 0, range_ch, GREY);
+}
 
-  g_free(low_ch);
-  g_free(high_ch);
-  g_free(range_ch);
+static guint sign_color(const double value_f) {
+  if (value_f < 0)
+    return RED;
+  else if (value_f > 0)
+    return GREEN;
+  return BLACK;
 }
 
 void ChangeStrPango(gchar **dest, const double value_f, const double percent_f,
                     const guint8 digits_right) {
-  gchar *value_ch = NULL, *percent_ch = NULL, *val_per_ch = NULL;
+  gchar value_ch[FORMAT_BUF_SIZE], percent_ch[FORMAT_BUF_SIZE];
+  gchar val_per_ch[FORMAT_BUF_SIZE * 2 + 2];
 
   /* Create the monetary and percent format strings. */
-  DoubleToFormattedStr(&value_ch, value_f, digits_right, MON_STR);
-
-  DoubleToFormattedStr(&percent_ch, percent_f, digits_right, PER_STR);
+  FormatDouble(value_ch, sizeof(value_ch), value_f, digits_right, MON_STR);
+  FormatDouble(percent_ch, sizeof(percent_ch), percent_f, digits_right,
+               PER_STR);
 
   /* Create the unmarked string. */
-  val_per_ch = SnPrint("%s\n%s", value_ch, percent_ch);
+  g_snprintf(val_per_ch, sizeof(val_per_ch), "%s\n%s", value_ch, percent_ch);
 
   /* Create the marked up string. */
-  if (value_f < 0) {
-    StringToStrPango(dest, val_per_ch, RED);
-  } else if (value_f > 0) {
-    StringToStrPango(dest, val_per_ch, GREEN);
-  } else {
-    StringToStrPango(dest, val_per_ch, BLACK);
-  }
-
-  g_free(value_ch);
-  g_free(percent_ch);
-  g_free(val_per_ch);
+  pango_append(dest, 0, val_per_ch, sign_color(value_f));
 }
 
 void TotalStrPango(gchar **dest, const double total_f, const double gain_f,
                    const guint8 digits_right) {
-  gchar *total_ch = NULL, *gain_ch = NULL, *tmp_ch = NULL;
-  gchar *total_mrkd_ch = NULL, *gain_mrkd_ch = NULL;
+  gchar total_ch[FORMAT_BUF_SIZE + 1], gain_ch[FORMAT_BUF_SIZE];
 
   /* Create the monetary format strings. */
-  DoubleToFormattedStr(&tmp_ch, total_f, digits_right, MON_STR);
-  total_ch = SnPrint("%s\n", tmp_ch);
-  g_free(tmp_ch);
-
-  DoubleToFormattedStr(&gain_ch, gain_f, digits_right, MON_STR);
-
-  /* Create the first marked string. */
-  StringToStrPango(&total_mrkd_ch, total_ch, BLACK);
-
-  /* Create the second marked string. */
-  if (gain_f < 0) {
-    StringToStrPango(&gain_mrkd_ch, gain_ch, RED);
-  } else if (gain_f > 0) {
-    StringToStrPango(&gain_mrkd_ch, gain_ch, GREEN);
-  } else {
-    StringToStrPango(&gain_mrkd_ch, gain_ch, BLACK);
-  }
-
-  /* Find allocation size */
-  gsize len = g_snprintf(NULL, 0, "%s%s", total_mrkd_ch, gain_mrkd_ch) + 1;
-  tmp_ch = g_realloc(dest[0], len);
-  dest[0] = tmp_ch;
-
-  g_snprintf(dest[0], len, "%s%s", total_mrkd_ch, gain_mrkd_ch);
-
-  g_free(total_ch);
-  g_free(gain_ch);
-  g_free(total_mrkd_ch);
-  g_free(gain_mrkd_ch);
+  gsize len =
+      FormatDouble(total_ch, FORMAT_BUF_SIZE, total_f, digits_right, MON_STR);
+  g_strlcpy(total_ch + MIN(len, FORMAT_BUF_SIZE - 1), "\n", 2);
+  FormatDouble(gain_ch, sizeof(gain_ch), gain_f, digits_right, MON_STR);
+
+  /* The two marked strings, one after the other. */
+  len = pango_append(dest, 0, total_ch, BLACK);
+  pango_append(dest, len, gain_ch, sign_color(gain_f));
 }
 
 void SymbolStrPango(gchar **dest, const gchar *symbol_ch,
                     const double quantity_f, const guint8 digits_right,
                     const guint color) {
-  gchar *quantity_ch = NULL, *tmp_ch = NULL;
-  gchar *symbol_mrkd_ch = NULL, *quantity_mrkd_ch = NULL;
+  gchar quantity_ch[FORMAT_BUF_SIZE];
+  gchar *tmp_ch = g_strconcat(symbol_ch, "\n", NULL);
 
-  /* Create the unmarked strings. */
-  tmp_ch = SnPrint("%s\n", symbol_ch);
+  FormatDouble(quantity_ch, sizeof(quantity_ch), quantity_f, digits_right,
+               NUM_STR);
 
-  DoubleToFormattedStr(&quantity_ch, quantity_f, digits_right, NUM_STR);
+  /* The two marked strings, one after the other. */
+  gsize len = pango_append(dest, 0, tmp_ch, color);
+  pango_append(dest, len, quantity_ch, SIENNA);
 
-  /* Create the first marked string. */
-  StringToStrPango(&symbol_mrkd_ch, tmp_ch, color);
   g_free(tmp_ch);
-
-  /* Create the second marked string. */
-  StringToStrPango(&quantity_mrkd_ch, quantity_ch, SIENNA);
-
-  /* Find allocation size */
-  gsize len = g_snprintf(NULL, 0, "%s%s", symbol_mrkd_ch, quantity_mrkd_ch) + 1;
-  tmp_ch = g_realloc(dest[0], len);
-  dest[0] = tmp_ch;
-
-  g_snprintf(dest[0], len, "%s%s", symbol_mrkd_ch, quantity_mrkd_ch);
-
-  g_free(quantity_ch);
-  g_free(symbol_mrkd_ch);
-  g_free(quantity_mrkd_ch);
-}
\ No newline at end of file
+}
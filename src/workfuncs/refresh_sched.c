@@ -0,0 +1,210 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <math.h>
+
+#include "../include/workfuncs.h"
+
+/* The adaptive refresh [FINANCIALS_ADAPTIVE_REFRESH].  The fixed schedule
+   fetches every quote each period; this one never spends more, and shares
+   the calls by session and volatility.
+
+   An open quote has one call a period, a quote in the equity extended hours
+   a quarter, a closed quote none [it's fetched once as its session changes
+   and then hourly].  The open quotes' calls are shared by volatility
+   [half to twice their mean], the closed quotes' calls are not spent.  The
+   fetch timer fires each second and a cycle fetches the quotes whose
+   interval has passed, none faster than twice the fixed rate.  The fetch
+   session lasts while the equities are in their regular or extended
+   hours. */
+
+#define CLOSED_INTERVAL_SEC 3600
+#define EXTENDED_WEIGHT 0.25
+#define VOL_MIN 0.5
+#define VOL_MAX 2.0
+#define VOL_ALPHA 0.2
+#define MAX_SPEEDUP 2
+
+/* The NY wall clock, the equity extended hours on trading days and the
+   futures daily halt. */
+#define PRE_MARKET_SEC (4 * 3600)
+#define POST_MARKET_SEC (20 * 3600)
+#define FUTURES_HALT_SEC (17 * 3600)
+#define FUTURES_RESUME_SEC (18 * 3600)
+
+gboolean AdaptiveRefresh()
+/* TRUE if FINANCIALS_ADAPTIVE_REFRESH is set. */
+{
+  static gsize adaptive_init = 0;
+  static gboolean adaptive_bool = FALSE;
+
+  if (g_once_init_enter(&adaptive_init)) {
+    adaptive_bool = g_getenv("FINANCIALS_ADAPTIVE_REFRESH") != NULL;
+    g_once_init_leave(&adaptive_init, 1);
+  }
+  return adaptive_bool;
+}
+
+void RefreshStateInit(refresh_state *R, guint8 session) {
+  R->session = session;
+  R->state = REFRESH_CLOSED;
+  R->due_bool = TRUE;
+  R->fetch_s = 0;
+  R->interval_s = 0;
+  R->price_s = 0;
+  R->price_f = 0.0f;
+  R->vol_f = 0.0f;
+}
+
+static guint8 session_state(guint8 session, gint64 now_s) {
+  gint64 open_s, close_s;
+  gint weekday, wall_s;
+
+  switch (session) {
+  case REFRESH_CRYPTO:
+    return REFRESH_OPEN;
+
+  case REFRESH_FUTURES:
+    /* CME Globex, Sunday 18:00 to Friday 17:00 with an hour's halt each
+       day, the exchange holidays aren't applied. */
+    wall_s = MarketDayAt(now_s, &weekday, NULL, NULL);
+    if (weekday == G_DATE_SATURDAY ||
+        (weekday == G_DATE_SUNDAY && wall_s < FUTURES_RESUME_SEC) ||
+        (weekday == G_DATE_FRIDAY && wall_s >= FUTURES_HALT_SEC) ||
+        (wall_s >= FUTURES_HALT_SEC && wall_s < FUTURES_RESUME_SEC))
+      return REFRESH_CLOSED;
+    return REFRESH_OPEN;
+
+  default:
+    wall_s = MarketDayAt(now_s, NULL, &open_s, &close_s);
+    if (now_s >= open_s && now_s < close_s)
+      return REFRESH_OPEN;
+    if (session == REFRESH_EQUITY && open_s && wall_s >= PRE_MARKET_SEC &&
+        wall_s < POST_MARKET_SEC)
+      return REFRESH_EXTENDED;
+    return REFRESH_CLOSED;
+  }
+}
+
+static gdouble session_weight(const refresh_state *R)
+/* The quote's calls a period, by its session's state. */
+{
+  if (R->state == REFRESH_CLOSED)
+    return 0.0f;
+  return R->state == REFRESH_EXTENDED ? EXTENDED_WEIGHT : 1;
+}
+
+static gdouble quote_weight(const refresh_state *R, gdouble vol_mean_f) {
+  gdouble weight_f = session_weight(R);
+
+  if (vol_mean_f > 0 && R->vol_f > 0)
+    weight_f *= CLAMP(R->vol_f / vol_mean_f, VOL_MIN, VOL_MAX);
+  return weight_f;
+}
+
+gboolean RefreshSessionOpen(gint64 now_s)
+/* TRUE while the equities are in their regular or extended hours, the
+   adaptive fetch session ends outside them [as the fixed one ends at the
+   NYSE close]. */
+{
+  return session_state(REFRESH_EQUITY, now_s) != REFRESH_CLOSED;
+}
+
+guint RefreshPlan(refresh_state **R, guint n, guint period_s, gint64 now_s)
+/* Set due_bool on the quotes to fetch at now_s, return their number.  The
+   fixed schedule fetches the n quotes every period_s seconds, the plan's
+   calls are at most as many. */
+{
+  period_s = MAX(period_s, 1);
+  gdouble budget_f = 0.0f; /* The open quotes' calls a second. */
+  gdouble vol_sum_f = 0.0f, weight_sum_f = 0.0f;
+  guint vol_n = 0, due = 0;
+
+  /* The sessions, a change fetches at once [the final quote of a close,
+     the first of an open].  A closed quote's call isn't passed on to the
+     open ones. */
+  for (guint i = 0; i < n; i++) {
+    guint8 state = session_state(R[i]->session, now_s);
+    if (state != R[i]->state) {
+      R[i]->state = state;
+      R[i]->fetch_s = 0;
+    }
+    budget_f += session_weight(R[i]) / (gdouble)period_s;
+    if (state != REFRESH_CLOSED && R[i]->vol_f > 0) {
+      vol_sum_f += R[i]->vol_f;
+      vol_n++;
+    }
+  }
+
+  gdouble vol_mean_f = vol_n ? vol_sum_f / vol_n : 0.0f;
+  for (guint i = 0; i < n; i++)
+    if (R[i]->state != REFRESH_CLOSED)
+      weight_sum_f += quote_weight(R[i], vol_mean_f);
+
+  /* An open quote's share of the budget is its share of the weight [the
+     interval rounded up and clamped, the plan never spends more than the
+     budget]. */
+  gdouble min_f = MAX(1.0f, (gdouble)period_s / MAX_SPEEDUP);
+  for (guint i = 0; i < n; i++) {
+    refresh_state *Q = R[i];
+    gdouble interval_f = CLOSED_INTERVAL_SEC;
+
+    if (Q->state != REFRESH_CLOSED)
+      interval_f = CLAMP(
+          weight_sum_f / (budget_f * quote_weight(Q, vol_mean_f)), min_f,
+          (gdouble)CLOSED_INTERVAL_SEC);
+    Q->interval_s = (gint64)ceil(interval_f);
+
+    Q->due_bool = Q->fetch_s == 0 || now_s - Q->fetch_s >= Q->interval_s;
+    if (Q->due_bool) {
+      Q->fetch_s = now_s;
+      due++;
+    }
+  }
+  return due;
+}
+
+void RefreshObserve(refresh_state *R, gdouble price_f, gint64 now_s)
+/* Record a fetched quote, zero [a failed fetch] is skipped. */
+{
+  if (price_f <= 0)
+    return;
+
+  if (R->price_f > 0 && now_s > R->price_s) {
+    gdouble ret_f = fabs(log(price_f / R->price_f)) /
+                    sqrt((gdouble)(now_s - R->price_s));
+    R->vol_f = R->vol_f > 0 ? R->vol_f + VOL_ALPHA * (ret_f - R->vol_f)
+                            : ret_f;
+  }
+  R->price_f = price_f;
+  R->price_s = now_s;
+}
@@ -0,0 +1,343 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <string.h>
+
+#include "../include/gui_types.h" /* symbol_name_map, symbol_name_index,
+                                     symbol_name_query */
+#include "../include/macros.h"
+#include "../include/workfuncs.h"
+
+/* The trigram index maps every three byte window of a normalized
+   "symbol name" string to the list of map positions containing it.
+
+   A lookup counts the trigrams each position shares with the key, so a
+   substring anywhere in the name ["micro" -> "Advanced Micro Devices"] or a
+   key with a typo ["micrsoft"] still finds the security. */
+
+/* Query trigrams beyond this are ignored, it keeps the hit counts in a
+ * guint8. */
+#define SN_QUERY_MAX_GRAMS 64
+
+/* The completion popup displays the best scoring matches only. */
+#define SN_QUERY_MAX_RESULTS 50
+
+static void normalize_text(GString *out, const gchar *s, gboolean pad_end)
+/* Append the string lowercased, with any run of punctuation or whitespace
+   collapsed into a single space, and a leading space [so trigrams can anchor
+   to the start of a word].  Non-ASCII UTF-8 bytes are kept as is. */
+{
+  gboolean space = TRUE;
+
+  if (out->len == 0 || out->str[out->len - 1] != ' ')
+    g_string_append_c(out, ' ');
+  for (const guchar *c = (const guchar *)s; c && *c; c++) {
+    if (g_ascii_isalnum(*c) || *c > 127) {
+      g_string_append_c(out, g_ascii_tolower(*c));
+      space = FALSE;
+    } else if (!space) {
+      g_string_append_c(out, ' ');
+      space = TRUE;
+    }
+  }
+
+  if (pad_end && !space)
+    g_string_append_c(out, ' ');
+}
+
+static gint gram_cmp(gconstpointer a, gconstpointer b) {
+  guint32 aa = *(const guint32 *)a, bb = *(const guint32 *)b;
+  return (aa > bb) - (aa < bb);
+}
+
+static GArray *text_to_grams(const gchar *text, gsize max)
+/* Return the distinct, sorted trigrams of a normalized text string, at most
+   max trigrams.  Must unref the return value. */
+{
+  GArray *grams = g_array_new(FALSE, FALSE, sizeof(guint32));
+  const guchar *t = (const guchar *)text;
+  gsize len = strlen(text);
+  guint32 gram;
+
+  for (gsize i = 0; i + 2 < len && grams->len < max; i++) {
+    gram = ((guint32)t[i] << 16) | ((guint32)t[i + 1] << 8) | t[i + 2];
+    g_array_append_val(grams, gram);
+  }
+
+  /* Sort, then drop the duplicates. */
+  g_array_sort(grams, gram_cmp);
+  guint n = 0;
+  for (guint i = 0; i < grams->len; i++)
+    if (n == 0 || g_array_index(grams, guint32, n - 1) !=
+                      g_array_index(grams, guint32, i))
+      g_array_index(grams, guint32, n++) = g_array_index(grams, guint32, i);
+  g_array_set_size(grams, n);
+
+  return grams;
+}
+
+static void posting_free(gpointer data) { g_array_unref((GArray *)data); }
+
+symbol_name_index *SNIndexNew(const symbol_name_map *sn_map,
+                              const symbol_name_index *prev)
+/* Build a trigram index over the sn_map.
+
+   If a previous index is given, the trigram sets of unchanged entries
+   [the same normalized text] are shared from it rather than generated again,
+   only new or renamed securities are tokenized.  The posting lists are
+   relinked, because map positions shift when symbols are added or removed.
+
+   The returned index holds one reference, release with SNIndexUnref. */
+{
+  if (sn_map == NULL || sn_map->size == 0)
+    return NULL;
+
+  symbol_name_index *idx = g_malloc(sizeof(*idx));
+  idx->size = sn_map->size;
+  idx->ref_count = 1;
+  idx->symbol_arr = g_malloc(sizeof(gchar *) * idx->size);
+  idx->text_arr = g_malloc(sizeof(gchar *) * idx->size);
+  idx->gram_arr = g_malloc(sizeof(GArray *) * idx->size);
+  idx->posting_table = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+                                             NULL, posting_free);
+
+  /* Text to trigram set lookup into the previous index. */
+  GHashTable *prev_table = NULL;
+  if (prev) {
+    prev_table = g_hash_table_new(g_str_hash, g_str_equal);
+    for (gushort g = 0; g < prev->size; g++)
+      g_hash_table_insert(prev_table, prev->text_arr[g], prev->gram_arr[g]);
+  }
+
+  GString *text = g_string_sized_new(128);
+  GArray *grams, *posting;
+  guint32 gram;
+  gushort pos;
+
+  for (pos = 0; pos < idx->size; pos++) {
+    symbol_to_security_name_container *item = sn_map->sn_container_arr[pos];
+
+    idx->symbol_arr[pos] = g_ascii_strdown(item->symbol, -1);
+
+    g_string_truncate(text, 0);
+    normalize_text(text, item->symbol, TRUE);
+    normalize_text(text, item->security_name, TRUE);
+    idx->text_arr[pos] = g_strdup(text->str);
+
+    grams = prev_table ? g_hash_table_lookup(prev_table, text->str) : NULL;
+    if (grams)
+      idx->gram_arr[pos] = g_array_ref(grams);
+    else
+      idx->gram_arr[pos] = text_to_grams(text->str, G_MAXSIZE);
+
+    /* Link this position into each of its trigram posting lists; positions
+       are appended in ascending order. */
+    grams = idx->gram_arr[pos];
+    for (guint i = 0; i < grams->len; i++) {
+      gram = g_array_index(grams, guint32, i);
+      posting = g_hash_table_lookup(idx->posting_table, GUINT_TO_POINTER(gram));
+      if (posting == NULL) {
+        posting = g_array_new(FALSE, FALSE, sizeof(gushort));
+        g_hash_table_insert(idx->posting_table, GUINT_TO_POINTER(gram),
+                            posting);
+      }
+      g_array_append_val(posting, pos);
+    }
+  }
+
+  g_string_free(text, TRUE);
+  if (prev_table)
+    g_hash_table_destroy(prev_table);
+
+  return idx;
+}
+
+symbol_name_index *SNIndexRef(symbol_name_index *idx) {
+  if (idx)
+    g_atomic_int_inc(&idx->ref_count);
+  return idx;
+}
+
+void SNIndexUnref(symbol_name_index *idx)
+/* Release a reference, the index is freed with the last reference. */
+{
+  if (idx == NULL || !g_atomic_int_dec_and_test(&idx->ref_count))
+    return;
+
+  for (gushort g = 0; g < idx->size; g++) {
+    g_free(idx->symbol_arr[g]);
+    g_free(idx->text_arr[g]);
+    g_array_unref(idx->gram_arr[g]);
+  }
+  g_free(idx->symbol_arr);
+  g_free(idx->text_arr);
+  g_free(idx->gram_arr);
+  g_hash_table_destroy(idx->posting_table);
+  g_free(idx);
+}
+
+symbol_name_query *SNQueryNew(symbol_name_index *idx)
+/* Create the lookup state for one completion widget, takes a reference on
+   the index.  Free with SNQueryFree. */
+{
+  symbol_name_query *q = g_malloc(sizeof(*q));
+  q->index = SNIndexRef(idx);
+  q->key = NULL;
+  q->hit_arr = g_malloc0(sizeof(guint8) * idx->size);
+  q->score_arr = g_malloc0(sizeof(gfloat) * idx->size);
+  q->touched_arr = g_malloc(sizeof(gushort) * idx->size);
+  q->touched_num = 0;
+  return q;
+}
+
+void SNQueryFree(gpointer query_data) {
+  symbol_name_query *q = (symbol_name_query *)query_data;
+  if (q == NULL)
+    return;
+
+  SNIndexUnref(q->index);
+  g_free(q->key);
+  g_free(q->hit_arr);
+  g_free(q->score_arr);
+  g_free(q->touched_arr);
+  g_free(q);
+}
+
+static gint score_desc(gconstpointer a, gconstpointer b, gpointer data) {
+  UNUSED(data)
+
+  gfloat aa = *(const gfloat *)a, bb = *(const gfloat *)b;
+  return (aa < bb) - (aa > bb);
+}
+
+static void query_reset(symbol_name_query *q) {
+  /* Only the positions touched by the last lookup need clearing. */
+  for (gushort g = 0; g < q->touched_num; g++) {
+    q->hit_arr[q->touched_arr[g]] = 0;
+    q->score_arr[q->touched_arr[g]] = 0.0f;
+  }
+  q->touched_num = 0;
+}
+
+static void query_run(symbol_name_query *q, const gchar *key) {
+  symbol_name_index *idx = q->index;
+  GArray *posting;
+  gushort pos;
+
+  query_reset(q);
+
+  GString *norm_key = g_string_sized_new(32);
+  normalize_text(norm_key, key, FALSE);
+  GArray *grams = text_to_grams(norm_key->str, SN_QUERY_MAX_GRAMS);
+
+  if (grams->len == 0) {
+    g_array_unref(grams);
+    g_string_free(norm_key, TRUE);
+    return;
+  }
+
+  /* Count the trigrams each position shares with the key. */
+  for (guint i = 0; i < grams->len; i++) {
+    posting = g_hash_table_lookup(
+        idx->posting_table,
+        GUINT_TO_POINTER(g_array_index(grams, guint32, i)));
+    if (posting == NULL)
+      continue;
+
+    for (guint j = 0; j < posting->len; j++) {
+      pos = g_array_index(posting, gushort, j);
+      if (q->hit_arr[pos]++ == 0)
+        q->touched_arr[q->touched_num++] = pos;
+    }
+  }
+
+  /* Short keys must match every trigram, longer keys at least half of them
+     [this tolerates a typo or two]. */
+  guint min_hits = grams->len <= 2 ? grams->len : (grams->len + 1) / 2;
+  gchar *key_down = g_ascii_strdown(key, -1);
+  gushort matched = 0;
+
+  for (gushort g = 0; g < q->touched_num; g++) {
+    pos = q->touched_arr[g];
+    if (q->hit_arr[pos] < min_hits)
+      continue;
+
+    gfloat score = (gfloat)q->hit_arr[pos] / (gfloat)grams->len;
+
+    /* Rank symbol matches and whole word prefix matches first. */
+    if (g_str_has_prefix(idx->symbol_arr[pos], key_down))
+      score += g_strcmp0(idx->symbol_arr[pos], key_down) ? 1.0f : 2.0f;
+    if (strstr(idx->text_arr[pos], norm_key->str))
+      score += 0.5f;
+
+    q->score_arr[pos] = score;
+    matched++;
+  }
+
+  /* Keep only the best scoring results. */
+  if (matched > SN_QUERY_MAX_RESULTS) {
+    gfloat *scores = g_malloc(sizeof(gfloat) * matched);
+    gushort n = 0;
+    for (gushort g = 0; g < q->touched_num; g++)
+      if (q->score_arr[q->touched_arr[g]] > 0.0f)
+        scores[n++] = q->score_arr[q->touched_arr[g]];
+
+    g_qsort_with_data(scores, n, sizeof(gfloat), score_desc, NULL);
+    gfloat cutoff = scores[SN_QUERY_MAX_RESULTS - 1];
+    g_free(scores);
+
+    for (gushort g = 0; g < q->touched_num; g++)
+      if (q->score_arr[q->touched_arr[g]] < cutoff)
+        q->score_arr[q->touched_arr[g]] = 0.0f;
+  }
+
+  g_free(key_down);
+  g_array_unref(grams);
+  g_string_free(norm_key, TRUE);
+}
+
+gfloat SNQueryScore(symbol_name_query *q, const gchar *key, guint pos)
+/* Return the match score of a map position against the key, 0 if it doesn't
+   match.  The lookup is only run when the key changes, subsequent calls with
+   the same key [one per completion model row] are an array read. */
+{
+  if (q == NULL || key == NULL || pos >= q->index->size)
+    return 0.0f;
+
+  if (g_strcmp0(q->key, key)) {
+    g_free(q->key);
+    q->key = g_strdup(key);
+    query_run(q, key);
+  }
+
+  return q->score_arr[pos];
+}
@@ -34,6 +34,7 @@ POSSIBILITY OF SUCH DAMAGE.
 #include "../include/gui_types.h"
 #include "../include/macros.h"
 #include "../include/multicurl.h"
+#include "../include/mutex.h"
 #include "../include/sqlite.h"
 #include "../include/workfuncs.h"
 
@@ -200,8 +201,9 @@ static symbol_name_map *sym_name_map_dup(symbol_name_map *sn_map)
       (symbol_name_map *)g_malloc(sizeof(*sn_map_dup));
   sn_map_dup->sn_container_arr = g_malloc(1);
   sn_map_dup->size = 0;
-  /* Not using the hash table. */
+  /* Not using the hash table or the index. */
   sn_map_dup->hash_table = NULL;
+  sn_map_dup->index = NULL;
 
   for (gushort g = 0; g < sn_map->size; g++)
     AddSymbolToMap(sn_map->sn_container_arr[g]->symbol,
@@ -304,116 +306,134 @@ static void add_special_symbols(symbol_name_map *sn_map) {
                    sn_map);
 }
 
-static void symbol_list_fetch_cleanup(gchar *line, FILE **fp,
-                                      symbol_name_map *sn_map, MemType *Nasdaq,
-                                      MemType *NYSE) {
-  if (line)
-    g_free(line);
-  if (fp && fp[0])
-    fclose(fp[0]);
-  if (fp && fp[1])
-    fclose(fp[1]);
-  FreeMemtype(Nasdaq);
-  FreeMemtype(NYSE);
+typedef struct { /* Parser state of one symbol list download. */
+  GString *row;            /* The current row, carried between write
+                              callbacks until its newline arrives. */
+  symbol_name_map *sn_map; /* Both lists are parsed into this map. */
+  portfolio_packet *pkg;
+  gboolean invalid; /* The reply isn't a symbol list. */
+} symbol_list_stream;
+
+static gboolean symbol_list_parse_row(symbol_list_stream *stream)
+/* Parse one complete row, "Symbol|Security Name|..." [at least 7 fields],
+   into the map.  Returns FALSE if the reply is invalid. */
+{
+  gchar *line = g_strchomp(stream->row->str);
 
-  if (sn_map) {
-    SNMapDestruct(sn_map);
-    g_free(sn_map);
+  /* If we have an empty line, continue. */
+  if (!line[0])
+    return TRUE;
+
+  /* Invalid replies start with a tag. */
+  if (strchr(line, '<'))
+    return FALSE;
+
+  /* Split the first two fields in place, count the rest. */
+  gchar *symbol_token = line, *name_token = NULL;
+  guint fields = 1;
+  for (gchar *ch = line; *ch; ch++) {
+    if (*ch != '|')
+      continue;
+    fields++;
+    if (fields <= 3)
+      *ch = 0;
+    if (fields == 2)
+      name_token = ch + 1;
+  }
+  if (fields < 7)
+    return FALSE;
+
+  /* Check if the symbol is valid. */
+  if (check_symbol(symbol_token) == FALSE)
+    return TRUE;
+
+  /* Warrant, Unit, and stock class symbols [BRK.A -> BRK-A] are different
+     on Yahoo! Make appropriate changes, if needed. */
+  gchar *tmp_symbol = g_strdup(symbol_token);
+  substitute_warrant_and_unit_symbols(&tmp_symbol);
+
+  /* Add the symbol and the name to the symbol-name map. */
+  AddSymbolToMap(tmp_symbol, name_token, stream->sn_map);
+  g_free(tmp_symbol);
+
+  return TRUE;
+}
+
+static gsize symbol_list_write_callback(gchar *ptr, gsize size, gsize nmemb,
+                                        gpointer userdata)
+/* cURL write callback, parses each row as soon as its newline arrives, so
+   the download and the parsing overlap and only a partial row is buffered.
+   Returning 0 aborts the transfer. */
+{
+  symbol_list_stream *stream = (symbol_list_stream *)userdata;
+  gsize realsize = size * nmemb;
+  gchar *end = ptr + realsize, *nl;
+
+  while (ptr < end) {
+    nl = memchr(ptr, '\n', end - ptr);
+    if (nl == NULL) {
+      /* Carry the partial row into the next callback. */
+      g_string_append_len(stream->row, ptr, end - ptr);
+      break;
+    }
+
+    g_string_append_len(stream->row, ptr, nl - ptr);
+    if (!symbol_list_parse_row(stream)) {
+      stream->invalid = TRUE;
+      return 0;
+    }
+    g_string_truncate(stream->row, 0);
+    ptr = nl + 1;
+
+    /* If we are exiting the application, abort the transfer. */
+    if (stream->pkg->IsExitingApp())
+      return 0;
   }
+
+  return realsize;
 }
 
 static symbol_name_map *symbol_list_fetch(portfolio_packet *pkg) {
   meta *D = pkg->GetMetaClass();
 
-  gchar *line = NULL;
-  gsize linecap = 0;
-  gchar **token_array;
-  gchar *symbol_token, *name_token, *tmp_symbol;
-
   symbol_name_map *sn_map = (symbol_name_map *)g_malloc(sizeof(*sn_map));
   sn_map->sn_container_arr = g_malloc(1);
   sn_map->size = 0;
   sn_map->hash_table = NULL;
+  sn_map->index = NULL;
+
+  /* The second list is added after [or interleaved with] the first list,
+     the map is sorted afterwards. */
+  symbol_list_stream stream[2];
+  for (guint8 k = 0; k < 2; k++)
+    stream[k] = (symbol_list_stream){g_string_sized_new(256), sn_map, pkg,
+                                     FALSE};
+
+  /* The lists change once a day, they are validator cached by URL. */
+  SetUpCurlHandleStream(D->NASDAQ_completion_hnd, D->multicurl_cmpltn_hnd,
+                        D->Nasdaq_Symbol_url_ch, D->Nasdaq_Symbol_url_ch,
+                        symbol_list_write_callback, &stream[0]);
+  SetUpCurlHandleStream(D->NYSE_completion_hnd, D->multicurl_cmpltn_hnd,
+                        D->NYSE_Symbol_url_ch, D->NYSE_Symbol_url_ch,
+                        symbol_list_write_callback, &stream[1]);
+
+  gboolean failed = (PerformMultiCurl_no_prog(D->multicurl_cmpltn_hnd) != 0 ||
+                     pkg->IsExitingApp());
+
+  /* Parse a last row without a trailing newline. */
+  for (guint8 k = 0; k < 2; k++) {
+    if (!failed && stream[k].row->len)
+      failed = !symbol_list_parse_row(&stream[k]);
+    failed = failed || stream[k].invalid;
+    g_string_free(stream[k].row, TRUE);
+  }
 
-  MemType Nasdaq_Struct, NYSE_Struct;
-  Nasdaq_Struct.memory = NULL;
-  Nasdaq_Struct.size = 0;
-  NYSE_Struct.memory = NULL;
-  NYSE_Struct.size = 0;
-
-  SetUpCurlHandle(D->NASDAQ_completion_hnd, D->multicurl_cmpltn_hnd,
-                  D->Nasdaq_Symbol_url_ch, &Nasdaq_Struct);
-  SetUpCurlHandle(D->NYSE_completion_hnd, D->multicurl_cmpltn_hnd,
-                  D->NYSE_Symbol_url_ch, &NYSE_Struct);
-  if (PerformMultiCurl_no_prog(D->multicurl_cmpltn_hnd) != 0 ||
-      pkg->IsExitingApp()) {
-    symbol_list_fetch_cleanup(NULL, NULL, sn_map, &Nasdaq_Struct, &NYSE_Struct);
+  if (failed) {
+    SNMapDestruct(sn_map);
+    g_free(sn_map);
     return NULL;
   }
 
-  /* Convert a String to a File Pointer Stream for Reading */
-  FILE *fp[2];
-  fp[0] = fmemopen((gpointer)Nasdaq_Struct.memory, Nasdaq_Struct.size + 1, "r");
-  fp[1] = fmemopen((gpointer)NYSE_Struct.memory, NYSE_Struct.size + 1, "r");
-
-  guint8 k = 0;
-  while (k < 2) {
-    /* Read the file stream one line at a time */
-    /* Populate the Symbol-Name Array. The second list is added after the first
-     * list. */
-    while (getline(&line, &linecap, fp[k]) > 0) {
-      g_strchomp(line);
-
-      /* If we have an empty line, continue. */
-      if (!line[0])
-        continue;
-
-      /* Invalid replies start with a tag. */
-      if (g_strrstr(line, "<")) {
-        symbol_list_fetch_cleanup(line, fp, sn_map, &Nasdaq_Struct,
-                                  &NYSE_Struct);
-        return NULL;
-      }
-
-      /* Get the symbol and the name from the line. */
-      token_array = g_strsplit(line, "|", -1);
-      if (g_strv_length(token_array) < 7) {
-        symbol_list_fetch_cleanup(line, fp, sn_map, &Nasdaq_Struct,
-                                  &NYSE_Struct);
-        g_strfreev(token_array);
-        return NULL;
-      }
-      symbol_token = token_array[0] ? token_array[0] : "";
-      name_token = token_array[1] ? token_array[1] : "";
-
-      /* Check if the symbol is valid. */
-      if (check_symbol(symbol_token) == FALSE) {
-        g_strfreev(token_array);
-        continue;
-      }
-
-      /* Warrant, Unit, and stock class symbols [BRK.A -> BRK-A] are different
-         on Yahoo! Make appropriate changes, if needed. */
-      tmp_symbol = g_strdup(symbol_token);
-      substitute_warrant_and_unit_symbols(&tmp_symbol);
-
-      /* Add the symbol and the name to the symbol-name map. */
-      if (symbol_token && name_token)
-        AddSymbolToMap(tmp_symbol, name_token, sn_map);
-
-      g_free(tmp_symbol);
-      g_strfreev(token_array);
-
-      /* If we are exiting the application, return immediately. */
-      if (pkg->IsExitingApp()) {
-        symbol_list_fetch_cleanup(line, fp, sn_map, &Nasdaq_Struct,
-                                  &NYSE_Struct);
-        return NULL;
-      }
-    } /* end while loop */
-    k++;
-  } /* end while loop */
-
   /* Add special symbols such as indices, commodities, bonds, and crypto to the
    * map. */
 
@@ -429,11 +449,26 @@ static symbol_name_map *symbol_list_fetch(portfolio_packet *pkg) {
    * value. */
   CreateHashTable(sn_map);
 
-  symbol_list_fetch_cleanup(line, fp, NULL, &Nasdaq_Struct, &NYSE_Struct);
-
   return sn_map;
 }
 
+static void sym_name_map_index(portfolio_packet *pkg, symbol_name_map *sn_map)
+/* Build the trigram index of the sn_map, reusing the tokenized entries of the
+   previous index, if any.  The map and the meta class each hold a reference.
+*/
+{
+  meta *D = pkg->GetMetaClass();
+
+  MutexLock(&mutexes[SYMBOL_NAME_INDEX_MUTEX]);
+
+  symbol_name_index *idx = SNIndexNew(sn_map, D->sym_index);
+  SNIndexUnref(D->sym_index);
+  D->sym_index = idx;
+  sn_map->index = SNIndexRef(idx);
+
+  g_mutex_unlock(&mutexes[SYMBOL_NAME_INDEX_MUTEX]);
+}
+
 symbol_name_map *SymNameFetch(portfolio_packet *pkg)
 /* This function is only meant to be run once, at application startup.
    Populate the symbol-name map from the local Db.
@@ -447,11 +482,15 @@ symbol_name_map *SymNameFetch(portfolio_packet *pkg)
 
   /* Sort the sn_map [it should already be sorted from the Db, but just to
    * make sure]. */
-  if (sn_map)
+  if (sn_map) {
     g_qsort_with_data(
         (gconstpointer)&sn_map->sn_container_arr[0], (gint)sn_map->size,
         (gsize)sizeof(sn_map->sn_container_arr[0]), alpha_asc_sec_name, NULL);
 
+    /* Index the names for fuzzy completion lookups. */
+    sym_name_map_index(pkg, sn_map);
+  }
+
   return sn_map;
 }
 
@@ -470,6 +509,9 @@ symbol_name_map *SymNameFetchUpdate(portfolio_packet *pkg,
   symbol_name_map *sn_map_new = symbol_list_fetch(pkg);
 
   if (sn_map_new) {
+    /* Rebuild the fuzzy completion index from the previous one. */
+    sym_name_map_index(pkg, sn_map_new);
+
     /* Set the packet interface sym_map variable to the new sym_map. */
     pkg->SetSymNameMap(sn_map_new);
 
@@ -524,4 +566,10 @@ void SNMapDestruct(symbol_name_map *sn_map)
     g_hash_table_destroy(sn_map->hash_table);
     sn_map->hash_table = NULL;
   }
+
+  /* Release the map's reference to the trigram index */
+  if (sn_map->index) {
+    SNIndexUnref(sn_map->index);
+    sn_map->index = NULL;
+  }
 }
\ No newline at end of file
@@ -0,0 +1,201 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <string.h>
+
+#include "../include/workfuncs.h"
+
+/* The per-cycle display strings.  Every *_mrkd_ch [and raw _ch] field the
+   ToStrings pass writes is bumped from the open generation instead of
+   g_realloc'd; publishing a pass opens the other generation and rewinds it
+   in O(1).  The chunks are kept and reused, so after the first cycles a
+   trading day makes no further allocations for them.
+
+   The writers hold CLASS_TOSTRINGS_MUTEX, the GUI reads the fields without
+   it, so the rewind is skipped while a reader is marked [the generation
+   grows instead and is rewound on a later publish]. */
+
+#define ARENA_CHUNK_SIZE (64 * 1024)
+
+typedef struct arena_chunk {
+  struct arena_chunk *next; /* Appended atomically, never unlinked. */
+  gsize size;
+  gsize used;
+  gchar data[];
+} arena_chunk;
+
+typedef struct {
+  arena_chunk *head;
+  arena_chunk *cur; /* The chunk being bumped. */
+} arena_generation;
+
+static arena_generation gens[2];
+static guint open_gen = 0; /* The generation being written. */
+static gint readers = 0;
+static GPrivate active_key; /* Set on a thread writing the open generation. */
+
+static arena_chunk *chunk_new(gsize size) {
+  arena_chunk *C = g_malloc(sizeof(arena_chunk) + size);
+  C->next = NULL;
+  C->size = size;
+  C->used = 0;
+  return C;
+}
+
+static gchar *arena_alloc(gsize size)
+/* Bump size bytes from the open generation, 8 byte aligned. */
+{
+  arena_generation *G = &gens[open_gen];
+  size = (size + 7) & ~(gsize)7;
+
+  while (G->cur && G->cur->used + size > G->cur->size)
+    G->cur = G->cur->next;
+
+  if (G->cur == NULL) {
+    /* Out of rewound chunks, append one. */
+    arena_chunk *C = chunk_new(MAX(size, ARENA_CHUNK_SIZE));
+    arena_chunk **tail = &G->head;
+    while (*tail)
+      tail = &(*tail)->next;
+    g_atomic_pointer_set(tail, C);
+    G->cur = C;
+  }
+
+  gchar *p = G->cur->data + G->cur->used;
+  G->cur->used += size;
+  return p;
+}
+
+static gboolean arena_owns(const gchar *str)
+/* The chunks are never freed while running, any thread may walk them. */
+{
+  for (guint g = 0; g < 2; g++)
+    for (arena_chunk *C = g_atomic_pointer_get(&gens[g].head); C;
+         C = g_atomic_pointer_get(&C->next))
+      if (str >= C->data && str < C->data + C->size)
+        return TRUE;
+  return FALSE;
+}
+
+void StrArenaEnter()
+/* The calling thread's string writes come from the open generation until
+   StrArenaLeave.  Hold CLASS_TOSTRINGS_MUTEX. */
+{
+  g_private_set(&active_key, GINT_TO_POINTER(1));
+}
+
+void StrArenaLeave() { g_private_set(&active_key, NULL); }
+
+void StrArenaPublish()
+/* The open generation is complete; open the other one, rewound unless the
+   GUI may still hold its strings.  Hold CLASS_TOSTRINGS_MUTEX. */
+{
+  open_gen ^= 1;
+  if (g_atomic_int_get(&readers))
+    return;
+
+  arena_generation *G = &gens[open_gen];
+  for (arena_chunk *C = G->head; C; C = C->next)
+    C->used = 0;
+  G->cur = G->head;
+}
+
+void StrArenaReadBegin()
+/* Mark a GUI reader of the display strings [without the ToStrings lock]. */
+{
+  g_atomic_int_inc(&readers);
+}
+
+void StrArenaReadEnd() { g_atomic_int_add(&readers, -1); }
+
+gchar *StrArenaRealloc(gchar *str, const gsize keep, const gsize size)
+/* Resize str to size bytes, keeping its first keep bytes.
+
+   Within StrArenaEnter the result is bumped from the open generation [a
+   heap str is freed], otherwise it's a g_realloc [a copy if str is in the
+   arena]. */
+{
+  gboolean owned = str && arena_owns(str);
+  gchar *p;
+
+  if (g_private_get(&active_key)) {
+    p = arena_alloc(size);
+    if (keep)
+      memcpy(p, str, keep);
+    if (str && !owned)
+      g_free(str);
+    return p;
+  }
+
+  if (!owned)
+    return g_realloc(str, size);
+
+  p = g_malloc(size);
+  if (keep)
+    memcpy(p, str, keep);
+  return p;
+}
+
+gchar *StrArenaKeep(gchar *str)
+/* Copy str into the open generation, a string a pass doesn't convert again
+   outlives the next publish.  Within StrArenaEnter, a heap str is kept as
+   is. */
+{
+  if (str == NULL || !g_private_get(&active_key) || !arena_owns(str))
+    return str;
+
+  gsize size = strlen(str) + 1;
+  gchar *p = arena_alloc(size);
+  memcpy(p, str, size);
+  return p;
+}
+
+void StrArenaFree(gchar *str)
+/* g_free, unless str is in the arena. */
+{
+  if (str && !arena_owns(str))
+    g_free(str);
+}
+
+void StrArenaDestruct()
+/* Free both generations, after the class destructors. */
+{
+  for (guint g = 0; g < 2; g++) {
+    arena_chunk *C = gens[g].head;
+    while (C) {
+      arena_chunk *next = C->next;
+      g_free(C);
+      C = next;
+    }
+    gens[g].head = gens[g].cur = NULL;
+  }
+}
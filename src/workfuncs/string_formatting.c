@@ -30,9 +30,9 @@ IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 POSSIBILITY OF SUCH DAMAGE.
 */
 
+#include <limits.h> /* CHAR_MAX */
 #include <locale.h>
 #include <math.h>
-#include <monetary.h>
 
 #include "../include/macros.h"
 #include "../include/workfuncs.h"
@@ -162,62 +162,211 @@ gdouble StringToDouble(const gchar *str)
   return num;
 }
 
-static gsize abs_val(const gdouble n) {
-  /* If n is 9.9999 we want it to round up, to account for the strfmon and
-   * snprintf rounding at zero, one, two, and three decimal places. */
-  if (n < 0)
-    return (gsize)ceil(-1.0f * n);
-  return (gsize)ceil(n);
+/* The LC_MONETARY and LC_NUMERIC rules of LOCALE, read once. */
+typedef struct {
+  gchar mon_point[8];
+  gchar mon_sep[8];
+  gchar mon_grouping[8];
+  gchar currency[16];
+  gboolean cs_precedes_p;
+  gboolean cs_precedes_n;
+  gboolean space_p; /* A space between the currency symbol and the value. */
+  gboolean space_n;
+  gchar num_point[8];
+  gchar num_sep[8];
+  gchar num_grouping[8];
+} format_locale;
+
+static format_locale fmt_loc;
+static gsize fmt_loc_init = 0;
+
+static const format_locale *format_locale_get()
+/* setlocale () is process-global and slow, it's called here once instead of
+   for every number. */
+{
+  if (g_once_init_enter(&fmt_loc_init)) {
+    setlocale(LC_ALL, LOCALE);
+    const struct lconv *lc = localeconv();
+
+    g_strlcpy(fmt_loc.mon_point, lc->mon_decimal_point, 8);
+    g_strlcpy(fmt_loc.mon_sep, lc->mon_thousands_sep, 8);
+    g_strlcpy(fmt_loc.mon_grouping, lc->mon_grouping, 8);
+    g_strlcpy(fmt_loc.currency, lc->currency_symbol, 16);
+    fmt_loc.cs_precedes_p = lc->p_cs_precedes != 0;
+    fmt_loc.cs_precedes_n = lc->n_cs_precedes != 0;
+    /* Parentheses replace the sign [the '(' flag], only 1 puts a space
+       between the symbol and the value. */
+    fmt_loc.space_p = lc->p_sep_by_space == 1;
+    fmt_loc.space_n = lc->n_sep_by_space == 1;
+    g_strlcpy(fmt_loc.num_point, lc->decimal_point, 8);
+    g_strlcpy(fmt_loc.num_sep, lc->thousands_sep, 8);
+    g_strlcpy(fmt_loc.num_grouping, lc->grouping, 8);
+    /* strfmon falls back to the numeric point [the C locale has no
+       monetary one]. */
+    if (fmt_loc.mon_point[0] == 0)
+      g_strlcpy(fmt_loc.mon_point, fmt_loc.num_point, 8);
+
+    g_once_init_leave(&fmt_loc_init, 1);
+  }
+  return &fmt_loc;
+}
+
+typedef struct { /* A bounded append into the caller's buffer. */
+  gchar *buf;
+  gsize size;
+  gsize len;
+} format_out;
+
+static void out_str(format_out *o, const gchar *s) {
+  for (; *s; s++, o->len++)
+    if (o->len + 1 < o->size)
+      o->buf[o->len] = *s;
+}
+
+static void out_char(format_out *o, gchar c) {
+  if (o->len + 1 < o->size)
+    o->buf[o->len] = c;
+  o->len++;
+}
+
+static gsize split_digits(gdouble a, guint8 dec_pts, gchar *int_digits,
+                          gchar *frac_digits)
+/* Round a [non-negative] to dec_pts like printf, into digit strings.
+   Returns the number of integer digits.
+
+   The fast path scales to an integer; it can only round differently from
+   printf's exact decimal conversion when the scaled value is within its
+   multiplication error of a half, or too large to carry that error, those
+   values [and inf/nan] go through snprintf on the stack. */
+{
+  static const gdouble pow10_arr[] = {1.0, 10.0, 100.0, 1000.0, 10000.0};
+  gdouble scaled = a * pow10_arr[dec_pts];
+  gdouble frac = scaled - floor(scaled);
+
+  if (scaled < 1099511627776.0 /* 2^40 */ && fabs(frac - 0.5) > 1e-3) {
+    guint64 n = (guint64)(scaled + 0.5);
+    gchar rev[24];
+    gsize len = 0;
+
+    for (guint8 d = 0; d < dec_pts; d++, n /= 10)
+      frac_digits[dec_pts - 1 - d] = (gchar)('0' + n % 10);
+    frac_digits[dec_pts] = 0;
+
+    do {
+      rev[len++] = (gchar)('0' + n % 10);
+      n /= 10;
+    } while (n);
+    for (gsize i = 0; i < len; i++)
+      int_digits[i] = rev[len - 1 - i];
+    int_digits[len] = 0;
+    return len;
+  }
+
+  /* The exact path, "inf" and "nan" pass through as the integer part. */
+  gchar tmp[FORMAT_BUF_SIZE];
+  g_snprintf(tmp, sizeof(tmp), "%.*f", dec_pts, a);
+  gsize len = strcspn(tmp, ".,");
+  g_strlcpy(int_digits, tmp, MIN(len + 1, FORMAT_BUF_SIZE));
+  g_strlcpy(frac_digits, tmp[len] ? tmp + len + 1 : "", FORMAT_BUF_SIZE);
+  return strlen(int_digits);
+}
+
+static void out_grouped(format_out *o, const gchar *digits, gsize n,
+                        const gchar *sep, const gchar *grouping)
+/* The integer digits with a separator per the locale's grouping string
+   [each entry a group size from the right, 0 repeats the last, CHAR_MAX
+   stops grouping]. */
+{
+  guint8 sep_before[FORMAT_BUF_SIZE] = {0};
+  gsize left = n;
+  gint size = 0;
+
+  for (const gchar *g = grouping; sep[0] && *g != CHAR_MAX;) {
+    if (*g)
+      size = *g++;
+    if (size <= 0 || left <= (gsize)size)
+      break;
+    left -= (gsize)size;
+    sep_before[left] = 1;
+  }
+
+  for (gsize i = 0; i < n; i++) {
+    if (sep_before[i])
+      out_str(o, sep);
+    out_char(o, digits[i]);
+  }
 }
 
-static gsize length_doub_string(const gdouble n, const guint8 dec_pts,
-                                const guint type) {
+gsize FormatDouble(gchar *buf, gsize size, const gdouble num,
+                   const guint8 digits_right, const guint format_type)
+/* Render num into buf [FORMAT_BUF_SIZE fits any quote, past ~1e40 the
+   string is truncated] as a monetary,
+   percent, or number string in LOCALE, the same output as strfmon "%(.Nn"
+   and printf "%'.Nf[%]".  No allocation, and no setlocale () after the
+   first call.
 
-  gsize number = abs_val(n);
-  gsize a = 1, b = 1, len = 0, chars = 0;
-  guint8 neg_sign = 0, commas = 0;
+   Returns the string length [like snprintf, the untruncated length]. */
+{
+  const format_locale *L = format_locale_get();
+  gchar int_digits[FORMAT_BUF_SIZE], frac_digits[FORMAT_BUF_SIZE];
+  format_out o = {buf, size, 0};
+  guint8 dec_pts = MIN(digits_right, 4);
 
-  do {
-    chars++;
-    if (a % (1000 * b) == 0) {
-      b *= 1000;
-      commas++;
+  /* printf keeps the sign of a negative that rounds to zero, strfmon tests
+     num < 0. */
+  gboolean neg = format_type == MON_STR ? num < 0 : signbit(num) != 0;
+  gsize n = split_digits(fabs(num), dec_pts, int_digits, frac_digits);
+
+  switch (format_type) {
+  case MON_STR: {
+    gboolean precedes = neg ? L->cs_precedes_n : L->cs_precedes_p;
+    gboolean space = L->currency[0] && (neg ? L->space_n : L->space_p);
+
+    if (neg)
+      out_char(&o, '(');
+    if (precedes) {
+      out_str(&o, L->currency);
+      if (space)
+        out_char(&o, ' ');
+    }
+    /* strfmon hands -0.0 to printf unchanged. */
+    if (!neg && signbit(num))
+      out_char(&o, '-');
+    out_grouped(&o, int_digits, n, L->mon_sep, L->mon_grouping);
+    if (dec_pts) {
+      out_str(&o, L->mon_point);
+      out_str(&o, frac_digits);
+    }
+    if (!precedes) {
+      if (space)
+        out_char(&o, ' ');
+      out_str(&o, L->currency);
     }
-    a *= 10;
-  } while (number >= a);
-
-  switch (type) {
-  case MON_STR:
-    /* The currency symbol and
-       the negative brackets. */
-    len++;
-    if (n < 0)
-      neg_sign += 2;
+    if (neg)
+      out_char(&o, ')');
     break;
+  }
   case PER_STR:
-    /* The percent sign and
-       the negative sign. */
-    len++;
-    if (n < 0)
-      neg_sign++;
+  case NUM_STR:
+    if (neg)
+      out_char(&o, '-');
+    out_grouped(&o, int_digits, n, L->num_sep, L->num_grouping);
+    if (dec_pts) {
+      out_str(&o, L->num_point);
+      out_str(&o, frac_digits);
+    }
+    if (format_type == PER_STR)
+      out_char(&o, '%');
     break;
-  default: /* NUM_STR */
-    /* The negative sign. */
-    if (n < 0)
-      neg_sign++;
+  default:
+    g_print("FormatDouble format_type out of range.\n");
+    exit(EXIT_FAILURE);
     break;
-  };
-
-  /* The len value includes space for thousands
-     grouping [usually commas] and a negative sign [if needed]. */
-  len += neg_sign + commas + chars;
-
-  /* Add one for the decimal point char [usually a point]. */
-  if (dec_pts != 0)
-    len += (dec_pts + 1);
+  }
 
-  /* The string length not including the null character. */
-  return len;
+  if (size)
+    buf[MIN(o.len, size - 1)] = 0;
+  return o.len;
 }
 
 void DoubleToFormattedStr(gchar **dst, const gdouble num,
@@ -242,80 +391,16 @@ void DoubleToFormattedStr(gchar **dst, const gdouble num,
   if (!dst || digits_right > 4)
     return;
 
-  gsize len = length_doub_string(num, digits_right, format_type) + 1;
+  gchar buf[FORMAT_BUF_SIZE];
+  gsize len = FormatDouble(buf, sizeof(buf), num, digits_right, format_type);
+
+  /* The untruncated length, a huge value doesn't fit buf. */
+  len = MIN(len, sizeof(buf) - 1);
+
   /* Adjust the string length */
-  gchar *tmp = g_realloc(dst[0], len);
+  gchar *tmp = StrArenaRealloc(dst[0], 0, len + 1);
   dst[0] = tmp;
-
-  switch (format_type) {
-  case MON_STR:
-    switch (digits_right) {
-    case 0:
-      tmp = "%(.0n";
-      break;
-    case 1:
-      tmp = "%(.1n";
-      break;
-    case 2:
-      tmp = "%(.2n";
-      break;
-    case 3:
-      tmp = "%(.3n";
-      break;
-    default:
-      tmp = "%(.4n";
-      break;
-    }
-    setlocale(LC_ALL, LOCALE);
-    strfmon(dst[0], len, tmp, num);
-    break;
-  case PER_STR:
-    switch (digits_right) {
-    case 0:
-      tmp = "%'.0lf%%";
-      break;
-    case 1:
-      tmp = "%'.1lf%%";
-      break;
-    case 2:
-      tmp = "%'.2lf%%";
-      break;
-    case 3:
-      tmp = "%'.3lf%%";
-      break;
-    default:
-      tmp = "%'.4lf%%";
-      break;
-    }
-    setlocale(LC_NUMERIC, LOCALE);
-    g_snprintf(dst[0], len, tmp, num);
-    break;
-  case NUM_STR:
-    switch (digits_right) {
-    case 0:
-      tmp = "%'.0lf";
-      break;
-    case 1:
-      tmp = "%'.1lf";
-      break;
-    case 2:
-      tmp = "%'.2lf";
-      break;
-    case 3:
-      tmp = "%'.3lf";
-      break;
-    default:
-      tmp = "%'.4lf";
-      break;
-    }
-    setlocale(LC_NUMERIC, LOCALE);
-    g_snprintf(dst[0], len, tmp, num);
-    break;
-  default:
-    g_print("DoubleToFormattedStr format_type out of range.\n");
-    exit(EXIT_FAILURE);
-    break;
-  }
+  memcpy(dst[0], buf, len + 1);
 }
 
 void StringToMonStr(gchar **dst, const gchar *src, const guint8 digits_right)
@@ -417,7 +502,7 @@ gchar *PangoToCssFontStr(const gchar *pango_fnt_str) {
 }
 
 void ClearStr(gchar **str) {
-  gchar *tmp = g_realloc(str[0], g_utf8_strlen("", -1) + 1);
+  gchar *tmp = StrArenaRealloc(str[0], 0, g_utf8_strlen("", -1) + 1);
   str[0] = tmp;
   g_snprintf(str[0], 1, "");
 }
\ No newline at end of file
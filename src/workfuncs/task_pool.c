@@ -0,0 +1,228 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "../include/macros.h"
+#include "../include/mutex.h"
+#include "../include/workfuncs.h"
+
+/* A bounded worker pool for the GUI actions, in place of a thread per button
+   press.  Each lane has its own GThreadPool, so a long fetch never delays an
+   interactive recalculation.  Tasks are run in submission order within a
+   lane. */
+
+typedef struct {
+  GThreadFunc func;
+  gpointer data;
+  GDestroyNotify free_func;
+  task_lane lane;
+  task_flags flags;
+  gint cancelled; /* The cancellation token, set atomically. */
+} task;
+
+static const gint lane_threads_arr[TASK_LANE_NUM] = {2, 3, 2};
+
+/* Guarded by TASK_POOL_MUTEX. */
+static GThreadPool *pool_arr[TASK_LANE_NUM];
+static GHashTable *queued_table = NULL; /* Coalesced (func, data) to queued
+                                           task. */
+static GHashTable *live_table = NULL;   /* Queued and running tasks. */
+
+static GPrivate current_task;
+
+static guint task_key_hash(gconstpointer key) {
+  const task *t = (const task *)key;
+  return g_direct_hash((gconstpointer)t->func) * 31 + g_direct_hash(t->data);
+}
+
+static gboolean task_key_equal(gconstpointer a, gconstpointer b) {
+  const task *x = (const task *)a, *y = (const task *)b;
+  return x->func == y->func && x->data == y->data;
+}
+
+static void queued_remove(task *t)
+/* Drop t from the coalesced tasks, if it's the one queued for its key. */
+{
+  if (g_hash_table_lookup(queued_table, t) == t)
+    g_hash_table_remove(queued_table, t);
+}
+
+static void task_run(gpointer data, gpointer user_data) {
+  UNUSED(user_data)
+  task *t = (task *)data;
+
+  /* A task submitted from now on runs again, after this one. */
+  MutexLock(&mutexes[TASK_POOL_MUTEX]);
+  queued_remove(t);
+  g_mutex_unlock(&mutexes[TASK_POOL_MUTEX]);
+
+  if (!g_atomic_int_get(&t->cancelled)) {
+    g_private_set(&current_task, t);
+    t->func(t->data);
+    g_private_set(&current_task, NULL);
+  }
+
+  MutexLock(&mutexes[TASK_POOL_MUTEX]);
+  g_hash_table_remove(live_table, t);
+  g_mutex_unlock(&mutexes[TASK_POOL_MUTEX]);
+
+  if (t->free_func)
+    t->free_func(t->data);
+  g_free(t);
+}
+
+void TaskPoolInit() {
+  MutexLock(&mutexes[TASK_POOL_MUTEX]);
+  queued_table = g_hash_table_new(task_key_hash, task_key_equal);
+  live_table = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+  for (guint l = 0; l < TASK_LANE_NUM; l++) {
+    pool_arr[l] = g_thread_pool_new(task_run, NULL, lane_threads_arr[l],
+                                     FALSE, NULL);
+    if (pool_arr[l] == NULL) {
+      g_printerr("Cannot create the worker pool.\n");
+      exit(EXIT_FAILURE);
+    }
+  }
+  g_mutex_unlock(&mutexes[TASK_POOL_MUTEX]);
+
+  /* Keep the idle workers around, button presses come in bursts. */
+  g_thread_pool_set_max_unused_threads(TASK_LANE_NUM);
+}
+
+void TaskPoolDestruct()
+/* Drop the queued tasks, wait for the running ones.  The I/O lane is
+   drained instead [queued database writes still run], it's last so the
+   other lanes' running tasks can still queue a write. */
+{
+  for (guint l = 0; l < TASK_LANE_NUM; l++) {
+    /* A task still running drops its submissions to this lane. */
+    MutexLock(&mutexes[TASK_POOL_MUTEX]);
+    GThreadPool *pool = pool_arr[l];
+    pool_arr[l] = NULL;
+    g_mutex_unlock(&mutexes[TASK_POOL_MUTEX]);
+
+    if (pool)
+      g_thread_pool_free(pool, l != TASK_LANE_IO, TRUE);
+  }
+
+  MutexLock(&mutexes[TASK_POOL_MUTEX]);
+  if (live_table) {
+    /* Tasks dropped from the queue weren't freed. */
+    GHashTableIter iter;
+    gpointer key;
+    g_hash_table_iter_init(&iter, live_table);
+    while (g_hash_table_iter_next(&iter, &key, NULL)) {
+      task *t = (task *)key;
+      if (t->free_func)
+        t->free_func(t->data);
+      g_free(t);
+    }
+    g_hash_table_destroy(live_table);
+    g_hash_table_destroy(queued_table);
+  }
+  live_table = queued_table = NULL;
+  g_mutex_unlock(&mutexes[TASK_POOL_MUTEX]);
+}
+
+void TaskSubmit(task_lane lane, task_flags flags, GThreadFunc func,
+                gpointer data, GDestroyNotify free_func)
+/* Queue func(data) on a lane's workers, free_func(data) is called after it
+   runs [or is cancelled].
+
+   TASK_COALESCE: if func is already queued with the same data [not yet
+   running] the request is dropped, five queued recalculations run once.
+   TASK_SUPERSEDE: cancel the queued and running tasks with the same func, a
+   running task sees TaskCancelled () return TRUE. */
+{
+  task *t = g_malloc0(sizeof(*t));
+  t->func = func;
+  t->data = data;
+  t->free_func = free_func;
+  t->lane = lane;
+  t->flags = flags;
+
+  MutexLock(&mutexes[TASK_POOL_MUTEX]);
+  /* The pool is gone [the application is exiting], or the same work is
+     already queued. */
+  if (pool_arr[lane] == NULL ||
+      (flags & TASK_COALESCE && g_hash_table_contains(queued_table, t))) {
+    g_mutex_unlock(&mutexes[TASK_POOL_MUTEX]);
+    if (free_func)
+      free_func(data);
+    g_free(t);
+    return;
+  }
+
+  if (flags & TASK_SUPERSEDE) {
+    GHashTableIter iter;
+    gpointer key;
+    g_hash_table_iter_init(&iter, live_table);
+    while (g_hash_table_iter_next(&iter, &key, NULL))
+      if (((task *)key)->func == func) {
+        g_atomic_int_set(&((task *)key)->cancelled, TRUE);
+        queued_remove((task *)key);
+      }
+  }
+
+  if (flags & TASK_COALESCE)
+    g_hash_table_insert(queued_table, t, t);
+  g_hash_table_add(live_table, t);
+
+  /* Pushed under the lock, TaskPoolDestruct can't free the pool between. */
+  g_thread_pool_push(pool_arr[lane], t, NULL);
+  g_mutex_unlock(&mutexes[TASK_POOL_MUTEX]);
+}
+
+void TaskCancelLane(task_lane lane)
+/* Cancel every queued and running task on a lane. */
+{
+  GHashTableIter iter;
+  gpointer key;
+
+  MutexLock(&mutexes[TASK_POOL_MUTEX]);
+  g_hash_table_iter_init(&iter, live_table);
+  while (g_hash_table_iter_next(&iter, &key, NULL)) {
+    task *t = (task *)key;
+    if (t->lane != lane)
+      continue;
+    g_atomic_int_set(&t->cancelled, TRUE);
+    queued_remove(t);
+  }
+  g_mutex_unlock(&mutexes[TASK_POOL_MUTEX]);
+}
+
+gboolean TaskCancelled()
+/* Called from a task, TRUE if it was cancelled or superseded. */
+{
+  task *t = g_private_get(&current_task);
+  return t && g_atomic_int_get(&t->cancelled);
+}
@@ -248,7 +248,182 @@ static gboolean check_holiday(gint year, gint month, gint dayofmonth,
 }
 
 /* Time calculations are based off of the New York timezone due to
- * daylight-savings time adjustments, the process timezone remains unchanged. */
+ * daylight-savings time adjustments, the process timezone remains unchanged.
+
+   The timezone is loaded once and each year's trading calendar is built the
+   first time the year is seen [normally at startup, in ClassInitMetaClass].
+   A day's entry holds its NY midnight, any DST change during it, and its
+   session open and close in UTC seconds, so GetTimeData only compares
+   integers against the clock.  The holiday rules are check_holiday's, run
+   once per day of the year. */
+
+typedef struct {
+  gint64 midnight_s; /* 00:00 NY in UTC seconds. */
+  gint64 shift_s;    /* A UTC offset change during the day, else G_MAXINT64. */
+  gint32 offset_s;   /* The UTC offset at midnight, and after the shift. */
+  gint32 shift_offset_s;
+  gint64 open_s; /* The session in UTC seconds, both 0 if there's none. */
+  gint64 close_s;
+  const gchar *holiday_ch; /* Closed all day [weekend holidays included]. */
+  const gchar *early_ch;   /* An early close, shown after the close. */
+  guint8 weekday;          /* G_DATE_MONDAY to G_DATE_SUNDAY. */
+} market_day;
+
+typedef struct market_year {
+  struct market_year *next; /* Pushed atomically, freed at exit. */
+  gint64 start_s;           /* Jan 1 and the next Jan 1, NY midnight. */
+  gint64 end_s;
+  guint16 n_days;
+  market_day day[366];
+} market_year;
+
+static GTimeZone *ny_tz = NULL;
+static market_year *years = NULL;
+
+static GTimeZone *new_york_tz() {
+  /* g_time_zone_new() is deprecated in Glib 2.68, however, its replacement;
+   * g_time_zone_new_identifier() is unavailable in earlier variations used
+   * by some OSs; Debian. */
+  if (g_once_init_enter(&ny_tz))
+    g_once_init_leave(&ny_tz, g_time_zone_new(NEW_YORK_TIME_ZONE));
+  return ny_tz;
+}
+
+static gint64 ny_unix(GTimeZone *tz, GDate *date, gint hour, gint min) {
+  GDateTime *dt =
+      g_date_time_new(tz, g_date_get_year(date), g_date_get_month(date),
+                      g_date_get_day(date), hour, min, 0);
+  gint64 unix_s = g_date_time_to_unix(dt);
+  g_date_time_unref(dt);
+  return unix_s;
+}
+
+static gint32 ny_offset(GTimeZone *tz, gint64 unix_s) {
+  gint interval = g_time_zone_find_interval(tz, G_TIME_TYPE_UNIVERSAL, unix_s);
+  return g_time_zone_get_offset(tz, interval);
+}
+
+static market_year *market_year_new(gint year)
+/* Build the calendar of one year. */
+{
+  GTimeZone *tz = new_york_tz();
+  market_year *Y = g_malloc0(sizeof(*Y));
+  GDate *date = g_date_new_dmy(1, G_DATE_JANUARY, (GDateYear)year);
+  gchar *hol_str;
+
+  Y->start_s = ny_unix(tz, date, 0, 0);
+  while (g_date_get_year(date) == year) {
+    market_day *d = &Y->day[Y->n_days++];
+    gint month = g_date_get_month(date);
+    gint dayofmonth = g_date_get_day(date);
+    gint weekday = g_date_get_weekday(date);
+
+    d->weekday = (guint8)weekday;
+    d->midnight_s = ny_unix(tz, date, 0, 0);
+    d->offset_s = ny_offset(tz, d->midnight_s);
+    d->shift_s = G_MAXINT64;
+    d->shift_offset_s = d->offset_s;
+
+    if (check_holiday(year, month, dayofmonth, weekday, 0, &hol_str))
+      d->holiday_ch = hol_str;
+    else if (check_holiday(year, month, dayofmonth, weekday,
+                           CLOSING_HOUR_EARLY_CLOSE, &hol_str))
+      d->early_ch = hol_str;
+
+    if (weekday != SAT && weekday != SUN && !d->holiday_ch) {
+      d->open_s = ny_unix(tz, date, OPEN_HOUR, OPEN_MINUTE);
+      d->close_s = ny_unix(
+          tz, date, d->early_ch ? CLOSING_HOUR_EARLY_CLOSE : CLOSING_HOUR, 0);
+    }
+    g_date_add_days(date, 1);
+  }
+  Y->end_s = ny_unix(tz, date, 0, 0);
+  g_date_free(date);
+
+  /* The DST changes [on the hour, in the small hours]. */
+  for (guint16 i = 0; i < Y->n_days; i++) {
+    market_day *d = &Y->day[i];
+    gint64 next_s = i + 1 < Y->n_days ? Y->day[i + 1].midnight_s : Y->end_s;
+    if (ny_offset(tz, next_s) == d->offset_s)
+      continue;
+    for (gint64 t = d->midnight_s; t < next_s; t += 3600) {
+      if (ny_offset(tz, t) != d->offset_s) {
+        d->shift_s = t;
+        d->shift_offset_s = ny_offset(tz, t);
+        break;
+      }
+    }
+  }
+  return Y;
+}
+
+static const market_year *market_year_get(gint64 now_s)
+/* The calendar covering now_s, built on a year's first use. */
+{
+  for (market_year *Y = g_atomic_pointer_get(&years); Y;
+       Y = g_atomic_pointer_get(&Y->next))
+    if (now_s >= Y->start_s && now_s < Y->end_s)
+      return Y;
+
+  GDateTime *dt = g_date_time_new_from_unix_utc(now_s);
+  GDateTime *ny_dt = g_date_time_to_timezone(dt, new_york_tz());
+  market_year *Y = market_year_new(g_date_time_get_year(ny_dt));
+  g_date_time_unref(ny_dt);
+  g_date_time_unref(dt);
+
+  /* Two threads may build the same year, the loser's copy is dropped. */
+  market_year *head;
+  do {
+    head = g_atomic_pointer_get(&years);
+    for (market_year *O = head; O; O = O->next)
+      if (O->start_s == Y->start_s) {
+        g_free(Y);
+        return O;
+      }
+    Y->next = head;
+  } while (!g_atomic_pointer_compare_and_exchange(&years, head, Y));
+  return Y;
+}
+
+static const market_day *market_day_get(gint64 now_s)
+/* The NY day covering now_s. */
+{
+  const market_year *Y = market_year_get(now_s);
+
+  /* Days are 23 to 25 hours long, the estimate is off by one at most. */
+  gint i = (gint)((now_s - Y->start_s) / (24 * 3600));
+  if (i >= Y->n_days)
+    i = Y->n_days - 1;
+  while (i > 0 && now_s < Y->day[i].midnight_s)
+    i--;
+  while (i + 1 < Y->n_days && now_s >= Y->day[i + 1].midnight_s)
+    i++;
+  return &Y->day[i];
+}
+
+static gint64 market_day_wall(const market_day *d, gint64 now_s)
+/* The NY wall-clock seconds since the day's midnight. */
+{
+  gint64 wall_s = now_s - d->midnight_s;
+  if (now_s >= d->shift_s)
+    wall_s += d->shift_offset_s - d->offset_s;
+  return wall_s;
+}
+
+void TimeDataDestruct()
+/* Free the calendars and the timezone, after the threads have stopped. */
+{
+  market_year *Y = years;
+  while (Y) {
+    market_year *next = Y->next;
+    g_free(Y);
+    Y = next;
+  }
+  years = NULL;
+  if (ny_tz)
+    g_time_zone_unref(ny_tz);
+}
+
 gboolean GetTimeData(gboolean *holiday, gchar **holiday_str, gint *h_r,
                      gint *m_r, gint *s_r, gint *h_cur, gint *m_cur)
 
@@ -266,71 +441,66 @@ gboolean GetTimeData(gboolean *holiday, gchar **holiday_str, gint *h_r,
   */
 
   /* The NYSE/NASDAQ Markets are open from 09:30 to 16:00 EST most days. */
-  gboolean closed;
-
-  /* Get the GDateTime object for the New York timezone. */
-  /* g_time_zone_new() is deprecated in Glib 2.68, however, its replacement;
-   * g_time_zone_new_identifier() is unavailable in earlier variations used
-   * by some OSs; Debian. */
-  GTimeZone *ny_tz = g_time_zone_new(NEW_YORK_TIME_ZONE);
-  GDateTime *dt = g_date_time_new_now(ny_tz);
-  g_time_zone_unref(ny_tz);
-  gint year = g_date_time_get_year(dt);
-  gint month = g_date_time_get_month(dt);
-  gint dayofmonth = g_date_time_get_day_of_month(dt);
-  gint weekday = g_date_time_get_day_of_week(dt);
-  gint hour = g_date_time_get_hour(dt);
-  gint min = g_date_time_get_minute(dt);
-  gint sec = g_date_time_get_second(dt);
-  g_date_time_unref(dt);
+  gint64 now_s = g_get_real_time() / G_USEC_PER_SEC;
+  const market_day *d = market_day_get(now_s);
 
-  gchar *hol_str;
-  gboolean hol_bool =
-      check_holiday(year, month, dayofmonth, weekday, hour, &hol_str);
+  gboolean closed = now_s < d->open_s || now_s >= d->close_s;
+  const gchar *hol_str = d->holiday_ch;
+  if (!hol_str && d->early_ch && now_s >= d->close_s)
+    hol_str = d->early_ch;
 
   if (holiday)
-    *holiday = hol_bool;
+    *holiday = hol_str != NULL;
   if (holiday_str)
-    holiday_str[0] = hol_str;
+    holiday_str[0] = (gchar *)hol_str;
 
   /* Set the current hour and minute in the NY timezone */
+  gint64 wall_s = market_day_wall(d, now_s);
   if (h_cur)
-    *h_cur = hour;
+    *h_cur = (gint)(wall_s / 3600);
   if (m_cur)
-    *m_cur = min;
-
-  /* Closed */
-  if (weekday == SAT || weekday == SUN || hol_bool || hour < OPEN_HOUR ||
-      (hour == OPEN_HOUR && min < OPEN_MINUTE) || hour >= CLOSING_HOUR) {
-    if (h_r)
-      *h_r = 0;
-    if (m_r)
-      *m_r = 0;
-    if (s_r)
-      *s_r = 0;
-    closed = TRUE;
-    /* Open: closes early if today is the day before July 4th, black friday, or
-     * the day before Christmas. */
-  } else if ((month == JUL && dayofmonth == 3) ||
-             (month == NOV && weekday == FRI && dayofmonth >= 23 &&
-              dayofmonth <= 29) ||
-             (month == DEC && dayofmonth == 24)) {
-    if (h_r)
-      *h_r = CLOSING_HOUR_EARLY_CLOSE - 1 - hour;
-    if (m_r)
-      *m_r = 59 - min;
-    if (s_r)
-      *s_r = 59 - sec;
-    closed = FALSE;
-    /* Open */
-  } else {
-    if (h_r)
-      *h_r = CLOSING_HOUR - 1 - hour;
-    if (m_r)
-      *m_r = 59 - min;
-    if (s_r)
-      *s_r = 59 - sec;
-    closed = FALSE;
-  }
+    *m_cur = (gint)(wall_s / 60 % 60);
+
+  /* The time remaining to the close [to the last whole second]. */
+  gint64 rem_s = closed ? 0 : d->close_s - now_s - 1;
+  if (h_r)
+    *h_r = (gint)(rem_s / 3600);
+  if (m_r)
+    *m_r = (gint)(rem_s / 60 % 60);
+  if (s_r)
+    *s_r = (gint)(rem_s % 60);
   return closed;
-}
\ No newline at end of file
+}
+
+gint MarketDayAt(gint64 unix_s, gint *weekday, gint64 *open_s,
+                 gint64 *close_s)
+/* Return the NY wall-clock seconds since midnight at unix_s.  Sets the
+   day's weekday [G_DATE_MONDAY to G_DATE_SUNDAY] and its session in UTC
+   seconds, both 0 on weekends and holidays.  Unused args should be sent as
+   NULL. */
+{
+  const market_day *d = market_day_get(unix_s);
+
+  if (weekday)
+    *weekday = d->weekday;
+  if (open_s)
+    *open_s = d->open_s;
+  if (close_s)
+    *close_s = d->close_s;
+  return (gint)market_day_wall(d, unix_s);
+}
+
+gint64 MarketNextOpen(gint64 unix_s)
+/* The first session open after unix_s, in UTC seconds. */
+{
+  const market_day *d = market_day_get(unix_s);
+
+  /* A long weekend at most, the loop is bounded by a year. */
+  for (guint i = 0; i < 366; i++) {
+    if (d->open_s > unix_s)
+      return d->open_s;
+    /* The next day [days are 23 to 25 hours long]. */
+    d = market_day_get(d->midnight_s + 36 * 3600);
+  }
+  return 0;
+}
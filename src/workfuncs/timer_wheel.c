@@ -0,0 +1,372 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "../include/macros.h"
+#include "../include/mutex.h"
+#include "../include/workfuncs.h"
+
+/* One thread drives the periodic work [the clocks, the fetch session, the
+   cache expiry, and the state flush] from a hierarchical timer wheel, in
+   place of a sleeping thread per job.
+
+   The wheel ticks on Unix second boundaries.  A timer of period P fires on
+   the seconds divisible by P, so co-due timers share a wake-up and the
+   thread sleeps until the earliest expiry.  Four levels of 64 slots cover
+   2^24 seconds [~194 days], later expiries wait in the top level.
+
+   The callbacks run on the wheel thread without TIMER_WHEEL_MUTEX held, they
+   should hand long work to the task pool.  A callback returns FALSE to
+   remove its timer, a single shot timer [TimerAddAt] is removed after its
+   callback. */
+
+#define WHEEL_BITS 6
+#define WHEEL_SLOTS (1 << WHEEL_BITS)
+#define WHEEL_MASK (WHEEL_SLOTS - 1)
+#define WHEEL_LEVELS 4
+#define WHEEL_SPAN ((gint64)1 << (WHEEL_BITS * WHEEL_LEVELS))
+
+typedef struct wheel_timer {
+  struct wheel_timer *next;
+  struct wheel_timer **pprev; /* NULL while not in a slot [running]. */
+  guint id;
+  guint period_s; /* 0 for a single shot. */
+  gint64 expires_s;
+  timer_func func;
+  gpointer data;
+  gboolean removed; /* Removed while running, freed after the callback. */
+} wheel_timer;
+
+/* Guarded by TIMER_WHEEL_MUTEX. */
+static wheel_timer *slot_arr[WHEEL_LEVELS][WHEEL_SLOTS];
+static GHashTable *timer_table = NULL; /* Id to wheel_timer. */
+static gint64 wheel_s = 0;             /* The last second processed. */
+static guint next_id = 1;
+static gboolean running = FALSE;
+static GCond wheel_cond;
+static GThread *wheel_thread = NULL;
+
+static gint64 real_time_sec() { return g_get_real_time() / G_TIME_SPAN_SECOND; }
+
+static gint64 next_expiry(guint period_s, gint64 after_s)
+/* The first second after after_s divisible by the period. */
+{
+  return (after_s / period_s + 1) * period_s;
+}
+
+static void timer_unlink(wheel_timer *T) {
+  if (T->pprev == NULL)
+    return;
+  *T->pprev = T->next;
+  if (T->next)
+    T->next->pprev = T->pprev;
+  T->next = NULL;
+  T->pprev = NULL;
+}
+
+static void timer_place(wheel_timer *T)
+/* Put the timer in the slot of its expiry, on the lowest level whose span
+   covers it.  An expiry of the current second is only placed while
+   advancing [a cascade], its slot is processed next. */
+{
+  gint64 expires_s = MAX(T->expires_s, wheel_s);
+  gint64 delta = expires_s - wheel_s;
+  guint level = 0;
+
+  if (delta >= WHEEL_SPAN)
+    expires_s = wheel_s + WHEEL_SPAN - 1; /* Placed again when reached. */
+  while (level < WHEEL_LEVELS - 1 &&
+         expires_s - wheel_s >= (gint64)1 << (WHEEL_BITS * (level + 1)))
+    level++;
+
+  wheel_timer **slot =
+      &slot_arr[level][(expires_s >> (WHEEL_BITS * level)) & WHEEL_MASK];
+  T->next = *slot;
+  if (T->next)
+    T->next->pprev = &T->next;
+  T->pprev = slot;
+  *slot = T;
+}
+
+static void cascade(guint level)
+/* Move the slot reached on this level down the wheel. */
+{
+  wheel_timer **slot =
+      &slot_arr[level][(wheel_s >> (WHEEL_BITS * level)) & WHEEL_MASK];
+  wheel_timer *T = *slot;
+  *slot = NULL;
+
+  while (T) {
+    wheel_timer *next = T->next;
+    T->next = NULL;
+    T->pprev = NULL;
+    timer_place(T);
+    T = next;
+  }
+}
+
+static wheel_timer *wheel_advance(wheel_timer *due)
+/* Process the next second, push its due timers onto the due list. */
+{
+  wheel_s++;
+  for (guint level = 1; level < WHEEL_LEVELS; level++) {
+    if (wheel_s & (((gint64)1 << (WHEEL_BITS * level)) - 1))
+      break;
+    cascade(level);
+  }
+
+  wheel_timer **slot = &slot_arr[0][wheel_s & WHEEL_MASK];
+  wheel_timer *T = *slot;
+  *slot = NULL;
+
+  while (T) {
+    wheel_timer *next = T->next;
+    T->next = NULL;
+    T->pprev = NULL;
+    if (T->expires_s > wheel_s) {
+      timer_place(T);
+    } else {
+      T->next = due;
+      due = T;
+    }
+    T = next;
+  }
+  return due;
+}
+
+static void wheel_rebase(gint64 now_s)
+/* The clock stepped back, place every timer again from now. */
+{
+  GHashTableIter iter;
+  gpointer value;
+
+  wheel_s = now_s;
+  memset(slot_arr, 0, sizeof(slot_arr));
+  g_hash_table_iter_init(&iter, timer_table);
+  while (g_hash_table_iter_next(&iter, NULL, &value)) {
+    wheel_timer *T = (wheel_timer *)value;
+    T->next = NULL;
+    T->pprev = NULL;
+    T->expires_s = T->period_s ? next_expiry(T->period_s, now_s)
+                               : MAX(T->expires_s, now_s + 1);
+    timer_place(T);
+  }
+}
+
+static gint64 wheel_earliest()
+/* The earliest expiry, G_MAXINT64 without timers. */
+{
+  GHashTableIter iter;
+  gpointer value;
+  gint64 earliest = G_MAXINT64;
+
+  g_hash_table_iter_init(&iter, timer_table);
+  while (g_hash_table_iter_next(&iter, NULL, &value))
+    earliest = MIN(earliest, ((wheel_timer *)value)->expires_s);
+  return earliest;
+}
+
+static void wheel_run_due(wheel_timer *due, gint64 now_s)
+/* Run the due callbacks, then reschedule or free their timers.  Called with
+   TIMER_WHEEL_MUTEX held, released around the callbacks. */
+{
+  g_mutex_unlock(&mutexes[TIMER_WHEEL_MUTEX]);
+  for (wheel_timer *T = due; T; T = T->next)
+    if (!g_atomic_int_get(&T->removed) && !T->func(T->data))
+      g_atomic_int_set(&T->removed, TRUE);
+  MutexLock(&mutexes[TIMER_WHEEL_MUTEX]);
+
+  while (due) {
+    wheel_timer *T = due;
+    due = T->next;
+    T->next = NULL;
+    if (T->removed || T->period_s == 0) {
+      /* The table's value destructor frees the timer. */
+      g_hash_table_remove(timer_table, GUINT_TO_POINTER(T->id));
+      continue;
+    }
+    /* Missed periods [a suspend, a slow callback] are not run again. */
+    T->expires_s = next_expiry(T->period_s, MAX(now_s, wheel_s));
+    timer_place(T);
+  }
+}
+
+static gpointer wheel_thd(gpointer data) {
+  UNUSED(data)
+
+  MutexLock(&mutexes[TIMER_WHEEL_MUTEX]);
+  while (running) {
+    gint64 earliest = wheel_earliest();
+    if (earliest == G_MAXINT64) {
+      g_cond_wait(&wheel_cond, &mutexes[TIMER_WHEEL_MUTEX]);
+    } else {
+      gint64 wait_us = earliest * G_TIME_SPAN_SECOND - g_get_real_time();
+      if (wait_us > 0 &&
+          g_cond_wait_until(&wheel_cond, &mutexes[TIMER_WHEEL_MUTEX],
+                            g_get_monotonic_time() + wait_us))
+        continue; /* Signalled, a timer was added or changed. */
+    }
+
+    gint64 now_s = real_time_sec();
+    if (now_s < wheel_s)
+      wheel_rebase(now_s);
+
+    wheel_timer *due = NULL;
+    while (wheel_s < now_s)
+      due = wheel_advance(due);
+    if (due)
+      wheel_run_due(due, now_s);
+  }
+  g_mutex_unlock(&mutexes[TIMER_WHEEL_MUTEX]);
+  return NULL;
+}
+
+void TimerWheelInit()
+/* Start the wheel thread, before the first TimerAdd. */
+{
+  MutexLock(&mutexes[TIMER_WHEEL_MUTEX]);
+  timer_table = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL,
+                                      g_free);
+  wheel_s = real_time_sec();
+  running = TRUE;
+  g_cond_init(&wheel_cond);
+  g_mutex_unlock(&mutexes[TIMER_WHEEL_MUTEX]);
+
+  wheel_thread = g_thread_new("timer_wheel", wheel_thd, NULL);
+}
+
+void TimerWheelDestruct()
+/* Stop the wheel thread and free the timers, before the task pool. */
+{
+  if (wheel_thread == NULL)
+    return;
+
+  MutexLock(&mutexes[TIMER_WHEEL_MUTEX]);
+  running = FALSE;
+  g_cond_signal(&wheel_cond);
+  g_mutex_unlock(&mutexes[TIMER_WHEEL_MUTEX]);
+  g_thread_join(wheel_thread);
+  wheel_thread = NULL;
+
+  MutexLock(&mutexes[TIMER_WHEEL_MUTEX]);
+  g_hash_table_destroy(timer_table);
+  timer_table = NULL;
+  memset(slot_arr, 0, sizeof(slot_arr));
+  g_mutex_unlock(&mutexes[TIMER_WHEEL_MUTEX]);
+  g_cond_clear(&wheel_cond);
+}
+
+guint TimerAdd(guint period_s, timer_func func, gpointer data)
+/* Call func every period_s seconds, on the seconds divisible by it.
+   Returns the timer id, 0 if the wheel isn't running. */
+{
+  MutexLock(&mutexes[TIMER_WHEEL_MUTEX]);
+  if (timer_table == NULL) {
+    g_mutex_unlock(&mutexes[TIMER_WHEEL_MUTEX]);
+    return 0;
+  }
+
+  wheel_timer *T = g_malloc0(sizeof(*T));
+  T->id = next_id++;
+  T->period_s = MAX(period_s, 1);
+  T->expires_s = next_expiry(T->period_s, MAX(wheel_s, real_time_sec()));
+  T->func = func;
+  T->data = data;
+  g_hash_table_insert(timer_table, GUINT_TO_POINTER(T->id), T);
+  timer_place(T);
+
+  g_cond_signal(&wheel_cond);
+  g_mutex_unlock(&mutexes[TIMER_WHEEL_MUTEX]);
+  return T->id;
+}
+
+guint TimerAddAt(gint64 unix_s, timer_func func, gpointer data)
+/* Call func once at unix_s [the next second if it has passed], its return
+   value is ignored.  Returns the timer id, 0 if the wheel isn't running. */
+{
+  MutexLock(&mutexes[TIMER_WHEEL_MUTEX]);
+  if (timer_table == NULL) {
+    g_mutex_unlock(&mutexes[TIMER_WHEEL_MUTEX]);
+    return 0;
+  }
+
+  wheel_timer *T = g_malloc0(sizeof(*T));
+  T->id = next_id++;
+  T->expires_s = MAX(unix_s, MAX(wheel_s, real_time_sec()) + 1);
+  T->func = func;
+  T->data = data;
+  g_hash_table_insert(timer_table, GUINT_TO_POINTER(T->id), T);
+  timer_place(T);
+
+  g_cond_signal(&wheel_cond);
+  g_mutex_unlock(&mutexes[TIMER_WHEEL_MUTEX]);
+  return T->id;
+}
+
+void TimerSetPeriod(guint id, guint period_s)
+/* Change a timer's period, it next fires on the new period's boundary.
+   May be called from the timer's own callback. */
+{
+  period_s = MAX(period_s, 1);
+
+  MutexLock(&mutexes[TIMER_WHEEL_MUTEX]);
+  wheel_timer *T =
+      timer_table ? g_hash_table_lookup(timer_table, GUINT_TO_POINTER(id))
+                  : NULL;
+  if (T && T->period_s != period_s) {
+    T->period_s = period_s;
+    /* A running timer is placed after its callback. */
+    if (T->pprev) {
+      timer_unlink(T);
+      T->expires_s = next_expiry(period_s, MAX(wheel_s, real_time_sec()));
+      timer_place(T);
+      g_cond_signal(&wheel_cond);
+    }
+  }
+  g_mutex_unlock(&mutexes[TIMER_WHEEL_MUTEX]);
+}
+
+void TimerRemove(guint id)
+/* Remove a timer, its callback isn't called again [one already running
+   finishes]. */
+{
+  MutexLock(&mutexes[TIMER_WHEEL_MUTEX]);
+  wheel_timer *T =
+      timer_table ? g_hash_table_lookup(timer_table, GUINT_TO_POINTER(id))
+                  : NULL;
+  if (T && T->pprev) {
+    timer_unlink(T);
+    g_hash_table_remove(timer_table, GUINT_TO_POINTER(id));
+  } else if (T) {
+    g_atomic_int_set(&T->removed, TRUE);
+  }
+  g_mutex_unlock(&mutexes[TIMER_WHEEL_MUTEX]);
+}
@@ -0,0 +1,184 @@
+/*
+Copyright (c) 2022-2024 BostonBSD. All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+    (1) Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+    (2) Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in
+    the documentation and/or other materials provided with the
+    distribution.
+
+    (3)The name of the author may not be used to
+    endorse or promote products derived from this software without
+    specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include <glib/gprintf.h> /* g_fprintf() */
+#include <glib/gstdio.h>  /* g_fopen() */
+
+#include "../include/workfuncs.h"
+
+/* Pipeline tracing.  Every stage [and every symbol within a stage] records
+   a complete event with monotonic timestamps into a fixed ring buffer; the
+   oldest events are overwritten.  Writers only touch their own slot after an
+   atomic increment, so the hot path takes no lock.  TraceExport writes the
+   ring as Chrome/Perfetto trace JSON [chrome://tracing, ui.perfetto.dev]. */
+
+#define TRACE_RING_SIZE 16384 /* Must be a power of two. */
+#define TRACE_DETAIL_LEN 24
+
+typedef struct {
+  guint seq;         /* The event's index + 1, 0 while being written. */
+  const gchar *name; /* A string literal. */
+  gchar detail[TRACE_DETAIL_LEN]; /* The symbol or host, if any. */
+  gint64 start_us;
+  gint64 dur_us;
+  guint tid;
+} trace_event;
+
+static trace_event ring[TRACE_RING_SIZE];
+static gint ring_head = 0; /* Events written, wraps [read as guint]. */
+static gint next_tid = 0;
+static GPrivate tid_key;
+static gchar *export_path = NULL;
+
+void TraceInit(const gchar *path)
+/* Set the export path, the first caller wins [the command line flag is
+   parsed before the config directory default]. */
+{
+  if (export_path == NULL && path)
+    export_path = g_strdup(path);
+}
+
+void TraceDestruct() {
+  g_free(export_path);
+  export_path = NULL;
+}
+
+gint64 TraceBegin() { return g_get_monotonic_time(); }
+
+static guint thread_id()
+/* A small, stable id for the calling thread. */
+{
+  guint tid = GPOINTER_TO_UINT(g_private_get(&tid_key));
+  if (tid == 0) {
+    tid = (guint)g_atomic_int_add(&next_tid, 1) + 1;
+    g_private_set(&tid_key, GUINT_TO_POINTER(tid));
+  }
+  return tid;
+}
+
+void TraceEvent(const gchar *name, const gchar *detail, gint64 start_us,
+                gint64 dur_us)
+/* Record a complete event.  name must be a string literal, detail is copied
+   [truncated] and can be NULL. */
+{
+  guint idx = (guint)g_atomic_int_add(&ring_head, 1);
+  trace_event *e = &ring[idx & (TRACE_RING_SIZE - 1)];
+
+  g_atomic_int_set((gint *)&e->seq, 0);
+  e->name = name;
+  g_strlcpy(e->detail, detail ? detail : "", TRACE_DETAIL_LEN);
+  e->start_us = start_us;
+  e->dur_us = dur_us;
+  e->tid = thread_id();
+  g_atomic_int_set((gint *)&e->seq, (gint)(idx + 1));
+}
+
+void TraceEnd(const gchar *name, const gchar *detail, gint64 start_us)
+/* Record an event that started at start_us [from TraceBegin] and ends now.
+ */
+{
+  gint64 dur_us = g_get_monotonic_time() - start_us;
+  TraceEvent(name, detail, start_us, dur_us);
+
+  /* The stage totals [not the per-symbol events] are also metrics. */
+  if (detail == NULL)
+    MetricsStage(name, dur_us);
+}
+
+static void append_json_string(GString *out, const gchar *s) {
+  g_string_append_c(out, '"');
+  for (; *s; s++) {
+    if (*s == '"' || *s == '\\')
+      g_string_append_c(out, '\\');
+    if ((guchar)*s >= 0x20)
+      g_string_append_c(out, *s);
+  }
+  g_string_append_c(out, '"');
+}
+
+gboolean TraceExport()
+/* Write the events in the ring to the export path as Chrome trace JSON.
+   Events overwritten while exporting are skipped.
+
+   Returns TRUE on success. */
+{
+  if (export_path == NULL)
+    return FALSE;
+
+  /* The last TRACE_RING_SIZE indices, in unsigned [wrapping] arithmetic;
+     the ones never written have seq 0. */
+  guint head = (guint)g_atomic_int_get(&ring_head);
+  guint first = head - TRACE_RING_SIZE;
+  GString *out = g_string_new("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  gboolean first_event = TRUE;
+
+  for (guint i = first; i != head; i++) {
+    trace_event *slot = &ring[i & (TRACE_RING_SIZE - 1)];
+    guint seq = (guint)g_atomic_int_get((gint *)&slot->seq);
+    if (seq == 0 || seq != i + 1)
+      continue;
+
+    trace_event e = *slot;
+    /* The slot was reused while it was copied. */
+    if ((guint)g_atomic_int_get((gint *)&slot->seq) != seq)
+      continue;
+
+    if (!first_event)
+      g_string_append_c(out, ',');
+    first_event = FALSE;
+
+    g_string_append(out, "\n{\"name\":");
+    append_json_string(out, e.name);
+    g_string_append_printf(out,
+                           ",\"cat\":\"pipeline\",\"ph\":\"X\",\"pid\":1,"
+                           "\"tid\":%u,\"ts\":%" G_GINT64_FORMAT
+                           ",\"dur\":%" G_GINT64_FORMAT,
+                           e.tid, e.start_us, e.dur_us);
+    if (e.detail[0]) {
+      g_string_append(out, ",\"args\":{\"detail\":");
+      append_json_string(out, e.detail);
+      g_string_append_c(out, '}');
+    }
+    g_string_append_c(out, '}');
+  }
+  g_string_append(out, "\n]}\n");
+
+  gboolean ok = g_file_set_contents(export_path, out->str, (gssize)out->len,
+                                    NULL);
+  if (ok)
+    g_print("Trace written to '%s'.\n", export_path);
+  else
+    g_fprintf(stderr, "Cannot write the trace to '%s'.\n", export_path);
+
+  g_string_free(out, TRUE);
+  return ok;
+}
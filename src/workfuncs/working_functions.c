@@ -136,13 +136,10 @@ static gint64 unix_time_sec() {
   return (time_usec - (time_usec % G_TIME_SPAN_SECOND)) / G_TIME_SPAN_SECOND;
 }
 
-void GetYahooUrl(gchar **url_ch, const gchar *symbol_ch, guint period) {
-  gint64 end_time, start_time;
+static void yahoo_url(gchar **url_ch, const gchar *symbol_ch,
+                      gint64 start_time, gint64 end_time) {
   gushort len;
 
-  end_time = unix_time_sec();
-  start_time = end_time - (gint64)period;
-
   const gchar *fmt = YAHOO_URL_ONE "%s" YAHOO_URL_TWO "%ld" YAHOO_URL_THREE
                                    "%ld" YAHOO_URL_FOUR;
 
@@ -151,4 +148,18 @@ void GetYahooUrl(gchar **url_ch, const gchar *symbol_ch, guint period) {
   url_ch[0] = tmp;
 
   g_snprintf(url_ch[0], len, fmt, symbol_ch, start_time, end_time);
+}
+
+void GetYahooUrl(gchar **url_ch, const gchar *symbol_ch, guint period) {
+  gint64 end_time = unix_time_sec();
+  yahoo_url(url_ch, symbol_ch, end_time - (gint64)period, end_time);
+}
+
+void GetYahooHistoryUrl(gchar **url_ch, const gchar *symbol_ch,
+                        guint period)
+/* Same as GetYahooUrl, the window ends at the next UTC midnight [the URL
+   stays the same all day, its cached body and validators with it]. */
+{
+  gint64 end_time = (unix_time_sec() / 86400 + 1) * 86400;
+  yahoo_url(url_ch, symbol_ch, end_time - (gint64)period, end_time);
 }
\ No newline at end of file